@@ -0,0 +1,513 @@
+// Throughput benchmarks for the clamped number operators, each measured
+// against a raw arithmetic baseline and a widen-then-std::clamp baseline.
+//
+// Usage: ClampedNumbersBench.exe [--json] [--filter=SUBSTRING] [--min-time=SECONDS]
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "clamped_numbers.hh"
+#include "flat_clamped_numbers.hh"
+
+namespace
+{
+  using namespace clamped;
+
+  // The number of elements each pass of a benchmark operates on
+  const std::size_t elementCount = 1024;
+
+  enum class Op { ADD, MULTIPLY, DIVIDE, MODULO, SET, COMPARE };
+  enum class Distribution { IN_RANGE, SATURATING, RANDOM_SIGN };
+
+  const char * opName(Op op)
+  {
+    switch(op) {
+      case Op::ADD:      return "add";
+      case Op::MULTIPLY: return "multiply";
+      case Op::DIVIDE:   return "divide";
+      case Op::MODULO:   return "modulo";
+      case Op::SET:      return "set";
+      default:           return "compare";
+    }
+  }
+
+  const char * distributionName(Distribution distribution)
+  {
+    switch(distribution) {
+      case Distribution::IN_RANGE:   return "in_range";
+      case Distribution::SATURATING: return "saturating";
+      default:                       return "random_sign";
+    }
+  }
+
+  // Keeps the compiler from discarding a computation's result
+  template<typename T>
+  void doNotOptimize(const T &value)
+  {
+    asm volatile("" : : "g"(&value) : "memory");
+  }
+
+  // ############################################### Workload generation ############################################## //
+
+  template<typename NumT>
+  using DistributionInt = typename std::conditional<std::is_signed<NumT>::value, long long, unsigned long long>::type;
+
+  template<typename NumT>
+  typename std::enable_if<std::is_integral<NumT>::value, NumT>::type
+  uniform(std::mt19937_64 &rng, NumT lo, NumT hi)
+  {
+    return NumT(std::uniform_int_distribution<DistributionInt<NumT>>(lo, hi)(rng));
+  }
+
+  template<typename NumT>
+  typename std::enable_if<std::is_floating_point<NumT>::value, NumT>::type
+  uniform(std::mt19937_64 &rng, NumT lo, NumT hi)
+  {
+    return std::uniform_real_distribution<NumT>(lo, hi)(rng);
+  }
+
+  // Returns the magnitude of operand that keeps products and quotients
+  // interesting without exceeding the type
+  template<typename NumT>
+  NumT smallScale()
+  {
+    return std::is_floating_point<NumT>::value ? NumT(4) : NumT(3);
+  }
+
+  // The inputs of one benchmark: starting values, right operands, and the
+  // bounds every number shares. Raw baselines divide by rawOperands, in
+  // which the divisors a raw division cannot survive are replaced by one.
+  template<typename NumT>
+  struct Workload
+  {
+    NumT min;
+    NumT max;
+    std::vector<NumT> values;
+    std::vector<NumT> operands;
+    std::vector<NumT> rawOperands;
+  };
+
+  // Bounds are [-4s, 4s] for signed types and [0, 4s] for unsigned ones.
+  // In-range inputs never reach a bound; saturating inputs start near one and
+  // push past it; random-sign inputs are spread over the bounds with
+  // operands of either sign.
+  template<typename NumT>
+  Workload<NumT> makeWorkload(Op op, Distribution distribution, std::mt19937_64 &rng)
+  {
+    const bool isSigned = std::numeric_limits<NumT>::is_signed;
+    const NumT s = std::is_floating_point<NumT>::value ? NumT(1000) : NumT(std::numeric_limits<NumT>::max() / 8);
+    const NumT small = smallScale<NumT>();
+    const bool scaling = op == Op::MULTIPLY || op == Op::DIVIDE || op == Op::MODULO;
+
+    Workload<NumT> work;
+    work.min = isSigned ? NumT(-4 * s) : NumT(0);
+    work.max = NumT(4 * s);
+
+    for(std::size_t i = 0; i < elementCount; ++i) {
+      const bool negative = isSigned && (rng() & 1);
+      NumT value = 0, operand = 0;
+
+      switch(distribution) {
+        case Distribution::IN_RANGE:
+          value = isSigned ? uniform<NumT>(rng, NumT(-s), s) : uniform<NumT>(rng, s, NumT(2 * s));
+          operand = scaling ? uniform<NumT>(rng, NumT(1), small)
+              : (op == Op::SET || op == Op::COMPARE) ? uniform<NumT>(rng, work.min, work.max)
+              : isSigned ? uniform<NumT>(rng, NumT(-s), s) : uniform<NumT>(rng, NumT(0), NumT(s));
+          if(scaling && negative)
+            operand = NumT(-operand);
+        break;
+
+        case Distribution::SATURATING:
+          value = uniform<NumT>(rng, NumT(3 * s), NumT(4 * s));
+          operand = (op == Op::DIVIDE || op == Op::MODULO) ? NumT(0)
+              : (op == Op::MULTIPLY) ? uniform<NumT>(rng, NumT(2), NumT(small + 1))
+              : uniform<NumT>(rng, NumT(2 * s), NumT(4 * s));
+          if(op == Op::SET)
+            operand = NumT(operand + 4 * s);
+          if(negative) {
+            value = NumT(-value);
+            if(op == Op::ADD || op == Op::SET)
+              operand = NumT(-operand);
+          }
+        break;
+
+        case Distribution::RANDOM_SIGN:
+          value = uniform<NumT>(rng, work.min, work.max);
+          operand = scaling ? uniform<NumT>(rng, NumT(0), NumT(4 * small))
+              : uniform<NumT>(rng, NumT(0), NumT(4 * s));
+          if(negative)
+            operand = NumT(-operand);
+        break;
+      }
+
+      work.values.push_back(value);
+      work.operands.push_back(operand);
+      const bool unsafeDivisor = operand == 0 || (isSigned && operand == NumT(-1));
+      work.rawOperands.push_back(unsafeDivisor ? NumT(1) : operand);
+    }
+
+    return work;
+  }
+
+  // #################################################### Operations ################################################## //
+
+  // Takes the remainder of each number, leaving decimals, which have none,
+  // unmodified
+  template<typename ClampedT, typename NumT>
+  typename std::enable_if<std::is_integral<NumT>::value>::type
+  applyModulo(std::vector<ClampedT> &nums, const std::vector<NumT> &operands)
+  {
+    for(std::size_t i = 0; i < nums.size(); ++i)
+      nums[i] %= operands[i];
+  }
+
+  template<typename ClampedT, typename NumT>
+  typename std::enable_if<!std::is_integral<NumT>::value>::type
+  applyModulo(std::vector<ClampedT> &, const std::vector<NumT> &)
+  {}
+
+  // Applies an operation to every clamped number, given the right operands
+  // both as raw numbers and as clamped numbers sharing the same bounds
+  template<typename ClampedT, typename NumT>
+  void applyClamped(Op op, std::vector<ClampedT> &nums, const std::vector<ClampedT> &others,
+      const std::vector<NumT> &operands)
+  {
+    std::size_t count = 0;
+    switch(op) {
+      case Op::ADD:
+        for(std::size_t i = 0; i < nums.size(); ++i)
+          nums[i] += operands[i];
+      break;
+
+      case Op::MULTIPLY:
+        for(std::size_t i = 0; i < nums.size(); ++i)
+          nums[i] *= operands[i];
+      break;
+
+      case Op::DIVIDE:
+        for(std::size_t i = 0; i < nums.size(); ++i)
+          nums[i] /= operands[i];
+      break;
+
+      case Op::MODULO:
+        applyModulo(nums, operands);
+      break;
+
+      case Op::SET:
+        for(std::size_t i = 0; i < nums.size(); ++i)
+          nums[i].value(operands[i]);
+      break;
+
+      case Op::COMPARE:
+        for(std::size_t i = 0; i < nums.size(); ++i)
+          count += (nums[i] < others[i]);
+        doNotOptimize(count);
+      break;
+    }
+  }
+
+  // The type a std::clamp baseline widens to, so that no result overflows
+  template<typename NumT, typename = void>
+  struct Widened
+  {
+    using type = NumT;
+  };
+
+  template<typename NumT>
+  struct Widened<NumT, typename std::enable_if<std::is_integral<NumT>::value && (sizeof(NumT) < 8)>::type>
+  {
+    using type = int64_t;
+  };
+
+# ifdef __SIZEOF_INT128__
+  template<typename NumT>
+  struct Widened<NumT, typename std::enable_if<std::is_integral<NumT>::value && (sizeof(NumT) == 8)>::type>
+  {
+    using type = __int128;
+  };
+# endif
+
+  // Wrapping arithmetic for the raw baseline, avoiding signed overflow
+  template<typename NumT>
+  typename std::enable_if<std::is_integral<NumT>::value, NumT>::type wrap(NumT lhs, NumT rhs, bool multiply)
+  {
+    using UNumT = typename std::make_unsigned<NumT>::type;
+    return multiply ? NumT(UNumT(UNumT(lhs) * UNumT(rhs))) : NumT(UNumT(UNumT(lhs) + UNumT(rhs)));
+  }
+
+  template<typename NumT>
+  typename std::enable_if<!std::is_integral<NumT>::value, NumT>::type wrap(NumT lhs, NumT rhs, bool multiply)
+  {
+    return multiply ? lhs * rhs : lhs + rhs;
+  }
+
+  template<typename NumT>
+  typename std::enable_if<std::is_integral<NumT>::value, NumT>::type
+  remainder(NumT lhs, NumT rhs) { return NumT(lhs % rhs); }
+
+  template<typename NumT>
+  typename std::enable_if<!std::is_integral<NumT>::value, NumT>::type
+  remainder(NumT lhs, NumT) { return lhs; }
+
+  // Applies an operation to raw numbers, optionally widening each result
+  // and clamping it into the workload's bounds with std::clamp
+  template<typename NumT>
+  void applyRaw(Op op, std::vector<NumT> &nums, const Workload<NumT> &work, bool clamp)
+  {
+    using WideT = typename Widened<NumT>::type;
+    const WideT lo = work.min, hi = work.max;
+    std::size_t count = 0;
+
+    switch(op) {
+      case Op::ADD:
+        if(clamp)
+          for(std::size_t i = 0; i < nums.size(); ++i)
+            nums[i] = NumT(std::clamp<WideT>(WideT(nums[i]) + WideT(work.operands[i]), lo, hi));
+        else
+          for(std::size_t i = 0; i < nums.size(); ++i)
+            nums[i] = wrap(nums[i], work.operands[i], false);
+      break;
+
+      case Op::MULTIPLY:
+        if(clamp)
+          for(std::size_t i = 0; i < nums.size(); ++i)
+            nums[i] = NumT(std::clamp<WideT>(WideT(nums[i]) * WideT(work.operands[i]), lo, hi));
+        else
+          for(std::size_t i = 0; i < nums.size(); ++i)
+            nums[i] = wrap(nums[i], work.operands[i], true);
+      break;
+
+      case Op::DIVIDE:
+        if(clamp)
+          for(std::size_t i = 0; i < nums.size(); ++i)
+            nums[i] = NumT(std::clamp<WideT>(WideT(nums[i]) / WideT(work.rawOperands[i]), lo, hi));
+        else
+          for(std::size_t i = 0; i < nums.size(); ++i)
+            nums[i] = NumT(nums[i] / work.rawOperands[i]);
+      break;
+
+      case Op::MODULO:
+        if(clamp)
+          for(std::size_t i = 0; i < nums.size(); ++i)
+            nums[i] = std::clamp<NumT>(remainder(nums[i], work.rawOperands[i]), work.min, work.max);
+        else
+          for(std::size_t i = 0; i < nums.size(); ++i)
+            nums[i] = remainder(nums[i], work.rawOperands[i]);
+      break;
+
+      case Op::SET:
+        if(clamp)
+          for(std::size_t i = 0; i < nums.size(); ++i)
+            nums[i] = std::clamp<NumT>(work.operands[i], work.min, work.max);
+        else
+          for(std::size_t i = 0; i < nums.size(); ++i)
+            nums[i] = work.operands[i];
+      break;
+
+      case Op::COMPARE:
+        for(std::size_t i = 0; i < nums.size(); ++i)
+          count += (nums[i] < work.operands[i]);
+        doNotOptimize(count);
+      break;
+    }
+  }
+
+  // ##################################################### Harness #################################################### //
+
+  struct Options
+  {
+    bool json = false;
+    std::string filter;
+    double minTime = 0.05;
+  };
+
+  struct Result
+  {
+    std::string name;
+    std::size_t iterations;
+    double nanosPerOp;
+  };
+
+  // Runs passes of a benchmark until minTime has been spent within them,
+  // restoring its inputs before each untimed
+  template<typename ResetT, typename RunT>
+  Result measure(const std::string &name, const Options &options, ResetT reset, RunT run)
+  {
+    using Clock = std::chrono::steady_clock;
+    Clock::duration spent = Clock::duration::zero();
+    const Clock::duration budget = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(options.minTime));
+
+    std::size_t passes = 0;
+    while(spent < budget || passes < 3) {
+      reset();
+      const Clock::time_point start = Clock::now();
+      run();
+      spent += Clock::now() - start;
+      ++passes;
+    }
+
+    const double nanos = std::chrono::duration<double, std::nano>(spent).count();
+    return Result{name, passes * elementCount, nanos / double(passes * elementCount)};
+  }
+
+  class Suite
+  {
+    Options _options;
+    std::vector<Result> _results;
+    std::mt19937_64 _rng;
+
+    public:
+
+    explicit Suite(const Options &options):
+        _options(options), _rng(20240601)
+    {}
+
+    const std::vector<Result> & results() const
+    {
+      return this->_results;
+    }
+
+    // Benchmarks every operation and distribution on one clamped type, along
+    // with the raw and std::clamp baselines for its numeric type
+    template<typename ClampedT, typename NumT>
+    void run(const std::string &family, const std::string &typeName, const std::string &numName)
+    {
+      const Op ops[] = {Op::ADD, Op::MULTIPLY, Op::DIVIDE, Op::MODULO, Op::SET, Op::COMPARE};
+      const Distribution distributions[] = {
+        Distribution::IN_RANGE, Distribution::SATURATING, Distribution::RANDOM_SIGN
+      };
+
+      for(Op op : ops) {
+        if(op == Op::MODULO && !std::is_integral<NumT>::value)
+          continue;
+
+        for(Distribution distribution : distributions) {
+          const std::string suffix = std::string("/") + opName(op) + "/" + distributionName(distribution);
+          const Workload<NumT> work = makeWorkload<NumT>(op, distribution, this->_rng);
+
+          std::vector<ClampedT> pristine, others;
+          for(std::size_t i = 0; i < elementCount; ++i) {
+            pristine.emplace_back(work.values[i], work.min, work.max);
+            others.emplace_back(work.operands[i], work.min, work.max);
+          }
+
+          std::vector<ClampedT> nums = pristine;
+          this->record(family + "/" + typeName + suffix,
+              [&] { nums = pristine; }, [&] { applyClamped(op, nums, others, work.operands); doNotOptimize(nums[0]); });
+
+          std::vector<NumT> raw;
+          this->record("raw/" + numName + suffix,
+              [&] { raw = work.values; }, [&] { applyRaw(op, raw, work, false); doNotOptimize(raw[0]); });
+
+          if(op != Op::COMPARE)
+            this->record("std_clamp/" + numName + suffix,
+                [&] { raw = work.values; }, [&] { applyRaw(op, raw, work, true); doNotOptimize(raw[0]); });
+        }
+      }
+    }
+
+    private:
+
+    template<typename ResetT, typename RunT>
+    void record(const std::string &name, ResetT reset, RunT run)
+    {
+      if(this->_options.filter.empty() || name.find(this->_options.filter) != std::string::npos)
+        this->_results.push_back(measure(name, this->_options, reset, run));
+    }
+  };
+
+  void printTable(const std::vector<Result> &results)
+  {
+    std::printf("%-48s %14s %12s\n", "Benchmark", "Iterations", "ns/op");
+    for(const Result &result : results)
+      std::printf("%-48s %14zu %12.3f\n", result.name.c_str(), result.iterations, result.nanosPerOp);
+  }
+
+  // Prints results in the JSON schema of Google Benchmark, so that its
+  // comparison tooling can track regressions between releases
+  void printJson(const std::vector<Result> &results, const char *executable)
+  {
+    char date[32];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    std::printf("{\n  \"context\": {\n");
+    std::printf("    \"date\": \"%s\",\n", date);
+    std::printf("    \"executable\": \"%s\",\n", executable);
+    std::printf("    \"compiler\": \"%s\",\n", __VERSION__);
+#   ifdef CLAMPED_HEADER_ONLY
+    std::printf("    \"header_only\": true,\n");
+#   else
+    std::printf("    \"header_only\": false,\n");
+#   endif
+    std::printf("    \"elements_per_pass\": %zu\n  },\n  \"benchmarks\": [\n", elementCount);
+
+    for(std::size_t i = 0; i < results.size(); ++i) {
+      const Result &result = results[i];
+      std::printf("    {\n      \"name\": \"%s\",\n      \"run_type\": \"iteration\",\n", result.name.c_str());
+      std::printf("      \"iterations\": %zu,\n", result.iterations);
+      std::printf("      \"real_time\": %.6f,\n      \"cpu_time\": %.6f,\n", result.nanosPerOp, result.nanosPerOp);
+      std::printf("      \"time_unit\": \"ns\"\n    }%s\n", (i + 1 < results.size()) ? "," : "");
+    }
+
+    std::printf("  ]\n}\n");
+  }
+}
+
+int main(int argc, char **argv)
+{
+  Options options;
+  for(int i = 1; i < argc; ++i) {
+    if(std::strcmp(argv[i], "--json") == 0)
+      options.json = true;
+    else if(std::strncmp(argv[i], "--filter=", 9) == 0)
+      options.filter = argv[i] + 9;
+    else if(std::strncmp(argv[i], "--min-time=", 11) == 0)
+      options.minTime = std::atof(argv[i] + 11);
+    else {
+      std::fprintf(stderr, "Usage: %s [--json] [--filter=SUBSTRING] [--min-time=SECONDS]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  Suite suite(options);
+  suite.run<flat::ClampedInt8, int8_t>("flat", "ClampedInt8", "int8_t");
+  suite.run<flat::ClampedInt16, int16_t>("flat", "ClampedInt16", "int16_t");
+  suite.run<flat::ClampedInt32, int32_t>("flat", "ClampedInt32", "int32_t");
+  suite.run<flat::ClampedInt64, int64_t>("flat", "ClampedInt64", "int64_t");
+  suite.run<flat::ClampedUInt8, uint8_t>("flat", "ClampedUInt8", "uint8_t");
+  suite.run<flat::ClampedUInt16, uint16_t>("flat", "ClampedUInt16", "uint16_t");
+  suite.run<flat::ClampedUInt32, uint32_t>("flat", "ClampedUInt32", "uint32_t");
+  suite.run<flat::ClampedUInt64, uint64_t>("flat", "ClampedUInt64", "uint64_t");
+  suite.run<flat::ClampedFloat, float>("flat", "ClampedFloat", "float");
+  suite.run<flat::ClampedDouble, double>("flat", "ClampedDouble", "double");
+  suite.run<ClampedInt8, int8_t>("poly", "ClampedInt8", "int8_t");
+  suite.run<ClampedInt16, int16_t>("poly", "ClampedInt16", "int16_t");
+  suite.run<ClampedInt32, int32_t>("poly", "ClampedInt32", "int32_t");
+  suite.run<ClampedInt64, int64_t>("poly", "ClampedInt64", "int64_t");
+  suite.run<ClampedUInt8, uint8_t>("poly", "ClampedUInt8", "uint8_t");
+  suite.run<ClampedUInt16, uint16_t>("poly", "ClampedUInt16", "uint16_t");
+  suite.run<ClampedUInt32, uint32_t>("poly", "ClampedUInt32", "uint32_t");
+  suite.run<ClampedUInt64, uint64_t>("poly", "ClampedUInt64", "uint64_t");
+  suite.run<ClampedFloat, float>("poly", "ClampedFloat", "float");
+  suite.run<ClampedDouble, double>("poly", "ClampedDouble", "double");
+
+  if(options.json)
+    printJson(suite.results(), argv[0]);
+  else
+    printTable(suite.results());
+
+  return 0;
+}
@@ -0,0 +1,390 @@
+/** \file
+ * Clamped integers safe to modify from many threads at once.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <type_traits>
+
+#include "clamp_kernels.hh"
+
+namespace clamped
+{
+  /**
+   * An integral number with defined lower and upper bounds, whose value may be
+   * read and modified concurrently by any number of threads without a lock.
+   * The value is held in a `std::atomic<NumT>`, and every saturating update is
+   * applied with a compare-and-swap loop: each thread computes the clamped
+   * result from the value it last saw, using the same kernels as the
+   * non-atomic types, and retries only if another thread changed the value in
+   * the meantime. An update which saturates against a bound the value already
+   * holds changes nothing, and under an ordering with no release half
+   * returns without writing at all; under a releasing ordering it still
+   * stores the unchanged value, so that the release is performed.
+   * 
+   * The bounds are fixed at construction, as they cannot be changed together
+   * with the value in one atomic step. As with `BasicClampedNumber`, bounds
+   * which exclude the starting value are stretched to fit it.
+   * 
+   * Every update also reports how it was clamped, as a `ClampReaction`:
+   * `MINIMUM` or `MAXIMUM` if the result saturated at that bound, else
+   * `NONE`.
+   * 
+   * \param NumT the integral type being bounded
+   * \param KernelsT the saturating kernels applied to the value
+   * 
+   * \see AtomicClampedInteger AtomicClampedNaturalNumber
+   */
+  template<typename NumT, typename KernelsT>
+  class BasicAtomicClampedNumber
+  {
+    static_assert(std::is_integral<NumT>::value, "BasicAtomicClampedNumber requires an integral NumT");
+    
+    protected:
+    
+    std::atomic<NumT> _value;
+    const NumT _minValue;
+    const NumT _maxValue;
+    
+    public:
+    
+    /** The reaction to each update, reporting whether it saturated. */
+    using Reaction = ClampReaction;
+    
+    /**
+     * Constructs a new `BasicAtomicClampedNumber` with the specified current,
+     * minimum, and maximum values, stretching the bounds to fit the starting
+     * value where necessary.
+     * 
+     * \param value the starting value of this number
+     * \param min the minimum value for this number
+     * \param max the maximum value for this number
+     */
+    BasicAtomicClampedNumber(const NumT &value, const NumT &min, const NumT &max):
+        _value(value), _minValue((min <= value) ? min : value), _maxValue((max >= value) ? max : value)
+    {}
+    
+    /**
+     * Atomic numbers are neither copyable nor movable, as their value may be
+     * changing underneath any copy.
+     */
+    BasicAtomicClampedNumber(const BasicAtomicClampedNumber &) = delete;
+    
+    /**
+     * Atomic numbers are neither copyable nor movable, as their value may be
+     * changing underneath any copy.
+     */
+    BasicAtomicClampedNumber & operator=(const BasicAtomicClampedNumber &) = delete;
+    
+    public:
+    
+    /**
+     * Returns this number's current value. This never waits on any other
+     * thread.
+     * 
+     * \param order the memory ordering of the read
+     * \return Returns this number's current value.
+     */
+    NumT load(std::memory_order order = std::memory_order_seq_cst) const
+    {
+      return this->_value.load(order);
+    }
+    
+    /**
+     * Returns this number's maximum value.
+     * 
+     * \return Returns this number's maximum value.
+     */
+    const NumT & maxValue() const
+    {
+      return this->_maxValue;
+    }
+    
+    /**
+     * Returns this number's minimum value.
+     * 
+     * \return Returns this number's minimum value.
+     */
+    const NumT & minValue() const
+    {
+      return this->_minValue;
+    }
+    
+    /**
+     * Sets this number's current value, as constrained by its bounds. This
+     * never waits on any other thread.
+     * 
+     * \param newVal the new value for this number
+     * \param order the memory ordering of the write
+     * \return Returns how the new value was clamped.
+     */
+    Reaction store(const NumT &newVal, std::memory_order order = std::memory_order_seq_cst)
+    {
+      NumT clampedVal = newVal;
+      const Reaction reaction = detail::assignClamped(clampedVal, newVal, this->_minValue, this->_maxValue);
+      this->_value.store(clampedVal, order);
+      return detail::observe<NumT>(detail::Operation::ASSIGN, reaction);
+    }
+    
+    /**
+     * Adds the given number to this one, as constrained by this number's
+     * bounds, in one atomic step.
+     * 
+     * \param other the right operand for addition
+     * \param order the memory ordering of the update
+     * \return Returns how the sum was clamped.
+     */
+    Reaction add(const NumT &other, std::memory_order order = std::memory_order_seq_cst)
+    {
+      NumT previous, result;
+      return this->update(detail::Operation::ADD, &KernelsT::add, other, previous, result, order);
+    }
+    
+    /**
+     * Subtracts the given number from this one, as constrained by this
+     * number's bounds, in one atomic step.
+     * 
+     * \param other the right operand for subtraction
+     * \param order the memory ordering of the update
+     * \return Returns how the difference was clamped.
+     */
+    Reaction subtract(const NumT &other, std::memory_order order = std::memory_order_seq_cst)
+    {
+      NumT previous, result;
+      return this->update(detail::Operation::SUBTRACT, &KernelsT::subtract, other, previous, result, order);
+    }
+    
+    /**
+     * Adds the given number to this one, as constrained by this number's
+     * bounds, in one atomic step.
+     * 
+     * \param other the right operand for addition
+     * \param order the memory ordering of the update
+     * \return Returns this number's value immediately before the addition.
+     */
+    NumT fetchAdd(const NumT &other, std::memory_order order = std::memory_order_seq_cst)
+    {
+      NumT previous, result;
+      this->update(detail::Operation::ADD, &KernelsT::add, other, previous, result, order);
+      return previous;
+    }
+    
+    /**
+     * Subtracts the given number from this one, as constrained by this
+     * number's bounds, in one atomic step.
+     * 
+     * \param other the right operand for subtraction
+     * \param order the memory ordering of the update
+     * \return Returns this number's value immediately before the subtraction.
+     */
+    NumT fetchSubtract(const NumT &other, std::memory_order order = std::memory_order_seq_cst)
+    {
+      NumT previous, result;
+      this->update(detail::Operation::SUBTRACT, &KernelsT::subtract, other, previous, result, order);
+      return previous;
+    }
+    
+    /**
+     * Adds the given number to this one, as constrained by this number's
+     * bounds, in one atomic step.
+     * 
+     * \param other the right operand for addition
+     * \return Returns this number's value immediately after the addition.
+     */
+    NumT operator+=(const NumT &other)
+    {
+      NumT previous, result;
+      this->update(detail::Operation::ADD, &KernelsT::add, other, previous, result, std::memory_order_seq_cst);
+      return result;
+    }
+    
+    /**
+     * Subtracts the given number from this one, as constrained by this
+     * number's bounds, in one atomic step.
+     * 
+     * \param other the right operand for subtraction
+     * \return Returns this number's value immediately after the subtraction.
+     */
+    NumT operator-=(const NumT &other)
+    {
+      NumT previous, result;
+      this->update(detail::Operation::SUBTRACT, &KernelsT::subtract, other, previous, result,
+          std::memory_order_seq_cst);
+      return result;
+    }
+    
+    /**
+     * Increments this number by one, within its bounds.
+     * 
+     * \return Returns this number's value post-incrementation.
+     */
+    NumT operator++()
+    {
+      return (*this += NumT(1));
+    }
+    
+    /**
+     * Decrements this number by one, within its bounds.
+     * 
+     * \return Returns this number's value post-decrementation.
+     */
+    NumT operator--()
+    {
+      return (*this -= NumT(1));
+    }
+    
+    /**
+     * Increments this number by one, within its bounds.
+     * 
+     * \return Returns this number's value prior to incrementation.
+     */
+    NumT operator++(int)
+    {
+      return this->fetchAdd(NumT(1));
+    }
+    
+    /**
+     * Decrements this number by one, within its bounds.
+     * 
+     * \return Returns this number's value prior to decrementation.
+     */
+    NumT operator--(int)
+    {
+      return this->fetchSubtract(NumT(1));
+    }
+    
+    /**
+     * Allows the explicit conversion of this number to an instance of `NumT`,
+     * equivalent to `load()`.
+     * 
+     * \return Returns a copy of this number's current value.
+     */
+    explicit operator NumT() const
+    {
+      return this->load();
+    }
+    
+    private:
+    
+    // The strongest ordering a pure load may take on behalf of an update
+    static constexpr std::memory_order loadOrder(std::memory_order order)
+    {
+      return (order == std::memory_order_release) ? std::memory_order_relaxed
+          : (order == std::memory_order_acq_rel) ? std::memory_order_acquire : order;
+    }
+    
+    // Whether an update under the given ordering must perform a release
+    static constexpr bool releases(std::memory_order order)
+    {
+      return order == std::memory_order_release || order == std::memory_order_acq_rel
+          || order == std::memory_order_seq_cst;
+    }
+    
+    // Applies one kernel to the value by compare-and-swap, reporting the
+    // values either side of the update and how its result was clamped
+    Reaction update(detail::Operation op, Reaction (*kernel)(NumT &, const NumT &, const NumT &, const NumT &),
+        const NumT &other, NumT &previous, NumT &result, std::memory_order order)
+    {
+      previous = this->_value.load(loadOrder(order));
+      for(;;) {
+        result = previous;
+        const Reaction reaction = kernel(result, other, this->_minValue, this->_maxValue);
+        
+        // An update which leaves the value as it was (typically one which
+        // saturates at the bound already held) is complete as of the load,
+        // unless it must release, which only a store can do
+        if((result == previous && !releases(order))
+            || this->_value.compare_exchange_weak(previous, result, order, loadOrder(order)))
+          return detail::observe<NumT>(op, reaction);
+      }
+    }
+  };
+  
+  /**
+   * A signed integer with defined lower and upper bounds, safe to read and
+   * modify from many threads at once. Saturation follows the rules of
+   * `ClampedInteger`. This type wraps a builtin signed integral type, and
+   * where `std::atomic<IntT>` is lock-free so is every operation.
+   * 
+   * \param IntT the signed integral type being wrapped
+   * 
+   * \see BasicAtomicClampedNumber AtomicClampedNaturalNumber
+   */
+  template<typename IntT>
+  class AtomicClampedInteger: public BasicAtomicClampedNumber<IntT, detail::IntegerKernels<IntT>>
+  {
+    static_assert(std::is_signed<IntT>::value, "AtomicClampedInteger requires a signed IntT");
+    
+    using Base = BasicAtomicClampedNumber<IntT, detail::IntegerKernels<IntT>>;
+    
+    public:
+    
+    /**
+     * Constructs a new `AtomicClampedInteger` with the given initial value,
+     * which defaults to zero, and bounds equal to the limits of `IntT`.
+     * 
+     * \param value the starting value of this number
+     */
+    AtomicClampedInteger(const IntT &value = 0):
+        Base(value, std::numeric_limits<IntT>::min(), std::numeric_limits<IntT>::max())
+    {}
+    
+    /**
+     * Constructs a new `AtomicClampedInteger` with the specified current,
+     * minimum, and maximum values, stretching the bounds to fit the starting
+     * value where necessary.
+     * 
+     * \param value the starting value of this number
+     * \param min the minimum value for this number
+     * \param max the maximum value for this number
+     */
+    AtomicClampedInteger(const IntT &value, const IntT &min, const IntT &max):
+        Base(value, min, max)
+    {}
+  };
+  
+  /**
+   * An unsigned integer with defined lower and upper bounds, safe to read and
+   * modify from many threads at once. Saturation follows the rules of
+   * `ClampedNaturalNumber`. This type wraps a builtin unsigned integral type,
+   * and where `std::atomic<NatT>` is lock-free so is every operation.
+   * 
+   * \param NatT the unsigned integral type being wrapped
+   * 
+   * \see BasicAtomicClampedNumber AtomicClampedInteger
+   */
+  template<typename NatT>
+  class AtomicClampedNaturalNumber: public BasicAtomicClampedNumber<NatT, detail::NaturalKernels<NatT>>
+  {
+    static_assert(std::is_unsigned<NatT>::value, "AtomicClampedNaturalNumber requires an unsigned NatT");
+    
+    using Base = BasicAtomicClampedNumber<NatT, detail::NaturalKernels<NatT>>;
+    
+    public:
+    
+    /**
+     * Constructs a new `AtomicClampedNaturalNumber` with the given initial
+     * value, which defaults to zero, and bounds equal to the limits of `NatT`.
+     * 
+     * \param value the starting value of this number
+     */
+    AtomicClampedNaturalNumber(const NatT &value = 0):
+        Base(value, std::numeric_limits<NatT>::min(), std::numeric_limits<NatT>::max())
+    {}
+    
+    /**
+     * Constructs a new `AtomicClampedNaturalNumber` with the specified
+     * current, minimum, and maximum values, stretching the bounds to fit the
+     * starting value where necessary.
+     * 
+     * \param value the starting value of this number
+     * \param min the minimum value for this number
+     * \param max the maximum value for this number
+     */
+    AtomicClampedNaturalNumber(const NatT &value, const NatT &min, const NatT &max):
+        Base(value, min, max)
+    {}
+  };
+}
@@ -0,0 +1,1428 @@
+/** \file
+ * The clamping kernels shared by every clamped number family.
+ * 
+ * Each kernel operates on a bare value and its bounds rather than on an
+ * object, so the same saturation rules can back both the polymorphic
+ * `BasicClampedNumber` hierarchy and the non-polymorphic `flat` hierarchy.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// The compiler's checked arithmetic builtins back the fast integral kernels
+// where available, with portable fallbacks elsewhere
+#if !defined(CLAMPED_HAS_OVERFLOW_BUILTINS) && !defined(CLAMPED_NO_OVERFLOW_BUILTINS) \
+    && (defined(__GNUC__) || defined(__clang__))
+#define CLAMPED_HAS_OVERFLOW_BUILTINS
+#endif
+
+// GCC and Clang offer 128-bit integers on 64-bit targets, which hold any
+// product of two 64-bit integers exactly. In strict ISO modes, such as
+// -std=c++20 rather than -std=gnu++20, std::is_integral and
+// std::numeric_limits do not count them as integers, so the kernels built on
+// those traits cannot use them there; the widest kernels then fall back to
+// the checked builtins, and mixed operators needing a wider intermediate
+// than 64 bits are not offered
+#if !defined(CLAMPED_HAS_INT128) && !defined(CLAMPED_NO_INT128) && defined(__SIZEOF_INT128__) \
+    && !defined(__STRICT_ANSI__)
+#define CLAMPED_HAS_INT128
+#endif
+
+// Instrumentation must skip constant evaluation, which the compiler can report
+#if !defined(CLAMPED_HAS_CONSTANT_EVALUATED) && defined(__has_builtin)
+# if __has_builtin(__builtin_is_constant_evaluated)
+#   define CLAMPED_HAS_CONSTANT_EVALUATED
+# endif
+#endif
+
+namespace clamped
+{
+  /**
+   * How the result of an operation on a clamped number was constrained by its
+   * bounds: `MINIMUM` or `MAXIMUM` if the true result lay beyond that bound,
+   * and so saturated at it, else `NONE`. A result exactly equal to a bound
+   * is `NONE`, as it did not need clamping.
+   */
+  enum class ClampReaction: uint8_t
+  {
+    MINIMUM, // Value should clamp to minimum
+    MAXIMUM, // Value should clamp to maximum
+    NONE     // Value can be modified normally
+  };
+  
+  /**
+   * The outcome of a checked operation on a clamped number: its value
+   * afterwards, and how the operation was clamped. This is small and
+   * trivially copyable, so is returned in registers on common ABIs.
+   * 
+   * \param NumT the numeric type of the clamped number
+   */
+  template<typename NumT>
+  struct ClampResult
+  {
+    /** The number's value after the operation. */
+    NumT value;
+    
+    /** How the operation's result was clamped. */
+    ClampReaction reaction;
+    
+    /**
+     * Returns whether the operation saturated at either bound.
+     * 
+     * \return Returns true if the result was clamped, else false.
+     */
+    constexpr bool saturated() const
+    {
+      return this->reaction != ClampReaction::NONE;
+    }
+  };
+  
+  /**
+   * When a fused operation on a clamped number, such as `multiplyAdd()`,
+   * constrains its intermediate results. `EVERY_STEP` clamps after each
+   * operation, exactly as chaining the operators would. `AT_END` evaluates
+   * the whole expression in a wider intermediate type where one exists (twice
+   * the width for integers, 128 bits wide for 64-bit integers where the
+   * compiler offers them, `long double` for floating-point types) and clamps
+   * only the final result; integers with no wider type are instead saturated
+   * at their own limits in between. Types other than the builtin
+   * arithmetic ones are clamped at every step under either policy.
+   */
+  enum class ClampPolicy: uint8_t
+  {
+    EVERY_STEP, // Clamp each intermediate result, as the operators do
+    AT_END      // Clamp once, after evaluating in a wider type
+  };
+  
+  /**
+   * How the fast decimal kernels, enabled by `CLAMPED_FAST_DECIMAL`, resolve
+   * an operation whose unclamped result is not a number, such as the sum of
+   * opposite infinities: `KEEP` leaves the value as it was and reports
+   * `ClampReaction::NONE`, while `MINIMUM` and `MAXIMUM` saturate the value
+   * at that bound and report it. An operand which is itself NaN yields a NaN
+   * result, and so is resolved the same way.
+   */
+  enum class NanPolicy: uint8_t
+  {
+    KEEP,    // Leave the value unchanged
+    MINIMUM, // Saturate at the minimum
+    MAXIMUM  // Saturate at the maximum
+  };
+  
+  /**
+   * How rebounding many clamped numbers at once treats a value lying outside
+   * its new bounds: `STRETCH` widens each bound just enough to admit the
+   * value, exactly as `minValue(newMin)` and `maxValue(newMax)` do, while
+   * `CLAMP` takes the new bounds as given, swapping them if out of order, and
+   * clamps the value into them.
+   */
+  enum class ReboundPolicy: uint8_t
+  {
+    STRETCH, // Stretch the bounds to admit the current value
+    CLAMP    // Clamp the current value into the bounds
+  };
+  
+  namespace detail
+  {
+    // The kernels predate the public enumeration, and keep its old name
+    using ClampReaction = clamped::ClampReaction;
+    
+    // Sets current to newVal, clamped to [min, max]
+    template<typename NumT> constexpr
+    ClampReaction assignClamped(NumT &current, const NumT &newVal, const NumT &min, const NumT &max)
+    {
+      if(newVal < min) {
+        current = min;
+        return ClampReaction::MINIMUM;
+      }
+      else if(newVal > max) {
+        current = max;
+        return ClampReaction::MAXIMUM;
+      }
+      else {
+        current = newVal;
+        return ClampReaction::NONE;
+      }
+    }
+    
+    // Sets min to newMin, stretched so as never to exceed current
+    template<typename NumT> constexpr
+    const NumT & stretchMinimum(const NumT &current, NumT &min, const NumT &newMin)
+    {
+      // The new minimum must be less than or equal to the current value
+      return ((newMin <= current) ? min = newMin : min = current);
+    }
+    
+    // Sets max to newMax, stretched so as never to fall below current
+    template<typename NumT> constexpr
+    const NumT & stretchMaximum(const NumT &current, NumT &max, const NumT &newMax)
+    {
+      // The new maximum must be greater than or equal to the current value
+      return ((newMax >= current) ? max = newMax : max = current);
+    }
+    
+    // Sets min and max to newMin and newMax, either stretching them to admit
+    // current or clamping current into them, using selects alone so that
+    // loops over many numbers vectorize
+    template<ReboundPolicy Policy, typename NumT> constexpr
+    void reboundClamped(NumT &current, NumT &min, NumT &max, const NumT &newMin, const NumT &newMax)
+    {
+      if(Policy == ReboundPolicy::STRETCH) {
+        min = (newMin <= current) ? newMin : current;
+        max = (newMax >= current) ? newMax : current;
+      }
+      else {
+        const NumT lower = (newMin <= newMax) ? newMin : newMax;
+        const NumT upper = (newMin <= newMax) ? newMax : newMin;
+        current = (current < lower) ? lower : (current > upper) ? upper : current;
+        min = lower;
+        max = upper;
+      }
+    }
+    
+    // The numeric type wrapped by a clamped number type
+    template<typename ClampedT>
+    using WrappedType = typename std::decay<decltype(std::declval<const ClampedT &>().value())>::type;
+    
+    // Prevents deduction of NumT from arguments that should merely convert,
+    // such as the int literal in port + 1
+    template<typename NumT>
+    struct NonDeduced
+    {
+      using type = NumT;
+    };
+    
+    // The type in which the polymorphic numbers take a NumT operand: by value
+    // where NumT is trivially copyable and no wider than two pointers, so that
+    // it travels in registers through the virtual call, and by const reference
+    // otherwise, so that a big integer is never copied merely to be read
+    template<typename NumT>
+    using ArgumentType = typename std::conditional<std::is_trivially_copyable<NumT>::value
+        && sizeof(NumT) <= 2 * sizeof(void *), const NumT, const NumT &>::type;
+    
+    // Snaps current to the bound named by a MINIMUM or MAXIMUM reaction
+    template<typename NumT> constexpr
+    ClampReaction saturate(ClampReaction reaction, NumT &current, const NumT &min, const NumT &max)
+    {
+      if(reaction == ClampReaction::MINIMUM)
+        current = min;
+      else if(reaction == ClampReaction::MAXIMUM)
+        current = max;
+      
+      return reaction;
+    }
+    
+    // ################################################### Promotion ################################################## //
+    
+    // The integral type of twice IntT's width and the same signedness, which
+    // holds any product of two IntTs exactly; void for the widest types, of
+    // 64 bits or 128 bits where the compiler offers a 128-bit integer
+    template<typename IntT, std::size_t Size = sizeof(IntT)>
+    struct WiderInteger
+    {
+      using type = void;
+    };
+    
+    template<typename IntT>
+    struct WiderInteger<IntT, 1>
+    {
+      using type = typename std::conditional<std::is_signed<IntT>::value, int16_t, uint16_t>::type;
+    };
+    
+    template<typename IntT>
+    struct WiderInteger<IntT, 2>
+    {
+      using type = typename std::conditional<std::is_signed<IntT>::value, int32_t, uint32_t>::type;
+    };
+    
+    template<typename IntT>
+    struct WiderInteger<IntT, 4>
+    {
+      using type = typename std::conditional<std::is_signed<IntT>::value, int64_t, uint64_t>::type;
+    };
+    
+#   ifdef CLAMPED_HAS_INT128
+    
+    __extension__ typedef __int128 Int128;
+    __extension__ typedef unsigned __int128 UInt128;
+    
+    template<typename IntT>
+    struct WiderInteger<IntT, 8>
+    {
+      using type = typename std::conditional<std::is_signed<IntT>::value, Int128, UInt128>::type;
+    };
+    
+#   endif
+    
+    // The type in which the portable kernels multiply an IntT: its wider
+    // counterpart for the builtin integral types, void for every other type
+    template<typename IntT, typename = void>
+    struct PromotedInteger
+    {
+      using type = void;
+    };
+    
+    template<typename IntT>
+    struct PromotedInteger<IntT, typename std::enable_if<std::is_integral<IntT>::value>::type>
+    {
+      using type = typename WiderInteger<IntT>::type;
+    };
+    
+    // Sets current to current * other, clamped to [min, max], where the
+    // product is formed exactly in WideT rather than bounded by division
+    template<typename IntT, typename WideT> constexpr
+    ClampReaction multiplyWidened(IntT &current, const IntT &other, const IntT &min, const IntT &max)
+    {
+      WideT product = WideT(WideT(current) * WideT(other));
+      const ClampReaction reaction = assignClamped(product, product, WideT(min), WideT(max));
+      current = IntT(product);
+      return reaction;
+    }
+    
+    // ############################################# ClampedNaturalNumber ############################################# //
+    
+    template<typename NatT> constexpr
+    ClampReaction addNatural(NatT &current, const NatT &other, const NatT &, const NatT &max)
+    {
+      // Discard no-effect additions
+      if(other == 0)
+        return ClampReaction::NONE;
+      
+      // Handle remaining cases: other > 0
+      else if(max - current >= other) {
+        current += other;
+        return ClampReaction::NONE;
+      }
+      else {
+        current = max;
+        return ClampReaction::MAXIMUM;
+      }
+    }
+    
+    template<typename NatT> constexpr
+    ClampReaction subtractNatural(NatT &current, const NatT &other, const NatT &min, const NatT &)
+    {
+      // Discard no-effect subtractions
+      if(other == 0)
+        return ClampReaction::NONE;
+      
+      // Handle remaining cases: other > 0
+      else if(current - min >= other) {
+        current -= other;
+        return ClampReaction::NONE;
+      }
+      else {
+        current = min;
+        return ClampReaction::MINIMUM;
+      }
+    }
+    
+    // Integral types with a wider counterpart multiply in it, sparing the
+    // division by which the general kernel below bounds the product
+    template<typename NatT, typename WideT = typename PromotedInteger<NatT>::type> constexpr
+    typename std::enable_if<!std::is_void<WideT>::value, ClampReaction>::type
+    multiplyNatural(NatT &current, const NatT &other, const NatT &min, const NatT &max)
+    {
+      return multiplyWidened<NatT, WideT>(current, other, min, max);
+    }
+    
+    template<typename NatT, typename WideT = typename PromotedInteger<NatT>::type> constexpr
+    typename std::enable_if<std::is_void<WideT>::value, ClampReaction>::type
+    multiplyNatural(NatT &current, const NatT &other, const NatT &min, const NatT &max)
+    {
+      // Multiplication by zero is trivially done, though zero may be out of bounds
+      if(other == 0 || current == 0)
+        return assignClamped(current, NatT(0), min, max);
+      
+      // Handle remaining cases, i.e. where other >= 1: the product cannot shrink
+      else if(max / current >= other) {
+        current *= other;
+        return ClampReaction::NONE;
+      }
+      else {
+        current = max;
+        return ClampReaction::MAXIMUM;
+      }
+    }
+    
+    template<typename NatT> constexpr
+    ClampReaction divideNatural(NatT &current, const NatT &other, const NatT &min, const NatT &max)
+    {
+      // Discard no-effect divisions
+      if(current == 0 || other == 1)
+        return ClampReaction::NONE;
+      
+      // Handle division by zero
+      else if(other == 0) {
+        current = max;
+        return ClampReaction::MAXIMUM;
+      }
+      
+      // Handle division by positive numbers: other > 1, so the quotient cannot grow
+      else
+        return assignClamped(current, NatT(current / other), min, max);
+    }
+    
+    template<typename NatT> constexpr
+    ClampReaction moduloNatural(NatT &current, const NatT &other, const NatT &min, const NatT &max)
+    {
+      // The remainder of division by zero is defined as zero
+      if(other == 0)
+        return assignClamped(current, NatT(0), min, max);
+      else
+        return assignClamped(current, NatT(current % other), min, max);
+    }
+    
+    // ################################################ ClampedInteger ################################################ //
+    
+    // Invariants: other != 0
+    template<typename IntT> constexpr
+    ClampReaction addReactionInteger(const IntT &current, const IntT &other, const IntT &min, const IntT &max)
+    {
+      // Only sums of opposite signs can be formed directly without overflow;
+      // otherwise compare against the (likewise safe) distance to the bound
+      if(other > 0)
+        return ((current <= 0) ? current + other > max : other > max - current)
+            ? ClampReaction::MAXIMUM : ClampReaction::NONE;
+      else
+        return ((current >= 0) ? current + other < min : other < min - current)
+            ? ClampReaction::MINIMUM : ClampReaction::NONE;
+    }
+    
+    // Invariants: other != 0
+    template<typename IntT> constexpr
+    ClampReaction subtractReactionInteger(const IntT &current, const IntT &other, const IntT &min, const IntT &max)
+    {
+      // Only differences of matching signs can be formed directly without
+      // overflow; otherwise compare against the distance to the bound
+      if(other > 0)
+        return ((current >= 0) ? current - other < min : other > current - min)
+            ? ClampReaction::MINIMUM : ClampReaction::NONE;
+      else
+        return ((current < 0) ? current - other > max : other < current - max)
+            ? ClampReaction::MAXIMUM : ClampReaction::NONE;
+    }
+    
+    // Whether a * b > m, found without forming the product
+    // Invariants: a != 0, b != 0
+    template<typename IntT> constexpr
+    bool productAbove(const IntT &a, const IntT &b, const IntT &m)
+    {
+      // m / -1 may itself overflow, so negation is handled on its own
+      if(b == -1)
+        return (a < 0) ? -(a + 1) >= m : -a > m;
+      
+      // Otherwise compare a against floor(m / b), or ceil(m / b) for b < 0
+      const IntT quotient = m / b;
+      const bool inexact = (m % b != 0) && m < 0;
+      if(b > 0)
+        return a > (inexact ? quotient - 1 : quotient);
+      else
+        return a < (inexact ? quotient + 1 : quotient);
+    }
+    
+    // Whether a * b < m, found without forming the product
+    // Invariants: a != 0, b != 0
+    template<typename IntT> constexpr
+    bool productBelow(const IntT &a, const IntT &b, const IntT &m)
+    {
+      // m / -1 may itself overflow, so negation is handled on its own
+      if(b == -1)
+        return (a < 0) ? m > 0 && -(a + 1) < m - 1 : -a < m;
+      
+      // Otherwise compare a against ceil(m / b), or floor(m / b) for b < 0
+      const IntT quotient = m / b;
+      const bool inexact = (m % b != 0) && m > 0;
+      if(b > 0)
+        return a < (inexact ? quotient + 1 : quotient);
+      else
+        return a > (inexact ? quotient - 1 : quotient);
+    }
+    
+    // Invariants: current != 0, other != 0
+    template<typename IntT> constexpr
+    ClampReaction multiplyReactionInteger(const IntT &current, const IntT &other, const IntT &min, const IntT &max)
+    {
+      if(productAbove(current, other, max))
+        return ClampReaction::MAXIMUM;
+      else if(productBelow(current, other, min))
+        return ClampReaction::MINIMUM;
+      else
+        return ClampReaction::NONE;
+    }
+    
+    template<typename IntT> constexpr
+    ClampReaction addInteger(IntT &current, const IntT &other, const IntT &min, const IntT &max)
+    {
+      // Discard no-effect additions
+      if(other == 0)
+        return ClampReaction::NONE;
+      
+      // Handle remaining cases: other != 0
+      else {
+        const ClampReaction reaction = addReactionInteger(current, other, min, max);
+        if(reaction == ClampReaction::NONE)
+          current += other;
+        
+        return saturate(reaction, current, min, max);
+      }
+    }
+    
+    template<typename IntT> constexpr
+    ClampReaction subtractInteger(IntT &current, const IntT &other, const IntT &min, const IntT &max)
+    {
+      // Discard no-effect subtractions
+      if(other == 0)
+        return ClampReaction::NONE;
+      
+      // Handle remaining cases: other != 0
+      else {
+        const ClampReaction reaction = subtractReactionInteger(current, other, min, max);
+        if(reaction == ClampReaction::NONE)
+          current -= other;
+        
+        return saturate(reaction, current, min, max);
+      }
+    }
+    
+    // Integral types with a wider counterpart multiply in it, sparing the
+    // divisions by which the general kernel below bounds the product
+    template<typename IntT, typename WideT = typename PromotedInteger<IntT>::type> constexpr
+    typename std::enable_if<!std::is_void<WideT>::value, ClampReaction>::type
+    multiplyInteger(IntT &current, const IntT &other, const IntT &min, const IntT &max)
+    {
+      return multiplyWidened<IntT, WideT>(current, other, min, max);
+    }
+    
+    template<typename IntT, typename WideT = typename PromotedInteger<IntT>::type> constexpr
+    typename std::enable_if<std::is_void<WideT>::value, ClampReaction>::type
+    multiplyInteger(IntT &current, const IntT &other, const IntT &min, const IntT &max)
+    {
+      // Multiplication by zero is trivially done, though zero may be out of bounds
+      if(current == 0 || other == 0)
+        return assignClamped(current, IntT(0), min, max);
+      
+      // Handle remaining cases, i.e. where |other| >= 1
+      else {
+        const ClampReaction reaction = multiplyReactionInteger(current, other, min, max);
+        if(reaction == ClampReaction::NONE)
+          current *= other;
+        
+        return saturate(reaction, current, min, max);
+      }
+    }
+    
+    template<typename IntT> constexpr
+    ClampReaction divideInteger(IntT &current, const IntT &other, const IntT &min, const IntT &max)
+    {
+      // Discard no-effect divisions
+      if(current == 0 || other == 1)
+        return ClampReaction::NONE;
+      
+      // Handle division by zero
+      else if(other == 0) {
+        if(current > 0) {
+          current = max;
+          return ClampReaction::MAXIMUM;
+        }
+        else {
+          current = min;
+          return ClampReaction::MINIMUM;
+        }
+      }
+      
+      // Division by -1 is negation, which alone among quotients can overflow
+      else if(other == -1)
+        return multiplyInteger(current, other, min, max);
+      
+      // Handle the more meaningful cases: |other| > 1, so the quotient is representable
+      else
+        return assignClamped(current, IntT(current / other), min, max);
+    }
+    
+    template<typename IntT> constexpr
+    ClampReaction moduloInteger(IntT &current, const IntT &other, const IntT &min, const IntT &max)
+    {
+      // The remainder of division by zero is defined as zero, as is that of
+      // division by -1 (which could otherwise overflow)
+      if(other == 0 || other == -1)
+        return assignClamped(current, IntT(0), min, max);
+      else
+        return assignClamped(current, IntT(current % other), min, max);
+    }
+    
+    // ############################################ Builtin integral types ############################################ //
+    
+    // Whether a + b overflows IntT, storing the (wrapped) sum in result
+    template<typename IntT> constexpr
+    bool addOverflows(IntT a, IntT b, IntT &result)
+    {
+#   ifdef CLAMPED_HAS_OVERFLOW_BUILTINS
+      return __builtin_add_overflow(a, b, &result);
+#   else
+      using UIntT = decltype(typename std::make_unsigned<IntT>::type(0) + 0u);
+      result = IntT(UIntT(a) + UIntT(b));
+      return std::is_signed<IntT>::value ? (b < 0) != (result < a) : result < a;
+#   endif
+    }
+    
+    // Whether a - b overflows IntT, storing the (wrapped) difference in result
+    template<typename IntT> constexpr
+    bool subtractOverflows(IntT a, IntT b, IntT &result)
+    {
+#   ifdef CLAMPED_HAS_OVERFLOW_BUILTINS
+      return __builtin_sub_overflow(a, b, &result);
+#   else
+      using UIntT = decltype(typename std::make_unsigned<IntT>::type(0) + 0u);
+      result = IntT(UIntT(a) - UIntT(b));
+      return std::is_signed<IntT>::value ? (b < 0) != (result > a) : result > a;
+#   endif
+    }
+    
+    // Whether a * b overflows IntT, for the widths with a wider counterpart:
+    // the exact product is formed there and compared against IntT's limits
+    template<typename IntT, typename WideT = typename WiderInteger<IntT>::type> constexpr
+    typename std::enable_if<!std::is_void<WideT>::value, bool>::type
+    multiplyOverflowsPortably(IntT a, IntT b, IntT &result)
+    {
+      using UIntT = typename std::make_unsigned<IntT>::type;
+      const WideT product = WideT(WideT(a) * WideT(b));
+      result = IntT(UIntT(product));
+      return product < WideT(std::numeric_limits<IntT>::min()) || product > WideT(std::numeric_limits<IntT>::max());
+    }
+    
+    // Whether a * b overflows IntT, for the widest signed types: the product
+    // is compared against the limits divided by one operand
+    template<typename IntT, typename WideT = typename WiderInteger<IntT>::type> constexpr
+    typename std::enable_if<std::is_void<WideT>::value && std::is_signed<IntT>::value, bool>::type
+    multiplyOverflowsPortably(IntT a, IntT b, IntT &result)
+    {
+      using UIntT = decltype(typename std::make_unsigned<IntT>::type(0) + 0u);
+      result = IntT(UIntT(a) * UIntT(b));
+      return a != 0 && b != 0
+          && (productAbove(a, b, std::numeric_limits<IntT>::max())
+              || productBelow(a, b, std::numeric_limits<IntT>::min()));
+    }
+    
+    // Whether a * b overflows IntT, for the widest unsigned types
+    template<typename IntT, typename WideT = typename WiderInteger<IntT>::type> constexpr
+    typename std::enable_if<std::is_void<WideT>::value && !std::is_signed<IntT>::value, bool>::type
+    multiplyOverflowsPortably(IntT a, IntT b, IntT &result)
+    {
+      using UIntT = decltype(IntT(0) + 0u);
+      result = IntT(UIntT(a) * UIntT(b));
+      return a != 0 && std::numeric_limits<IntT>::max() / a < b;
+    }
+    
+    // Whether a * b overflows IntT, storing the (wrapped) product in result
+    template<typename IntT> constexpr
+    bool multiplyOverflows(IntT a, IntT b, IntT &result)
+    {
+#   ifdef CLAMPED_HAS_OVERFLOW_BUILTINS
+      return __builtin_mul_overflow(a, b, &result);
+#   else
+      return multiplyOverflowsPortably(a, b, result);
+#   endif
+    }
+    
+    // Sets current to result clamped into [min, max], without branching
+    template<typename IntT> constexpr
+    ClampReaction clampResult(IntT &current, IntT result, const IntT &min, const IntT &max)
+    {
+      const bool below = result < min;
+      const bool above = result > max;
+      current = below ? min : above ? max : result;
+      
+      // MINIMUM, MAXIMUM, and NONE are 0, 1, and 2 respectively
+      return ClampReaction(2 - 2 * below - above);
+    }
+    
+    // As clampResult, for a result which may have overflowed IntT toward its
+    // minimum or maximum; the type limit is selected arithmetically so that
+    // the whole clamp stays free of branches
+    template<typename IntT> constexpr
+    ClampReaction clampResult(IntT &current, IntT result, bool overflowed, bool towardMinimum,
+        const IntT &min, const IntT &max)
+    {
+      using UIntT = typename std::make_unsigned<IntT>::type;
+      const IntT limit = IntT(UIntT(std::numeric_limits<IntT>::max()) ^ UIntT(UIntT(0) - UIntT(towardMinimum)));
+      const ClampReaction reaction = clampResult(current, overflowed ? limit : result, min, max);
+      return overflowed ? ClampReaction(!towardMinimum) : reaction;
+    }
+    
+    // Saturating kernels for the builtin integral types, signed or unsigned.
+    // Each produces exactly the value and reaction of the equivalent
+    // portable kernel above, but computes the true result with the compiler's
+    // overflow builtins and clamps it with selects rather than branches.
+    template<typename IntT>
+    struct BuiltinKernels
+    {
+      static_assert(std::is_integral<IntT>::value, "BuiltinKernels requires a builtin integral type");
+      
+      static constexpr ClampReaction add(IntT &current, const IntT &other, const IntT &min, const IntT &max)
+      {
+        IntT result = 0;
+        const bool overflowed = addOverflows(current, other, result);
+        return clampResult(current, result, overflowed, other < 0, min, max);
+      }
+      
+      static constexpr ClampReaction subtract(IntT &current, const IntT &other, const IntT &min, const IntT &max)
+      {
+        IntT result = 0;
+        const bool overflowed = subtractOverflows(current, other, result);
+        return clampResult(current, result, overflowed, !(other < 0), min, max);
+      }
+      
+      static constexpr ClampReaction multiply(IntT &current, const IntT &other, const IntT &min, const IntT &max)
+      {
+        IntT result = 0;
+        const bool overflowed = multiplyOverflows(current, other, result);
+        return clampResult(current, result, overflowed, (current < 0) != (other < 0), min, max);
+      }
+      
+      static constexpr ClampReaction divide(IntT &current, const IntT &other, const IntT &min, const IntT &max)
+      {
+        // Division by zero saturates toward the sign of the dividend
+        if(other == 0) {
+          if(current == 0)
+            return ClampReaction::NONE;
+          
+          const bool negative = current < 0;
+          current = negative ? min : max;
+          return negative ? ClampReaction::MINIMUM : ClampReaction::MAXIMUM;
+        }
+        
+        // Division by -1 is negation, which alone among quotients can overflow
+        IntT result = 0;
+        const bool overflowed = (std::is_signed<IntT>::value && other == IntT(-1))
+            && subtractOverflows(IntT(0), current, result);
+        return clampResult(current, overflowed ? result : IntT(current / other), overflowed, false, min, max);
+      }
+      
+      static constexpr ClampReaction modulo(IntT &current, const IntT &other, const IntT &min, const IntT &max)
+      {
+        // The remainder of division by zero or by -1 is zero
+        const bool trivial = other == 0 || (std::is_signed<IntT>::value && other == IntT(-1));
+        return clampResult(current, trivial ? IntT(0) : IntT(current % other), min, max);
+      }
+    };
+    
+    // ################################################ ClampedDecimal ################################################ //
+    
+    // Invariants: other > 0
+    template<typename FloatT> constexpr
+    ClampReaction addReactionDecimal(const FloatT &current, const FloatT &other, const FloatT &, const FloatT &max)
+    {
+      // Positive max, negative current: the reverse is impossible
+      if(max >= 0 && current < 0)
+        return (current + other <= max) ? ClampReaction::NONE : ClampReaction::MAXIMUM;
+      
+      // Maximum and current have matching signs
+      else
+        return (max - current >= other) ? ClampReaction::NONE : ClampReaction::MAXIMUM;
+    }
+    
+    // Invariants: other > 0
+    template<typename FloatT> constexpr
+    ClampReaction subtractReactionDecimal(const FloatT &current, const FloatT &other, const FloatT &min,
+        const FloatT &)
+    {
+      // Negative minimum, positive current: the reverse is impossible
+      if(min < 0 && current >= 0)
+        return (current - other >= min) ? ClampReaction::NONE : ClampReaction::MINIMUM;
+      
+      // Minimum and current have matching signs
+      else
+        return (current - min >= other) ? ClampReaction::NONE : ClampReaction::MINIMUM;
+    }
+    
+    // Invariants: current != 0, |other| >= 1
+    template<typename FloatT> constexpr
+    ClampReaction multiplyReactionDecimal(const FloatT &current, const FloatT &other,
+        const FloatT &min, const FloatT &max)
+    {
+      if(current > 0) {
+        if(other > 0) {
+          return (max / current >= other) ? ClampReaction::NONE : ClampReaction::MAXIMUM;
+        }
+        else {
+          if(min >= 0)
+            return ClampReaction::MINIMUM;
+          else
+            return (min / other >= current) ? ClampReaction::NONE : ClampReaction::MINIMUM;
+        }
+      }
+      else {
+        if(other > 0) {
+          return (min / current >= other) ? ClampReaction::NONE : ClampReaction::MINIMUM;
+        }
+        else {
+          // The product is positive, so only the maximum may be exceeded
+          if(max <= 0)
+            return ClampReaction::MAXIMUM;
+          else
+            return (max / current <= other) ? ClampReaction::NONE : ClampReaction::MAXIMUM;
+        }
+      }
+    }
+    
+    // Invariants: current != 0, |other| >= 1, other != 1
+    template<typename FloatT> constexpr
+    ClampReaction divideReactionDecimal(const FloatT &current, const FloatT &other,
+        const FloatT &min, const FloatT &max)
+    {
+      if(current > 0) {
+        if(other > 0) {
+          if(min <= 0)
+            return ClampReaction::NONE;
+          else
+            return (current / other >= min) ? ClampReaction::NONE : ClampReaction::MINIMUM;
+        }
+        else {
+          if(min >= 0)
+            return ClampReaction::MINIMUM;
+          else
+            return (current / other >= min) ? ClampReaction::NONE : ClampReaction::MINIMUM;
+        }
+      }
+      else {
+        if(other > 0) {
+          // The quotient is negative but nearer zero, so only the maximum may be exceeded
+          if(max >= 0)
+            return ClampReaction::NONE;
+          else
+            return (current / other <= max) ? ClampReaction::NONE : ClampReaction::MAXIMUM;
+        }
+        else {
+          if(max < 0)
+            return ClampReaction::MAXIMUM;
+          else
+            return (current / other <= max) ? ClampReaction::NONE : ClampReaction::MAXIMUM;
+        }
+      }
+    }
+    
+    template<typename FloatT> constexpr
+    ClampReaction subtractDecimal(FloatT &current, const FloatT &other, const FloatT &min, const FloatT &max);
+    
+    template<typename FloatT> constexpr
+    ClampReaction addDecimal(FloatT &current, const FloatT &other, const FloatT &min, const FloatT &max)
+    {
+      // Discard no-effect additions
+      if(other == 0)
+        return ClampReaction::NONE;
+      
+      // Delegate to subtraction when adding negatives
+      else if(other < 0)
+        return subtractDecimal(current, FloatT(-other), min, max);
+      
+      // Handle remaining cases: other > 0
+      else {
+        // The reaction is found in rounded arithmetic, so a sum it admits may
+        // still round just past a bound, and is clamped once more
+        const ClampReaction reaction = addReactionDecimal(current, other, min, max);
+        if(reaction == ClampReaction::NONE)
+          return assignClamped(current, FloatT(current + other), min, max);
+        
+        return saturate(reaction, current, min, max);
+      }
+    }
+    
+    template<typename FloatT> constexpr
+    ClampReaction subtractDecimal(FloatT &current, const FloatT &other, const FloatT &min, const FloatT &max)
+    {
+      // Discard no-effect subtractions
+      if(other == 0)
+        return ClampReaction::NONE;
+      
+      // Delegate to addition for subtraction of negatives
+      else if(other < 0)
+        return addDecimal(current, FloatT(-other), min, max);
+      
+      // Handle remaining cases: other > 0
+      else {
+        const ClampReaction reaction = subtractReactionDecimal(current, other, min, max);
+        if(reaction == ClampReaction::NONE)
+          return assignClamped(current, FloatT(current - other), min, max);
+        
+        return saturate(reaction, current, min, max);
+      }
+    }
+    
+    template<typename FloatT> constexpr
+    ClampReaction multiplyDecimal(FloatT &current, const FloatT &other, const FloatT &min, const FloatT &max)
+    {
+      // Multiplication by zero is trivially done, though zero may be out of bounds
+      if(current == 0 || other == 0)
+        return assignClamped(current, FloatT(0), min, max);
+      
+      // For |other| < 1 the product cannot grow in magnitude, so it is formed
+      // directly; dividing by the reciprocal instead would lose it wherever
+      // that reciprocal overflows (while avoiding sign/unsigned comparison)
+      else if((other > 0) ? other < 1 : -other < 1)
+        return assignClamped(current, FloatT(current * other), min, max);
+      
+      // Handle remaining cases, i.e. where |other| >= 1
+      else {
+        const ClampReaction reaction = multiplyReactionDecimal(current, other, min, max);
+        if(reaction == ClampReaction::NONE)
+          return assignClamped(current, FloatT(current * other), min, max);
+        
+        return saturate(reaction, current, min, max);
+      }
+    }
+    
+    template<typename FloatT> constexpr
+    ClampReaction divideDecimal(FloatT &current, const FloatT &other, const FloatT &min, const FloatT &max)
+    {
+      // Discard no-effect divisions
+      if(current == 0 || other == 1)
+        return ClampReaction::NONE;
+      
+      // Handle division by zero
+      else if(other == 0) {
+        if(current > 0) {
+          current = max;
+          return ClampReaction::MAXIMUM;
+        }
+        else {
+          current = min;
+          return ClampReaction::MINIMUM;
+        }
+      }
+      
+      // For |other| < 1 the quotient is formed directly, as the reciprocal
+      // of a subnormal other would overflow; a quotient which overflows in
+      // turn clamps to the bound it exceeds (while avoiding sign/unsigned comparison)
+      else if((other > 0) ? other < 1 : -other < 1)
+        return assignClamped(current, FloatT(current / other), min, max);
+      
+      // Handle the more meaningful cases: |other| >= 1
+      else {
+        const ClampReaction reaction = divideReactionDecimal(current, other, min, max);
+        if(reaction == ClampReaction::NONE)
+          return assignClamped(current, FloatT(current / other), min, max);
+        
+        return saturate(reaction, current, min, max);
+      }
+    }
+    
+    // Saturating kernels for float and double which compute each result once
+    // in IEEE-754 arithmetic, then clamp it with selects rather than testing
+    // for overflow beforehand. Infinite results clamp to the bound they
+    // exceed; NaN results are resolved by the given policy. Results may
+    // differ from those of the exact kernels above only within a rounding
+    // of a bound, where those saturate by a rounded test beforehand.
+    template<typename FloatT, NanPolicy Policy>
+    struct FastDecimalKernels
+    {
+      static_assert(std::is_floating_point<FloatT>::value && std::numeric_limits<FloatT>::is_iec559,
+          "FastDecimalKernels requires an IEEE-754 floating-point type");
+      
+      static constexpr ClampReaction add(FloatT &cur, const FloatT &other, const FloatT &min, const FloatT &max)
+      { return settle(cur, cur + other, min, max); }
+      
+      static constexpr ClampReaction subtract(FloatT &cur, const FloatT &other, const FloatT &min, const FloatT &max)
+      { return settle(cur, cur - other, min, max); }
+      
+      static constexpr ClampReaction multiply(FloatT &cur, const FloatT &other, const FloatT &min, const FloatT &max)
+      { return settle(cur, cur * other, min, max); }
+      
+      // Division by zero saturates toward the sign of the dividend, whatever
+      // the sign of the zero, and leaves zero as it was
+      static constexpr ClampReaction divide(FloatT &cur, const FloatT &other, const FloatT &min, const FloatT &max)
+      {
+        const FloatT infinity = std::numeric_limits<FloatT>::infinity();
+        const FloatT byZero = (cur > 0) ? infinity : (cur < 0) ? -infinity : cur;
+        return settle(cur, (other == 0) ? byZero : cur / other, min, max);
+      }
+      
+      // Sets cur to result clamped into [min, max], or to the policy's choice
+      // where result is NaN
+      static constexpr ClampReaction settle(FloatT &cur, FloatT result, const FloatT &min, const FloatT &max)
+      {
+        const bool undefined = result != result;
+        const FloatT fallback = (Policy == NanPolicy::MINIMUM) ? min : (Policy == NanPolicy::MAXIMUM) ? max : cur;
+        const ClampReaction fallbackReaction = (Policy == NanPolicy::MINIMUM) ? ClampReaction::MINIMUM
+            : (Policy == NanPolicy::MAXIMUM) ? ClampReaction::MAXIMUM : ClampReaction::NONE;
+        
+        const ClampReaction reaction = clampResult(cur, undefined ? fallback : result, min, max);
+        return undefined ? fallbackReaction : reaction;
+      }
+    };
+    
+    // ############################################### Kernel selection ############################################### //
+    
+    // The portable kernels of each family, for any type meeting the
+    // requirements of the matching clamped number template
+    template<typename NatT, typename = void>
+    struct NaturalKernels
+    {
+      static constexpr ClampReaction add(NatT &cur, const NatT &other, const NatT &min, const NatT &max)
+      { return addNatural(cur, other, min, max); }
+      
+      static constexpr ClampReaction subtract(NatT &cur, const NatT &other, const NatT &min, const NatT &max)
+      { return subtractNatural(cur, other, min, max); }
+      
+      static constexpr ClampReaction multiply(NatT &cur, const NatT &other, const NatT &min, const NatT &max)
+      { return multiplyNatural(cur, other, min, max); }
+      
+      static constexpr ClampReaction divide(NatT &cur, const NatT &other, const NatT &min, const NatT &max)
+      { return divideNatural(cur, other, min, max); }
+      
+      static constexpr ClampReaction modulo(NatT &cur, const NatT &other, const NatT &min, const NatT &max)
+      { return moduloNatural(cur, other, min, max); }
+    };
+    
+    template<typename IntT, typename = void>
+    struct IntegerKernels
+    {
+      static constexpr ClampReaction add(IntT &cur, const IntT &other, const IntT &min, const IntT &max)
+      { return addInteger(cur, other, min, max); }
+      
+      static constexpr ClampReaction subtract(IntT &cur, const IntT &other, const IntT &min, const IntT &max)
+      { return subtractInteger(cur, other, min, max); }
+      
+      static constexpr ClampReaction multiply(IntT &cur, const IntT &other, const IntT &min, const IntT &max)
+      { return multiplyInteger(cur, other, min, max); }
+      
+      static constexpr ClampReaction divide(IntT &cur, const IntT &other, const IntT &min, const IntT &max)
+      { return divideInteger(cur, other, min, max); }
+      
+      static constexpr ClampReaction modulo(IntT &cur, const IntT &other, const IntT &min, const IntT &max)
+      { return moduloInteger(cur, other, min, max); }
+    };
+    
+    template<typename FloatT>
+    struct ExactDecimalKernels
+    {
+      static constexpr ClampReaction add(FloatT &cur, const FloatT &other, const FloatT &min, const FloatT &max)
+      { return addDecimal(cur, other, min, max); }
+      
+      static constexpr ClampReaction subtract(FloatT &cur, const FloatT &other, const FloatT &min, const FloatT &max)
+      { return subtractDecimal(cur, other, min, max); }
+      
+      static constexpr ClampReaction multiply(FloatT &cur, const FloatT &other, const FloatT &min, const FloatT &max)
+      { return multiplyDecimal(cur, other, min, max); }
+      
+      static constexpr ClampReaction divide(FloatT &cur, const FloatT &other, const FloatT &min, const FloatT &max)
+      { return divideDecimal(cur, other, min, max); }
+    };
+    
+    template<typename FloatT>
+    struct DecimalKernels: ExactDecimalKernels<FloatT>
+    {};
+    
+#   ifdef CLAMPED_FAST_DECIMAL
+    
+    // Under CLAMPED_FAST_DECIMAL, float and double take the fast kernels,
+    // resolving NaN results by CLAMPED_NAN_POLICY
+#     ifndef CLAMPED_NAN_POLICY
+#       define CLAMPED_NAN_POLICY KEEP
+#     endif
+    
+    template<>
+    struct DecimalKernels<float>: FastDecimalKernels<float, NanPolicy::CLAMPED_NAN_POLICY>
+    {};
+    
+    template<>
+    struct DecimalKernels<double>: FastDecimalKernels<double, NanPolicy::CLAMPED_NAN_POLICY>
+    {};
+    
+#   endif
+    
+#   ifndef CLAMPED_NO_BUILTIN_KERNELS
+    
+    // The builtin integral types take the branchless kernels instead
+    template<typename NatT>
+    struct NaturalKernels<NatT, typename std::enable_if<std::is_integral<NatT>::value>::type>:
+        BuiltinKernels<NatT>
+    {};
+    
+    template<typename IntT>
+    struct IntegerKernels<IntT, typename std::enable_if<std::is_integral<IntT>::value>::type>:
+        BuiltinKernels<IntT>
+    {};
+    
+#   endif
+    
+    // Selects the kernel family which matches a builtin numeric type: natural
+    // for unsigned integers, integer for signed integers, decimal for the rest
+    template<typename NumT>
+    using ClampKernels = typename std::conditional<std::is_integral<NumT>::value,
+        typename std::conditional<std::is_signed<NumT>::value, IntegerKernels<NumT>, NaturalKernels<NumT>>::type,
+        DecimalKernels<NumT>>::type;
+    
+    // ################################################ Instrumentation ############################################### //
+    
+    // The operations whose reactions instrumentation tallies
+    enum class Operation: uint8_t
+    {
+      ADD,
+      SUBTRACT,
+      MULTIPLY,
+      DIVIDE,
+      MODULO,
+      MULTIPLY_ADD,
+      MULTIPLY_ADD_DIVIDE,
+      ASSIGN
+    };
+    
+#   ifdef CLAMPED_INSTRUMENTATION
+    
+    // Tallies one reaction of an operation on a NumT; see clamped_stats.hh
+    template<typename NumT>
+    void recordReaction(Operation op, ClampReaction reaction);
+    
+#   endif
+    
+    // Passes on the reaction of an operation on a NumT, first tallying it
+    // when built with CLAMPED_INSTRUMENTATION; otherwise this is a no-op
+    template<typename NumT> constexpr
+    ClampReaction observe(Operation op, ClampReaction reaction)
+    {
+#   ifdef CLAMPED_INSTRUMENTATION
+#     ifdef CLAMPED_HAS_CONSTANT_EVALUATED
+      if(!__builtin_is_constant_evaluated())
+#     endif
+        recordReaction<NumT>(op, reaction);
+#   else
+      (void) op;
+#   endif
+      
+      return reaction;
+    }
+    
+    // ################################################# Fused kernels ################################################ //
+    
+    // The type in which a fused operation on NumT is evaluated before its
+    // one clamp, which holds every intermediate result exactly where possible
+    template<typename NumT, typename = void>
+    struct FusedIntermediate
+    {
+      using type = NumT;
+    };
+    
+    template<typename IntT>
+    struct FusedIntermediate<IntT, typename std::enable_if<std::is_integral<IntT>::value
+        && std::is_integral<typename WiderInteger<IntT>::type>::value>::type>
+    {
+      using type = typename WiderInteger<IntT>::type;
+    };
+    
+    template<typename FloatT>
+    struct FusedIntermediate<FloatT, typename std::enable_if<std::is_floating_point<FloatT>::value>::type>
+    {
+      using type = long double;
+    };
+    
+    // Whether a fused operation on NumT under the given policy clamps only
+    // its final result
+    template<ClampPolicy Policy, typename NumT>
+    using ClampsAtEnd = std::integral_constant<bool,
+        Policy == ClampPolicy::AT_END && std::is_arithmetic<NumT>::value>;
+    
+    // Narrows an intermediate result into [min, max]
+    template<typename NumT, typename WideT> constexpr
+    ClampReaction clampIntermediate(NumT &current, WideT wide, const NumT &min, const NumT &max)
+    {
+      const ClampReaction reaction = clampResult(wide, wide, WideT(min), WideT(max));
+      current = NumT(wide);
+      return reaction;
+    }
+    
+    // Sets current to current * a + b, clamping each step into [min, max]
+    // with the given kernels; returns the reaction of the last step
+    template<ClampPolicy Policy, typename KernelsT, typename NumT> constexpr
+    typename std::enable_if<!ClampsAtEnd<Policy, NumT>::value, ClampReaction>::type
+    multiplyAdd(NumT &current, const NumT &a, const NumT &b, const NumT &min, const NumT &max)
+    {
+      observe<NumT>(Operation::MULTIPLY, KernelsT::multiply(current, a, min, max));
+      return observe<NumT>(Operation::ADD, KernelsT::add(current, b, min, max));
+    }
+    
+    // Sets current to current * a + b, evaluated in the intermediate type and
+    // clamped into [min, max] once
+    template<ClampPolicy Policy, typename KernelsT, typename NumT> constexpr
+    typename std::enable_if<ClampsAtEnd<Policy, NumT>::value, ClampReaction>::type
+    multiplyAdd(NumT &current, const NumT &a, const NumT &b, const NumT &min, const NumT &max)
+    {
+      using WideT = typename FusedIntermediate<NumT>::type;
+      const WideT lowest = std::numeric_limits<WideT>::lowest(), highest = std::numeric_limits<WideT>::max();
+      WideT wide = WideT(current);
+      ClampKernels<WideT>::multiply(wide, WideT(a), lowest, highest);
+      ClampKernels<WideT>::add(wide, WideT(b), lowest, highest);
+      return observe<NumT>(Operation::MULTIPLY_ADD, clampIntermediate(current, wide, min, max));
+    }
+    
+    // Sets current to (current * a + b) / c, clamping each step into
+    // [min, max] with the given kernels; returns the reaction of the last step
+    template<ClampPolicy Policy, typename KernelsT, typename NumT> constexpr
+    typename std::enable_if<!ClampsAtEnd<Policy, NumT>::value, ClampReaction>::type
+    multiplyAddDivide(NumT &current, const NumT &a, const NumT &b, const NumT &c, const NumT &min,
+        const NumT &max)
+    {
+      multiplyAdd<Policy, KernelsT>(current, a, b, min, max);
+      return observe<NumT>(Operation::DIVIDE, KernelsT::divide(current, c, min, max));
+    }
+    
+    // Sets current to (current * a + b) / c, evaluated in the intermediate
+    // type and clamped into [min, max] once; division by zero saturates
+    // toward the sign of the dividend, as the divide kernels do
+    template<ClampPolicy Policy, typename KernelsT, typename NumT> constexpr
+    typename std::enable_if<ClampsAtEnd<Policy, NumT>::value, ClampReaction>::type
+    multiplyAddDivide(NumT &current, const NumT &a, const NumT &b, const NumT &c, const NumT &min,
+        const NumT &max)
+    {
+      using WideT = typename FusedIntermediate<NumT>::type;
+      const WideT lowest = std::numeric_limits<WideT>::lowest(), highest = std::numeric_limits<WideT>::max();
+      WideT wide = WideT(current);
+      ClampKernels<WideT>::multiply(wide, WideT(a), lowest, highest);
+      ClampKernels<WideT>::add(wide, WideT(b), lowest, highest);
+      ClampKernels<WideT>::divide(wide, WideT(c), lowest, highest);
+      return observe<NumT>(Operation::MULTIPLY_ADD_DIVIDE, clampIntermediate(current, wide, min, max));
+    }
+    
+    // ################################################# Mixed kernels ################################################ //
+    
+    // Whether NumT represents every value of OtherT exactly; the numeric
+    // limits are consulted only for arithmetic types
+    template<typename NumT, typename OtherT,
+        bool = std::is_arithmetic<NumT>::value && std::is_arithmetic<OtherT>::value>
+    struct HoldsEvery: std::false_type
+    {};
+    
+    template<typename NumT, typename OtherT>
+    struct HoldsEvery<NumT, OtherT, true>: std::integral_constant<bool,
+        std::numeric_limits<OtherT>::digits <= std::numeric_limits<NumT>::digits
+        && (std::is_integral<OtherT>::value
+            ? std::is_signed<NumT>::value || !std::is_signed<OtherT>::value
+            : std::is_floating_point<NumT>::value
+                && std::numeric_limits<OtherT>::max_exponent <= std::numeric_limits<NumT>::max_exponent
+                && std::numeric_limits<OtherT>::min_exponent >= std::numeric_limits<NumT>::min_exponent)>
+    {};
+    
+    // The type in which a NumT combines with an operand of another arithmetic
+    // type OtherT before its one clamp: NumT itself where it holds every
+    // OtherT; otherwise, where both are integral, OtherT where it holds every
+    // NumT, or else a signed integer wider than both; and long double where
+    // NumT is a decimal. OtherT serves without widening further because its
+    // kernels saturate at its own limits, which lie beyond NumT's, so each
+    // result still clamps into NumT's bounds correctly; this keeps an int64_t
+    // operand usable without 128-bit integers. The type is void where OtherT
+    // is a decimal and NumT is not, as the result would need rounding, and
+    // where no integer is wide enough.
+    template<typename NumT, typename OtherT, typename = void>
+    struct MixedIntermediate
+    {
+      using type = void;
+    };
+    
+    template<typename NumT, typename OtherT>
+    struct MixedIntermediate<NumT, OtherT, typename std::enable_if<std::is_arithmetic<NumT>::value
+        && std::is_arithmetic<OtherT>::value && HoldsEvery<NumT, OtherT>::value>::type>
+    {
+      using type = NumT;
+    };
+    
+    template<typename NumT, typename OtherT>
+    struct MixedIntermediate<NumT, OtherT, typename std::enable_if<std::is_integral<NumT>::value
+        && std::is_integral<OtherT>::value && !HoldsEvery<NumT, OtherT>::value
+        && HoldsEvery<OtherT, NumT>::value>::type>
+    {
+      using type = OtherT;
+    };
+    
+    template<typename NumT, typename OtherT>
+    struct MixedIntermediate<NumT, OtherT, typename std::enable_if<std::is_integral<NumT>::value
+        && std::is_integral<OtherT>::value && !HoldsEvery<NumT, OtherT>::value
+        && !HoldsEvery<OtherT, NumT>::value>::type>
+    {
+      using type = typename WiderInteger<int8_t, (sizeof(NumT) > sizeof(OtherT)) ? sizeof(NumT) : sizeof(OtherT)>::type;
+    };
+    
+    template<typename NumT, typename OtherT>
+    struct MixedIntermediate<NumT, OtherT, typename std::enable_if<std::is_floating_point<NumT>::value
+        && std::is_arithmetic<OtherT>::value && !HoldsEvery<NumT, OtherT>::value>::type>
+    {
+      using type = long double;
+    };
+    
+    // One operation of the kernels given to apply()
+    template<Operation Op>
+    struct MixedStep;
+    
+    template<>
+    struct MixedStep<Operation::ADD>
+    {
+      template<typename KernelsT, typename NumT>
+      static constexpr ClampReaction apply(NumT &cur, const NumT &other, const NumT &min, const NumT &max)
+      { return KernelsT::add(cur, other, min, max); }
+    };
+    
+    template<>
+    struct MixedStep<Operation::SUBTRACT>
+    {
+      template<typename KernelsT, typename NumT>
+      static constexpr ClampReaction apply(NumT &cur, const NumT &other, const NumT &min, const NumT &max)
+      { return KernelsT::subtract(cur, other, min, max); }
+    };
+    
+    template<>
+    struct MixedStep<Operation::MULTIPLY>
+    {
+      template<typename KernelsT, typename NumT>
+      static constexpr ClampReaction apply(NumT &cur, const NumT &other, const NumT &min, const NumT &max)
+      { return KernelsT::multiply(cur, other, min, max); }
+    };
+    
+    template<>
+    struct MixedStep<Operation::DIVIDE>
+    {
+      template<typename KernelsT, typename NumT>
+      static constexpr ClampReaction apply(NumT &cur, const NumT &other, const NumT &min, const NumT &max)
+      { return KernelsT::divide(cur, other, min, max); }
+    };
+    
+    template<>
+    struct MixedStep<Operation::MODULO>
+    {
+      template<typename KernelsT, typename NumT>
+      static constexpr ClampReaction apply(NumT &cur, const NumT &other, const NumT &min, const NumT &max)
+      { return KernelsT::modulo(cur, other, min, max); }
+    };
+    
+    // Sets current to the result of Op on current and an OtherT which NumT
+    // holds exactly, so that the operand converts losslessly and NumT's own
+    // kernels clamp the result
+    template<Operation Op, typename NumT, typename OtherT> constexpr
+    typename std::enable_if<std::is_same<typename MixedIntermediate<NumT, OtherT>::type, NumT>::value,
+        ClampReaction>::type
+    applyMixed(NumT &current, const OtherT &other, const NumT &min, const NumT &max)
+    {
+      return observe<NumT>(Op, MixedStep<Op>::template apply<ClampKernels<NumT>>(current, NumT(other), min, max));
+    }
+    
+    // Sets current to the result of Op on current and an OtherT, evaluated in
+    // their mixed intermediate type, saturating only at its limits, and
+    // clamped into [min, max] once
+    template<Operation Op, typename NumT, typename OtherT> constexpr
+    typename std::enable_if<!std::is_same<typename MixedIntermediate<NumT, OtherT>::type, NumT>::value,
+        ClampReaction>::type
+    applyMixed(NumT &current, const OtherT &other, const NumT &min, const NumT &max)
+    {
+      using WideT = typename MixedIntermediate<NumT, OtherT>::type;
+      const WideT lowest = std::numeric_limits<WideT>::lowest(), highest = std::numeric_limits<WideT>::max();
+      WideT wide = WideT(current);
+      MixedStep<Op>::template apply<ClampKernels<WideT>>(wide, WideT(other), lowest, highest);
+      return observe<NumT>(Op, clampIntermediate(current, wide, min, max));
+    }
+    
+    // Whether an OtherT may be the right operand of the mixed operators on a
+    // ClampedT derived from BaseT<NumT>: any arithmetic type but bool and NumT
+    // itself, which the plain operators take, with a mixed intermediate type.
+    // ClampedT may not be BaseT<NumT> itself, which has no arithmetic, so that
+    // a number of another template, such as ClampedFixed, is not deduced as
+    // its base. The intermediate is sought only once the rest holds, as the
+    // operators are also considered for unrelated templates, such as
+    // std::basic_string.
+    template<template<typename> class BaseT, typename ClampedT, typename NumT, typename OtherT,
+        bool = std::is_base_of<BaseT<NumT>, ClampedT>::value && !std::is_same<BaseT<NumT>, ClampedT>::value
+            && std::is_arithmetic<OtherT>::value && !std::is_same<OtherT, bool>::value
+            && !std::is_same<OtherT, NumT>::value>
+    struct MixesWith: std::false_type
+    {};
+    
+    template<template<typename> class BaseT, typename ClampedT, typename NumT, typename OtherT>
+    struct MixesWith<BaseT, ClampedT, NumT, OtherT, true>:
+        std::integral_constant<bool, !std::is_void<typename MixedIntermediate<NumT, OtherT>::type>::value>
+    {};
+    
+    // As MixesWith, for the remainder, which only integral types have
+    template<template<typename> class BaseT, typename ClampedT, typename NumT, typename OtherT>
+    using MixesIntegrally = std::integral_constant<bool, MixesWith<BaseT, ClampedT, NumT, OtherT>::value
+        && std::is_integral<NumT>::value && std::is_integral<OtherT>::value>;
+    
+    // Whether ClampedT and OtherClampedT both derive from BaseT, ClampedT
+    // strictly so, as for MixesWith
+    template<template<typename> class BaseT, typename ClampedT, typename NumT, typename OtherClampedT,
+        typename OtherT>
+    using ClampedPair = std::integral_constant<bool, std::is_base_of<BaseT<NumT>, ClampedT>::value
+        && !std::is_same<BaseT<NumT>, ClampedT>::value && std::is_base_of<BaseT<OtherT>, OtherClampedT>::value>;
+    
+    // Returns a new number of lhs's type and bounds, holding the result of Op
+    // on value, which is lhs's, and rhs, as computed by applyMixed()
+    template<Operation Op, typename ClampedT, typename NumT, typename OtherT> constexpr
+    ClampedT combineMixed(const ClampedT &lhs, const NumT &value, const OtherT &rhs)
+    {
+      NumT result = value;
+      applyMixed<Op>(result, rhs, lhs.minValue(), lhs.maxValue());
+      return {result, lhs.minValue(), lhs.maxValue()};
+    }
+    
+    // ############################################## Fixed-point kernels ############################################# //
+    
+    // Saturating kernels for Q-format numbers: an IntT holding a value scaled
+    // by 2^FracBits. Sums, differences and remainders are those of the raw
+    // integers; products and quotients are formed exactly in the wider
+    // integer, rescaled toward zero, and clamped once, so that no kernel
+    // touches the floating-point unit and every result is the same on every
+    // processor.
+    template<typename IntT, unsigned FracBits>
+    struct FixedKernels
+    {
+      static_assert(std::is_integral<IntT>::value, "FixedKernels requires a builtin integral type");
+      static_assert(FracBits <= unsigned(std::numeric_limits<IntT>::digits),
+          "FixedKernels requires no more fraction bits than IntT has value bits");
+      
+      using RawKernels = ClampKernels<IntT>;
+      using WideT = typename WiderInteger<IntT>::type;
+      
+      static_assert(std::is_integral<WideT>::value, "FixedKernels requires an integer twice as wide as IntT");
+      
+      // The raw value of one, in the wider type, where it always fits
+      static constexpr WideT scale = WideT(WideT(1) << FracBits);
+      
+      static constexpr ClampReaction add(IntT &cur, const IntT &other, const IntT &min, const IntT &max)
+      { return RawKernels::add(cur, other, min, max); }
+      
+      static constexpr ClampReaction subtract(IntT &cur, const IntT &other, const IntT &min, const IntT &max)
+      { return RawKernels::subtract(cur, other, min, max); }
+      
+      static constexpr ClampReaction multiply(IntT &cur, const IntT &other, const IntT &min, const IntT &max)
+      { return clampIntermediate(cur, WideT(WideT(WideT(cur) * WideT(other)) / scale), min, max); }
+      
+      static constexpr ClampReaction divide(IntT &cur, const IntT &other, const IntT &min, const IntT &max)
+      {
+        // Division by zero saturates toward the sign of the dividend, as for
+        // the integral kernels
+        if(other == 0) {
+          if(cur == 0)
+            return ClampReaction::NONE;
+          
+          const bool negative = cur < 0;
+          cur = negative ? min : max;
+          return negative ? ClampReaction::MINIMUM : ClampReaction::MAXIMUM;
+        }
+        
+        // The scaled dividend is at most 2^FracBits times IntT's limits, and
+        // so fits the wider type, as does the quotient of any divisor
+        return clampIntermediate(cur, WideT(WideT(WideT(cur) * scale) / WideT(other)), min, max);
+      }
+      
+      static constexpr ClampReaction modulo(IntT &cur, const IntT &other, const IntT &min, const IntT &max)
+      { return RawKernels::modulo(cur, other, min, max); }
+    };
+  }
+}
+
+#ifdef CLAMPED_INSTRUMENTATION
+#include "clamped_stats.hh"
+#endif
+
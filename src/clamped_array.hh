@@ -0,0 +1,760 @@
+/** \file
+ * A structure-of-arrays container of clamped numbers.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "clamp_kernels.hh"
+#include "clamped_batch.hh"
+
+namespace clamped
+{
+  /**
+   * How a `ClampedArray` holds the bounds of its elements.
+   */
+  enum class BoundsLayout
+  {
+    SHARED,  ///< One minimum and maximum, shared by every element
+    PER_LANE ///< A minimum and maximum for each element, in their own arrays
+  };
+  
+  namespace detail
+  {
+    // A fixed-size buffer of trivially copyable numbers, aligned to a cache
+    // line so that vector loads never straddle one needlessly
+    template<typename NumT>
+    class AlignedBuffer
+    {
+      static constexpr std::size_t alignment = 64;
+      
+      void *_raw;
+      NumT *_data;
+      std::size_t _size;
+      
+      public:
+      
+      AlignedBuffer():
+          _raw(nullptr), _data(nullptr), _size(0)
+      {}
+      
+      explicit AlignedBuffer(std::size_t size):
+          _raw(size ? ::operator new(size * sizeof(NumT) + alignment) : nullptr),
+          _data(size ? reinterpret_cast<NumT *>((reinterpret_cast<std::uintptr_t>(_raw) + alignment)
+              & ~std::uintptr_t(alignment - 1)) : nullptr),
+          _size(size)
+      {}
+      
+      AlignedBuffer(const AlignedBuffer &other):
+          AlignedBuffer(other._size)
+      {
+        if(this->_size)
+          std::memcpy(this->_data, other._data, this->_size * sizeof(NumT));
+      }
+      
+      AlignedBuffer(AlignedBuffer &&other) noexcept:
+          _raw(other._raw), _data(other._data), _size(other._size)
+      {
+        other._raw = nullptr;
+        other._data = nullptr;
+        other._size = 0;
+      }
+      
+      ~AlignedBuffer()
+      {
+        ::operator delete(this->_raw);
+      }
+      
+      AlignedBuffer & operator=(AlignedBuffer other) noexcept
+      {
+        std::swap(this->_raw, other._raw);
+        std::swap(this->_data, other._data);
+        std::swap(this->_size, other._size);
+        return *this;
+      }
+      
+      NumT * data() { return this->_data; }
+      const NumT * data() const { return this->_data; }
+      std::size_t size() const { return this->_size; }
+    };
+    
+    // Grants the bulk operations of other headers access to the buffers of
+    // a ClampedArray, where they keep its invariants themselves
+    struct ArrayAccess;
+  }
+  
+  /**
+   * A fixed-size array of clamped numbers, stored as a structure of arrays:
+   * the values of every element lie contiguously in one cache-aligned array,
+   * apart from their bounds. Loops which read only values thus touch only
+   * values, and whole-array arithmetic runs through the vectorized kernels
+   * of `clamped::batch`.
+   * 
+   * The bounds are held in one of two layouts, fixed at construction. With
+   * `BoundsLayout::SHARED`, the array stores a single minimum and maximum
+   * which every element obeys. With `BoundsLayout::PER_LANE`, it stores a
+   * minimum and a maximum for each element in two further aligned arrays.
+   * 
+   * Elements are reached through `Element` proxies, which offer the same
+   * accessors and operators as `BasicClampedNumber` and its derivatives and
+   * which saturate exactly as they do.
+   * 
+   * \param NumT the numeric type being bounded, which must be trivially
+   * copyable
+   */
+  template<typename NumT>
+  class ClampedArray
+  {
+    static_assert(std::is_trivially_copyable<NumT>::value, "ClampedArray requires a trivially copyable NumT");
+    
+    using Kernels = detail::ClampKernels<NumT>;
+    
+    friend struct detail::ArrayAccess;
+    
+    detail::AlignedBuffer<NumT> _values;
+    detail::AlignedBuffer<NumT> _minValues;
+    detail::AlignedBuffer<NumT> _maxValues;
+    NumT _sharedMin;
+    NumT _sharedMax;
+    BoundsLayout _layout;
+    
+    public:
+    
+    /**
+     * A reference to one element of a `ClampedArray`, behaving as would a
+     * clamped number holding that element's value and bounds. An `Element`
+     * is valid for as long as the array it refers to.
+     * 
+     * Under `BoundsLayout::SHARED`, setting an element's minimum or maximum
+     * sets that of the whole array, stretched to admit the value of every
+     * element.
+     */
+    class Element
+    {
+      friend class ClampedArray;
+      
+      ClampedArray *_array;
+      std::size_t _index;
+      
+      Element(ClampedArray &array, std::size_t index):
+          _array(&array), _index(index)
+      {}
+      
+      NumT & current() const { return this->_array->_values.data()[this->_index]; }
+      const NumT & lower() const { return this->_array->minValue(this->_index); }
+      const NumT & upper() const { return this->_array->maxValue(this->_index); }
+      
+      public:
+      
+      Element(const Element &) = default;
+      
+      /**
+       * Assignment between elements is disabled, as it could mean either
+       * rebinding this reference or copying the referenced value. Use
+       * `value()` to copy the value.
+       */
+      Element & operator=(const Element &) = delete;
+      
+      /**
+       * Returns this element's current value by const reference.
+       * 
+       * \return Returns this element's current value.
+       */
+      const NumT & value() const
+      {
+        return this->current();
+      }
+      
+      /**
+       * Returns this element's current maximum value by const reference.
+       * 
+       * \return Returns this element's current maximum value.
+       */
+      const NumT & maxValue() const
+      {
+        return this->upper();
+      }
+      
+      /**
+       * Returns this element's current minimum value by const reference.
+       * 
+       * \return Returns this element's current minimum value.
+       */
+      const NumT & minValue() const
+      {
+        return this->lower();
+      }
+      
+      /**
+       * Sets this element's current value, as constrained by its bounds.
+       * 
+       * \param newVal the new value for this element
+       * \return Returns this element's current value after reassignment.
+       */
+      const NumT & value(const NumT &newVal) const
+      {
+        detail::observe<NumT>(detail::Operation::ASSIGN,
+            detail::assignClamped(this->current(), newVal, this->lower(), this->upper()));
+        return this->current();
+      }
+      
+      /**
+       * Sets this element's maximum value to that specified. The new maximum
+       * must still be greater than or equal to the current stored value: if
+       * it is not, it is constrained to the current value.
+       * 
+       * \param newMax the new maximum for this element
+       * \return Returns this element's maximum value after reassignment.
+       */
+      const NumT & maxValue(const NumT &newMax) const
+      {
+        if(this->_array->_layout == BoundsLayout::SHARED)
+          return this->_array->stretchSharedMaximum(newMax);
+        else
+          return detail::stretchMaximum(this->current(), this->_array->_maxValues.data()[this->_index], newMax);
+      }
+      
+      /**
+       * Sets this element's minimum value to that specified. The minimum must
+       * still be less than or equal to the current stored value: if it is
+       * not, it is constrained to the current value.
+       * 
+       * \param newMin the new minimum for this element
+       * \return Returns this element's minimum value after reassignment.
+       */
+      const NumT & minValue(const NumT &newMin) const
+      {
+        if(this->_array->_layout == BoundsLayout::SHARED)
+          return this->_array->stretchSharedMinimum(newMin);
+        else
+          return detail::stretchMinimum(this->current(), this->_array->_minValues.data()[this->_index], newMin);
+      }
+      
+      /**
+       * Sets this element's current value to its minimum.
+       * 
+       * \return Returns this element's current value after modification.
+       */
+      const NumT & minimize() const
+      {
+        return (this->current() = this->lower());
+      }
+      
+      /**
+       * Sets this element's current value to its maximum.
+       * 
+       * \return Returns this element's current value after modification.
+       */
+      const NumT & maximize() const
+      {
+        return (this->current() = this->upper());
+      }
+      
+      /**
+       * Adds the given number to this element, as constrained by its bounds.
+       * 
+       * \param other the right operand for addition
+       * \return Returns this element, allowing chaining of operations.
+       */
+      const Element & operator+=(const NumT &other) const
+      {
+        detail::observe<NumT>(detail::Operation::ADD,
+            Kernels::add(this->current(), other, this->lower(), this->upper()));
+        return *this;
+      }
+      
+      /**
+       * Subtracts the given number from this element, as constrained by its
+       * bounds.
+       * 
+       * \param other the right operand for subtraction
+       * \return Returns this element, allowing chaining of operations.
+       */
+      const Element & operator-=(const NumT &other) const
+      {
+        detail::observe<NumT>(detail::Operation::SUBTRACT,
+            Kernels::subtract(this->current(), other, this->lower(), this->upper()));
+        return *this;
+      }
+      
+      /**
+       * Multiplies this element by the number given, as constrained by its
+       * bounds.
+       * 
+       * \param other the right operand for multiplication
+       * \return Returns this element, allowing chaining of operations.
+       */
+      const Element & operator*=(const NumT &other) const
+      {
+        detail::observe<NumT>(detail::Operation::MULTIPLY,
+            Kernels::multiply(this->current(), other, this->lower(), this->upper()));
+        return *this;
+      }
+      
+      /**
+       * Divides this element by the number given, as constrained by its
+       * bounds. Division by zero yields its maximum or minimum, depending on
+       * the sign of its value prior to division.
+       * 
+       * \param other the right operand for division
+       * \return Returns this element, allowing chaining of operations.
+       */
+      const Element & operator/=(const NumT &other) const
+      {
+        detail::observe<NumT>(detail::Operation::DIVIDE,
+            Kernels::divide(this->current(), other, this->lower(), this->upper()));
+        return *this;
+      }
+      
+      /**
+       * Sets this element's value to the remainder of division by the given
+       * number, within its bounds. Only integral elements have remainders.
+       * 
+       * \param other the value by which to divide this one
+       * \return Returns this element, allowing chaining of operations.
+       */
+      template<typename OtherT = NumT,
+          typename = typename std::enable_if<std::is_integral<OtherT>::value>::type>
+      const Element & operator%=(const NumT &other) const
+      {
+        detail::observe<NumT>(detail::Operation::MODULO,
+            Kernels::modulo(this->current(), other, this->lower(), this->upper()));
+        return *this;
+      }
+      
+      /**
+       * Increments this element by one, within its bounds.
+       * 
+       * \return Returns this element post-incrementation.
+       */
+      const Element & operator++() const
+      {
+        return (*this += 1);
+      }
+      
+      /**
+       * Decrements this element by one, within its bounds.
+       * 
+       * \return Returns this element post-decrementation.
+       */
+      const Element & operator--() const
+      {
+        return (*this -= 1);
+      }
+      
+      /**
+       * Increments this element by one, within its bounds.
+       * 
+       * \return Returns this element's value prior to incrementation.
+       */
+      NumT operator++(int) const
+      {
+        const NumT preIncr = this->current();
+        ++(*this);
+        return preIncr;
+      }
+      
+      /**
+       * Decrements this element by one, within its bounds.
+       * 
+       * \return Returns this element's value prior to decrementation.
+       */
+      NumT operator--(int) const
+      {
+        const NumT preDecr = this->current();
+        --(*this);
+        return preDecr;
+      }
+      
+      /**
+       * Returns whether this element equals the other. The bounds of each
+       * element play no part in equality: only the stored value is
+       * considered.
+       */
+      bool operator==(const Element &other) const { return this->value() == other.value(); }
+      
+      /** Returns whether this element does not equal the other. */
+      bool operator!=(const Element &other) const { return !(*this == other); }
+      
+      /** Returns whether this element is less than the other. */
+      bool operator<(const Element &other) const { return this->value() < other.value(); }
+      
+      /** Returns whether this element is less than or equal to the other. */
+      bool operator<=(const Element &other) const { return !(other < *this); }
+      
+      /** Returns whether this element is greater than the other. */
+      bool operator>(const Element &other) const { return other < *this; }
+      
+      /** Returns whether this element is greater than or equal to the other. */
+      bool operator>=(const Element &other) const { return !(*this < other); }
+      
+      /**
+       * Allows the explicit conversion of this element to an instance of
+       * `NumT`.
+       * 
+       * \return Returns a copy of this element's value.
+       */
+      explicit operator NumT() const
+      {
+        return this->current();
+      }
+    };
+    
+    public:
+    
+    /**
+     * Constructs a new `ClampedArray` of `count` elements, each starting at
+     * the given value and bounded by the given minimum and maximum. As for
+     * `BasicClampedNumber`, the bounds stretch to admit the starting value.
+     * 
+     * \param count the number of elements
+     * \param value the starting value of every element
+     * \param min the starting minimum of every element
+     * \param max the starting maximum of every element
+     * \param layout whether the elements share their bounds or hold their own
+     */
+    ClampedArray(std::size_t count, const NumT &value, const NumT &min, const NumT &max,
+        BoundsLayout layout = BoundsLayout::SHARED):
+        _values(count),
+        _minValues((layout == BoundsLayout::PER_LANE) ? count : 0),
+        _maxValues((layout == BoundsLayout::PER_LANE) ? count : 0),
+        _sharedMin((min <= value) ? min : value),
+        _sharedMax((max >= value) ? max : value),
+        _layout(layout)
+    {
+      for(std::size_t i = 0; i < count; ++i)
+        this->_values.data()[i] = value;
+      for(std::size_t i = 0; i < this->_minValues.size(); ++i) {
+        this->_minValues.data()[i] = this->_sharedMin;
+        this->_maxValues.data()[i] = this->_sharedMax;
+      }
+    }
+    
+    public:
+    
+    /**
+     * Returns the number of elements in this array.
+     * 
+     * \return Returns the number of elements in this array.
+     */
+    std::size_t size() const
+    {
+      return this->_values.size();
+    }
+    
+    /**
+     * Returns how this array holds the bounds of its elements.
+     * 
+     * \return Returns the layout of this array's bounds.
+     */
+    BoundsLayout layout() const
+    {
+      return this->_layout;
+    }
+    
+    /**
+     * Returns a reference to the element at the given index, which must be
+     * less than `size()`.
+     * 
+     * \param index the index of the element
+     * \return Returns a proxy for the element.
+     */
+    Element operator[](std::size_t index)
+    {
+      return Element(*this, index);
+    }
+    
+    /**
+     * Returns the value of the element at the given index.
+     * 
+     * \param index the index of the element
+     * \return Returns the element's current value.
+     */
+    const NumT & value(std::size_t index) const
+    {
+      return this->_values.data()[index];
+    }
+    
+    /**
+     * Returns the minimum of the element at the given index.
+     * 
+     * \param index the index of the element
+     * \return Returns the element's current minimum value.
+     */
+    const NumT & minValue(std::size_t index) const
+    {
+      return (this->_layout == BoundsLayout::SHARED) ? this->_sharedMin : this->_minValues.data()[index];
+    }
+    
+    /**
+     * Returns the maximum of the element at the given index.
+     * 
+     * \param index the index of the element
+     * \return Returns the element's current maximum value.
+     */
+    const NumT & maxValue(std::size_t index) const
+    {
+      return (this->_layout == BoundsLayout::SHARED) ? this->_sharedMax : this->_maxValues.data()[index];
+    }
+    
+    /**
+     * Returns the contiguous, cache-aligned array of every element's value.
+     * 
+     * \return Returns a pointer to the first of `size()` values.
+     */
+    const NumT * values() const
+    {
+      return this->_values.data();
+    }
+    
+    /**
+     * Returns the contiguous array of every element's minimum, which exists
+     * only under `BoundsLayout::PER_LANE`.
+     * 
+     * \return Returns a pointer to the first of `size()` minimums, or null
+     * if the bounds are shared.
+     */
+    const NumT * minValues() const
+    {
+      return this->_minValues.data();
+    }
+    
+    /**
+     * Returns the contiguous array of every element's maximum, which exists
+     * only under `BoundsLayout::PER_LANE`.
+     * 
+     * \return Returns a pointer to the first of `size()` maximums, or null
+     * if the bounds are shared.
+     */
+    const NumT * maxValues() const
+    {
+      return this->_maxValues.data();
+    }
+    
+    /**
+     * Compares the value of every element against the given pivot, as
+     * `batch::compare()` does, setting bit `i % 64` of `mask[i / 64]` where
+     * element `i` compares as `cmp` names. The bounds play no part.
+     * 
+     * \param cmp the comparison to test each value with
+     * \param pivot the right operand of every comparison
+     * \param mask the `(size() + 63) / 64` words to write one bit per element into
+     */
+    void compare(batch::Comparison cmp, const NumT &pivot, uint64_t *mask) const
+    {
+      detail::activeBatchTable<NumT>().compare(this->_values.data(), this->size(), cmp, pivot, mask);
+    }
+    
+    /**
+     * Tests whether the value of every element lies within [low, high], as
+     * `batch::maskInRange()` does, into a mask laid out as for `compare()`.
+     * 
+     * \param low the least value in the range
+     * \param high the greatest value in the range
+     * \param mask the `(size() + 63) / 64` words to write one bit per element into
+     */
+    void maskInRange(const NumT &low, const NumT &high, uint64_t *mask) const
+    {
+      detail::activeBatchTable<NumT>().maskWithin(this->_values.data(), this->size(), low, high, mask);
+    }
+    
+    /**
+     * Returns how many elements have values within [low, high].
+     * 
+     * \param low the least value in the range
+     * \param high the greatest value in the range
+     * \return Returns the number of elements within the range.
+     */
+    std::size_t countInRange(const NumT &low, const NumT &high) const
+    {
+      return detail::activeBatchTable<NumT>().countWithin(this->_values.data(), this->size(), low, high);
+    }
+    
+    /**
+     * Returns the index of the first element whose value is not less than
+     * the given key, searching without branches as `batch::lowerBound()`
+     * does. The values must be sorted in ascending order.
+     * 
+     * \param key the value to search for
+     * \return Returns the index at which `key` would be inserted first, or
+     * `size()` where every value is less.
+     */
+    std::size_t lowerBound(const NumT &key) const
+    {
+      return batch::lowerBound(this->_values.data(), this->size(), key);
+    }
+    
+    /**
+     * Adds the given number to every element, as constrained by their
+     * bounds.
+     * 
+     * \param other the right operand for addition
+     * \return Returns this array, allowing chaining of operations.
+     */
+    ClampedArray & operator+=(const NumT &other)
+    {
+      const detail::BatchTable<NumT> &table = detail::activeBatchTable<NumT>();
+      if(this->_layout == BoundsLayout::SHARED)
+        table.add(this->_values.data(), this->size(), other, this->_sharedMin, this->_sharedMax);
+      else
+        table.addLanes(this->_values.data(), this->size(), other, this->_minValues.data(), this->_maxValues.data());
+      return *this;
+    }
+    
+    /**
+     * Subtracts the given number from every element, as constrained by their
+     * bounds.
+     * 
+     * \param other the right operand for subtraction
+     * \return Returns this array, allowing chaining of operations.
+     */
+    ClampedArray & operator-=(const NumT &other)
+    {
+      const detail::BatchTable<NumT> &table = detail::activeBatchTable<NumT>();
+      if(this->_layout == BoundsLayout::SHARED)
+        table.subtract(this->_values.data(), this->size(), other, this->_sharedMin, this->_sharedMax);
+      else
+        table.subtractLanes(this->_values.data(), this->size(), other, this->_minValues.data(),
+            this->_maxValues.data());
+      return *this;
+    }
+    
+    /**
+     * Multiplies every element by the number given, as constrained by their
+     * bounds.
+     * 
+     * \param other the right operand for multiplication
+     * \return Returns this array, allowing chaining of operations.
+     */
+    ClampedArray & operator*=(const NumT &other)
+    {
+      const detail::BatchTable<NumT> &table = detail::activeBatchTable<NumT>();
+      if(this->_layout == BoundsLayout::SHARED)
+        table.multiply(this->_values.data(), this->size(), other, this->_sharedMin, this->_sharedMax);
+      else
+        table.multiplyLanes(this->_values.data(), this->size(), other, this->_minValues.data(),
+            this->_maxValues.data());
+      return *this;
+    }
+    
+    /**
+     * Divides every element by the number given, as constrained by their
+     * bounds. Division by zero yields each element's maximum or minimum,
+     * depending on the sign of its value prior to division.
+     * 
+     * \param other the right operand for division
+     * \return Returns this array, allowing chaining of operations.
+     */
+    ClampedArray & operator/=(const NumT &other)
+    {
+      const detail::BatchTable<NumT> &table = detail::activeBatchTable<NumT>();
+      if(this->_layout == BoundsLayout::SHARED)
+        table.divide(this->_values.data(), this->size(), other, this->_sharedMin, this->_sharedMax);
+      else
+        table.divideLanes(this->_values.data(), this->size(), other, this->_minValues.data(),
+            this->_maxValues.data());
+      return *this;
+    }
+    
+    /**
+     * Sets every element's value to the remainder of division by the given
+     * number, within their bounds. Only integral elements have remainders.
+     * 
+     * \param other the value by which to divide each element
+     * \return Returns this array, allowing chaining of operations.
+     */
+    template<typename OtherT = NumT,
+        typename = typename std::enable_if<std::is_integral<OtherT>::value>::type>
+    ClampedArray & operator%=(const NumT &other)
+    {
+      for(std::size_t i = 0; i < this->size(); ++i)
+        Kernels::modulo(this->_values.data()[i], other, this->minValue(i), this->maxValue(i));
+      return *this;
+    }
+    
+    /**
+     * Sets the value of every element from the given array of `size()`
+     * values, each clamped into its element's bounds.
+     * 
+     * \param newValues the new values, which may be `values()` itself
+     */
+    void assign(const NumT *newValues)
+    {
+      const detail::BatchTable<NumT> &table = detail::activeBatchTable<NumT>();
+      if(this->_layout == BoundsLayout::SHARED)
+        table.set(this->_values.data(), newValues, this->size(), this->_sharedMin, this->_sharedMax);
+      else
+        table.setLanes(this->_values.data(), newValues, this->size(), this->_minValues.data(),
+            this->_maxValues.data());
+    }
+    
+    /**
+     * Sets the bounds of every element at once. Under the default
+     * `ReboundPolicy::STRETCH`, each element's bounds stretch to admit its
+     * value, as setting each through `minValue()` and `maxValue()` would;
+     * shared bounds therefore stretch to admit every value. Under
+     * `ReboundPolicy::CLAMP`, the bounds are taken as given and every value is
+     * instead clamped into them. Either way, the pass over the elements is
+     * free of branches, and vectorizes into packed minimums and maximums.
+     * 
+     * \param newMin the new minimum for every element
+     * \param newMax the new maximum for every element
+     */
+    template<ReboundPolicy Policy = ReboundPolicy::STRETCH>
+    void rebound(const NumT &newMin, const NumT &newMax)
+    {
+      NumT *values = this->_values.data();
+      if(this->_layout == BoundsLayout::PER_LANE) {
+        NumT *mins = this->_minValues.data(), *maxs = this->_maxValues.data();
+        for(std::size_t i = 0; i < this->size(); ++i)
+          detail::reboundClamped<Policy>(values[i], mins[i], maxs[i], newMin, newMax);
+      }
+      else if(Policy == ReboundPolicy::STRETCH) {
+        NumT lowest = newMin, highest = newMax;
+        for(std::size_t i = 0; i < this->size(); ++i) {
+          lowest = (values[i] < lowest) ? values[i] : lowest;
+          highest = (values[i] > highest) ? values[i] : highest;
+        }
+        
+        this->_sharedMin = lowest;
+        this->_sharedMax = highest;
+      }
+      else {
+        this->_sharedMin = (newMin <= newMax) ? newMin : newMax;
+        this->_sharedMax = (newMin <= newMax) ? newMax : newMin;
+        detail::activeBatchTable<NumT>().set(values, values, this->size(), this->_sharedMin, this->_sharedMax);
+      }
+    }
+    
+    private:
+    
+    // Sets the shared minimum, stretched to admit every element's value
+    const NumT & stretchSharedMinimum(const NumT &newMin)
+    {
+      NumT lowest = newMin;
+      for(std::size_t i = 0; i < this->size(); ++i)
+        if(this->_values.data()[i] < lowest)
+          lowest = this->_values.data()[i];
+      
+      return (this->_sharedMin = lowest);
+    }
+    
+    // Sets the shared maximum, stretched to admit every element's value
+    const NumT & stretchSharedMaximum(const NumT &newMax)
+    {
+      NumT highest = newMax;
+      for(std::size_t i = 0; i < this->size(); ++i)
+        if(this->_values.data()[i] > highest)
+          highest = this->_values.data()[i];
+      
+      return (this->_sharedMax = highest);
+    }
+  };
+}
@@ -0,0 +1,9 @@
+// The precompiled batch operations: compiles every instruction set's vector
+// loops and their dispatch once, so that includers need not.
+
+#ifdef CLAMPED_HEADER_ONLY
+#error "clamped_batch.cc is not needed in header-only mode"
+#endif
+
+#include "clamped_batch.hh"
+#include "clamped_batch.inl"
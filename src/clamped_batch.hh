@@ -0,0 +1,562 @@
+/** \file
+ * Batch clamping over contiguous buffers of raw numbers.
+ * 
+ * The functions in `clamped::batch` apply one operation to every element of a
+ * buffer that shares a single pair of bounds. For each element they produce
+ * exactly the value that the matching `ClampedInteger` (or
+ * `ClampedNaturalNumber`, or `ClampedDecimal`) operator would, but process
+ * many elements per instruction where the processor allows it.
+ * 
+ * The 8-, 16- and 32-bit integer types are vectorized with SSE4.1, AVX2 or
+ * AVX-512BW on x86 (chosen once at run time from what the processor
+ * supports) and with NEON on ARM. Every other type, and any element left over
+ * at the end of a buffer, goes through the scalar kernels in
+ * `clamp_kernels.hh`. Defining `CLAMPED_NO_SIMD` restricts every type to the
+ * scalar kernels.
+ * 
+ * The same types are searched in bulk, too: `compare()` and `maskInRange()`
+ * test every element at once into a bit mask, `countInRange()` counts the
+ * elements within a range, and `lowerBound()` searches a sorted buffer
+ * without branching on the values it reads.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if __cplusplus > 201703L && defined(__has_include)
+# if __has_include(<span>)
+#include <span>
+# endif
+#endif
+
+#include "clamp_kernels.hh"
+
+#if !defined(CLAMPED_NO_SIMD) && (defined(__x86_64__) || defined(__i386__)) \
+    && (defined(__GNUC__) || defined(__clang__))
+#define CLAMPED_BATCH_X86
+#elif !defined(CLAMPED_NO_SIMD) && defined(__ARM_NEON) && defined(__aarch64__)
+#define CLAMPED_BATCH_NEON
+#endif
+
+// Functions defined in clamped_batch.inl are inline when it is included by
+// every translation unit, and compiled once into the library otherwise
+#ifdef CLAMPED_HEADER_ONLY
+#define CLAMPED_BATCH_INLINE inline
+#else
+#define CLAMPED_BATCH_INLINE
+#endif
+
+namespace clamped
+{
+  namespace batch
+  {
+    /**
+     * The instruction sets a batch operation may be carried out with.
+     */
+    enum class Isa
+    {
+      SCALAR,   ///< One element at a time, through the scalar kernels
+      SSE41,    ///< 128-bit x86 vectors
+      AVX2,     ///< 256-bit x86 vectors
+      AVX512BW, ///< 512-bit x86 vectors
+      NEON      ///< 128-bit ARM vectors
+    };
+    
+    /**
+     * The comparisons `compare()` may test each element against a pivot with.
+     */
+    enum class Comparison
+    {
+      LESS,          ///< Whether the element is less than the pivot
+      LESS_EQUAL,    ///< Whether the element is less than or equal to the pivot
+      EQUAL,         ///< Whether the element equals the pivot
+      NOT_EQUAL,     ///< Whether the element does not equal the pivot
+      GREATER_EQUAL, ///< Whether the element is greater than or equal to the pivot
+      GREATER        ///< Whether the element is greater than the pivot
+    };
+    
+    /**
+     * Returns whether both this build and the running processor support the
+     * given instruction set.
+     * 
+     * \param isa the instruction set to query
+     * \return Returns whether batch operations may use `isa`.
+     */
+    CLAMPED_BATCH_INLINE bool isSupported(Isa isa);
+    
+    /**
+     * Returns the widest instruction set supported by both this build and the
+     * running processor, which every batch operation on a vectorized type
+     * uses. The choice is made once, on first use.
+     * 
+     * \return Returns the instruction set batch operations dispatch to.
+     */
+    CLAMPED_BATCH_INLINE Isa activeIsa();
+  }
+  
+  namespace detail
+  {
+    // The implementations of each batch operation for one element type and
+    // instruction set, for bounds shared by every element or held per element
+    template<typename NumT>
+    struct BatchTable
+    {
+      void (*add)(NumT *, std::size_t, NumT, NumT, NumT);
+      void (*subtract)(NumT *, std::size_t, NumT, NumT, NumT);
+      void (*multiply)(NumT *, std::size_t, NumT, NumT, NumT);
+      void (*divide)(NumT *, std::size_t, NumT, NumT, NumT);
+      void (*set)(NumT *, const NumT *, std::size_t, NumT, NumT);
+      
+      void (*addLanes)(NumT *, std::size_t, NumT, const NumT *, const NumT *);
+      void (*subtractLanes)(NumT *, std::size_t, NumT, const NumT *, const NumT *);
+      void (*multiplyLanes)(NumT *, std::size_t, NumT, const NumT *, const NumT *);
+      void (*divideLanes)(NumT *, std::size_t, NumT, const NumT *, const NumT *);
+      void (*setLanes)(NumT *, const NumT *, std::size_t, const NumT *, const NumT *);
+      
+      void (*compare)(const NumT *, std::size_t, batch::Comparison, NumT, uint64_t *);
+      void (*maskWithin)(const NumT *, std::size_t, NumT, NumT, uint64_t *);
+      std::size_t (*countWithin)(const NumT *, std::size_t, NumT, NumT);
+    };
+    
+    // Sets the bits for the elements from index i on in a mask of 64-bit
+    // words, clearing each word as its first element is reached; bits holds
+    // one bit per element, and never crosses a word
+    inline void setMaskBits(uint64_t *mask, std::size_t i, uint64_t bits)
+    {
+      if(i % 64 == 0)
+        mask[i / 64] = 0;
+      mask[i / 64] |= bits << (i % 64);
+    }
+    
+    // Returns whether value compares to pivot as Cmp names
+    template<batch::Comparison Cmp, typename NumT> constexpr
+    bool satisfies(const NumT &value, const NumT &pivot)
+    {
+      return (Cmp == batch::Comparison::LESS) ? value < pivot
+          : (Cmp == batch::Comparison::LESS_EQUAL) ? value <= pivot
+          : (Cmp == batch::Comparison::EQUAL) ? value == pivot
+          : (Cmp == batch::Comparison::NOT_EQUAL) ? value != pivot
+          : (Cmp == batch::Comparison::GREATER_EQUAL) ? value >= pivot
+          : value > pivot;
+    }
+    
+    // Returns whether value lies within [low, high]; never, for NaN
+    template<typename NumT> constexpr
+    bool within(const NumT &value, const NumT &low, const NumT &high)
+    {
+      return low <= value && value <= high;
+    }
+    
+    // The bounds shared by every element of a batch
+    template<typename NumT>
+    struct SharedBounds
+    {
+      NumT min;
+      NumT max;
+      
+      const NumT & lower(std::size_t) const { return this->min; }
+      const NumT & upper(std::size_t) const { return this->max; }
+      SharedBounds from(std::size_t) const { return *this; }
+    };
+    
+    // The bounds of each element of a batch, held in buffers parallel to it
+    template<typename NumT>
+    struct LaneBounds
+    {
+      const NumT *mins;
+      const NumT *maxs;
+      
+      const NumT & lower(std::size_t i) const { return this->mins[i]; }
+      const NumT & upper(std::size_t i) const { return this->maxs[i]; }
+      LaneBounds from(std::size_t i) const { return {this->mins + i, this->maxs + i}; }
+    };
+    
+    // The scalar implementation of every batch operation
+    template<typename NumT>
+    struct ScalarBatch
+    {
+      template<typename BoundsT>
+      static void addWithin(NumT *values, std::size_t count, NumT other, const BoundsT &bounds)
+      {
+        for(std::size_t i = 0; i < count; ++i)
+          ClampKernels<NumT>::add(values[i], other, bounds.lower(i), bounds.upper(i));
+      }
+      
+      template<typename BoundsT>
+      static void subtractWithin(NumT *values, std::size_t count, NumT other, const BoundsT &bounds)
+      {
+        for(std::size_t i = 0; i < count; ++i)
+          ClampKernels<NumT>::subtract(values[i], other, bounds.lower(i), bounds.upper(i));
+      }
+      
+      template<typename BoundsT>
+      static void multiplyWithin(NumT *values, std::size_t count, NumT other, const BoundsT &bounds)
+      {
+        for(std::size_t i = 0; i < count; ++i)
+          ClampKernels<NumT>::multiply(values[i], other, bounds.lower(i), bounds.upper(i));
+      }
+      
+      template<typename BoundsT>
+      static void divideWithin(NumT *values, std::size_t count, NumT other, const BoundsT &bounds)
+      {
+        for(std::size_t i = 0; i < count; ++i)
+          ClampKernels<NumT>::divide(values[i], other, bounds.lower(i), bounds.upper(i));
+      }
+      
+      template<typename BoundsT>
+      static void setWithin(NumT *values, const NumT *newValues, std::size_t count, const BoundsT &bounds)
+      {
+        for(std::size_t i = 0; i < count; ++i)
+          assignClamped(values[i], newValues[i], bounds.lower(i), bounds.upper(i));
+      }
+      
+      static void add(NumT *values, std::size_t count, NumT other, NumT min, NumT max)
+      { addWithin(values, count, other, SharedBounds<NumT>{min, max}); }
+      
+      static void subtract(NumT *values, std::size_t count, NumT other, NumT min, NumT max)
+      { subtractWithin(values, count, other, SharedBounds<NumT>{min, max}); }
+      
+      static void multiply(NumT *values, std::size_t count, NumT other, NumT min, NumT max)
+      { multiplyWithin(values, count, other, SharedBounds<NumT>{min, max}); }
+      
+      static void divide(NumT *values, std::size_t count, NumT other, NumT min, NumT max)
+      { divideWithin(values, count, other, SharedBounds<NumT>{min, max}); }
+      
+      static void set(NumT *values, const NumT *newValues, std::size_t count, NumT min, NumT max)
+      { setWithin(values, newValues, count, SharedBounds<NumT>{min, max}); }
+      
+      static void addLanes(NumT *values, std::size_t count, NumT other, const NumT *mins, const NumT *maxs)
+      { addWithin(values, count, other, LaneBounds<NumT>{mins, maxs}); }
+      
+      static void subtractLanes(NumT *values, std::size_t count, NumT other, const NumT *mins, const NumT *maxs)
+      { subtractWithin(values, count, other, LaneBounds<NumT>{mins, maxs}); }
+      
+      static void multiplyLanes(NumT *values, std::size_t count, NumT other, const NumT *mins, const NumT *maxs)
+      { multiplyWithin(values, count, other, LaneBounds<NumT>{mins, maxs}); }
+      
+      static void divideLanes(NumT *values, std::size_t count, NumT other, const NumT *mins, const NumT *maxs)
+      { divideWithin(values, count, other, LaneBounds<NumT>{mins, maxs}); }
+      
+      static void setLanes(NumT *values, const NumT *newValues, std::size_t count, const NumT *mins, const NumT *maxs)
+      { setWithin(values, newValues, count, LaneBounds<NumT>{mins, maxs}); }
+      
+      template<batch::Comparison Cmp>
+      static void compareAs(const NumT *values, std::size_t count, NumT pivot, uint64_t *mask)
+      {
+        for(std::size_t i = 0; i < count; ++i)
+          setMaskBits(mask, i, satisfies<Cmp>(values[i], pivot));
+      }
+      
+      static void compare(const NumT *values, std::size_t count, batch::Comparison cmp, NumT pivot, uint64_t *mask)
+      {
+        using Cmp = batch::Comparison;
+        switch(cmp) {
+          case Cmp::LESS:          compareAs<Cmp::LESS>(values, count, pivot, mask); break;
+          case Cmp::LESS_EQUAL:    compareAs<Cmp::LESS_EQUAL>(values, count, pivot, mask); break;
+          case Cmp::EQUAL:         compareAs<Cmp::EQUAL>(values, count, pivot, mask); break;
+          case Cmp::NOT_EQUAL:     compareAs<Cmp::NOT_EQUAL>(values, count, pivot, mask); break;
+          case Cmp::GREATER_EQUAL: compareAs<Cmp::GREATER_EQUAL>(values, count, pivot, mask); break;
+          case Cmp::GREATER:       compareAs<Cmp::GREATER>(values, count, pivot, mask); break;
+        }
+      }
+      
+      static void maskWithin(const NumT *values, std::size_t count, NumT low, NumT high, uint64_t *mask)
+      {
+        for(std::size_t i = 0; i < count; ++i)
+          setMaskBits(mask, i, within(values[i], low, high));
+      }
+      
+      static std::size_t countWithin(const NumT *values, std::size_t count, NumT low, NumT high)
+      {
+        std::size_t inRange = 0;
+        for(std::size_t i = 0; i < count; ++i)
+          inRange += within(values[i], low, high);
+        return inRange;
+      }
+      
+      static constexpr BatchTable<NumT> table = {
+        &add, &subtract, &multiply, &divide, &set,
+        &addLanes, &subtractLanes, &multiplyLanes, &divideLanes, &setLanes,
+        &compare, &maskWithin, &countWithin
+      };
+    };
+    
+    template<typename NumT>
+    constexpr BatchTable<NumT> ScalarBatch<NumT>::table;
+    
+    // Returns the implementations of every batch operation for the given
+    // instruction set, or the scalar ones where it is unsupported
+    template<typename NumT>
+    const BatchTable<NumT> & batchTable(batch::Isa)
+    {
+      return ScalarBatch<NumT>::table;
+    }
+    
+    template<> CLAMPED_BATCH_INLINE const BatchTable<int8_t> & batchTable<int8_t>(batch::Isa isa);
+    template<> CLAMPED_BATCH_INLINE const BatchTable<int16_t> & batchTable<int16_t>(batch::Isa isa);
+    template<> CLAMPED_BATCH_INLINE const BatchTable<int32_t> & batchTable<int32_t>(batch::Isa isa);
+    template<> CLAMPED_BATCH_INLINE const BatchTable<uint8_t> & batchTable<uint8_t>(batch::Isa isa);
+    template<> CLAMPED_BATCH_INLINE const BatchTable<uint16_t> & batchTable<uint16_t>(batch::Isa isa);
+    template<> CLAMPED_BATCH_INLINE const BatchTable<uint32_t> & batchTable<uint32_t>(batch::Isa isa);
+    
+    // Returns the implementations selected for the running processor
+    template<typename NumT>
+    const BatchTable<NumT> & activeBatchTable()
+    {
+      static const BatchTable<NumT> &table = batchTable<NumT>(batch::activeIsa());
+      return table;
+    }
+    
+    // The operand type of the batch functions, which NumT is not deduced from
+    template<typename NumT>
+    using BatchOperand = NonDeduced<NumT>;
+  }
+  
+  namespace batch
+  {
+    /**
+     * Adds the given number to each of `count` values, as constrained by the
+     * given bounds.
+     * 
+     * \param values the buffer of values to modify in place
+     * \param count the number of values in the buffer
+     * \param other the right operand for addition
+     * \param min the minimum value shared by every element
+     * \param max the maximum value shared by every element
+     */
+    template<typename NumT>
+    void add(NumT *values, std::size_t count, const typename detail::BatchOperand<NumT>::type &other,
+        const typename detail::BatchOperand<NumT>::type &min, const typename detail::BatchOperand<NumT>::type &max)
+    {
+      detail::activeBatchTable<NumT>().add(values, count, other, min, max);
+    }
+    
+    /**
+     * Subtracts the given number from each of `count` values, as constrained
+     * by the given bounds.
+     * 
+     * \param values the buffer of values to modify in place
+     * \param count the number of values in the buffer
+     * \param other the right operand for subtraction
+     * \param min the minimum value shared by every element
+     * \param max the maximum value shared by every element
+     */
+    template<typename NumT>
+    void subtract(NumT *values, std::size_t count, const typename detail::BatchOperand<NumT>::type &other,
+        const typename detail::BatchOperand<NumT>::type &min, const typename detail::BatchOperand<NumT>::type &max)
+    {
+      detail::activeBatchTable<NumT>().subtract(values, count, other, min, max);
+    }
+    
+    /**
+     * Multiplies each of `count` values by the given number, as constrained
+     * by the given bounds.
+     * 
+     * \param values the buffer of values to modify in place
+     * \param count the number of values in the buffer
+     * \param other the right operand for multiplication
+     * \param min the minimum value shared by every element
+     * \param max the maximum value shared by every element
+     */
+    template<typename NumT>
+    void multiply(NumT *values, std::size_t count, const typename detail::BatchOperand<NumT>::type &other,
+        const typename detail::BatchOperand<NumT>::type &min, const typename detail::BatchOperand<NumT>::type &max)
+    {
+      detail::activeBatchTable<NumT>().multiply(values, count, other, min, max);
+    }
+    
+    /**
+     * Divides each of `count` values by the given number, as constrained by
+     * the given bounds. Division by zero yields `max` or `min` for each
+     * element, depending on its sign prior to division.
+     * 
+     * \param values the buffer of values to modify in place
+     * \param count the number of values in the buffer
+     * \param other the right operand for division
+     * \param min the minimum value shared by every element
+     * \param max the maximum value shared by every element
+     */
+    template<typename NumT>
+    void divide(NumT *values, std::size_t count, const typename detail::BatchOperand<NumT>::type &other,
+        const typename detail::BatchOperand<NumT>::type &min, const typename detail::BatchOperand<NumT>::type &max)
+    {
+      detail::activeBatchTable<NumT>().divide(values, count, other, min, max);
+    }
+    
+    /**
+     * Sets each of `count` values to the matching new value, clamped into the
+     * given bounds. Unlike `BasicClampedNumber::value()`, the bounds never
+     * stretch. `newValues` may be `values` itself, clamping it in place.
+     * 
+     * \param values the buffer of values to assign
+     * \param newValues the buffer of values to assign from
+     * \param count the number of values in each buffer
+     * \param min the minimum value shared by every element
+     * \param max the maximum value shared by every element
+     */
+    template<typename NumT>
+    void set(NumT *values, const NumT *newValues, std::size_t count,
+        const typename detail::BatchOperand<NumT>::type &min, const typename detail::BatchOperand<NumT>::type &max)
+    {
+      detail::activeBatchTable<NumT>().set(values, newValues, count, min, max);
+    }
+    
+    /**
+     * Compares each of `count` values against the given pivot, setting bit
+     * `i % 64` of `mask[i / 64]` where value `i` compares as `cmp` names and
+     * clearing it elsewhere. `mask` must hold `(count + 63) / 64` words, and
+     * the bits past `count` in its last word are cleared.
+     * 
+     * \param values the buffer of values to compare
+     * \param count the number of values in the buffer
+     * \param cmp the comparison to test each value with
+     * \param pivot the right operand of every comparison
+     * \param mask the words to write one bit per value into
+     */
+    template<typename NumT>
+    void compare(const NumT *values, std::size_t count, Comparison cmp,
+        const typename detail::BatchOperand<NumT>::type &pivot, uint64_t *mask)
+    {
+      detail::activeBatchTable<NumT>().compare(values, count, cmp, pivot, mask);
+    }
+    
+    /**
+     * Tests whether each of `count` values lies within [low, high], setting
+     * or clearing its bit in `mask` as `compare()` does. No value lies within
+     * a range whose `low` exceeds its `high`.
+     * 
+     * \param values the buffer of values to test
+     * \param count the number of values in the buffer
+     * \param low the least value in the range
+     * \param high the greatest value in the range
+     * \param mask the words to write one bit per value into
+     */
+    template<typename NumT>
+    void maskInRange(const NumT *values, std::size_t count, const typename detail::BatchOperand<NumT>::type &low,
+        const typename detail::BatchOperand<NumT>::type &high, uint64_t *mask)
+    {
+      detail::activeBatchTable<NumT>().maskWithin(values, count, low, high, mask);
+    }
+    
+    /**
+     * Returns how many of `count` values lie within [low, high].
+     * 
+     * \param values the buffer of values to test
+     * \param count the number of values in the buffer
+     * \param low the least value in the range
+     * \param high the greatest value in the range
+     * \return Returns the number of values within the range.
+     */
+    template<typename NumT>
+    std::size_t countInRange(const NumT *values, std::size_t count,
+        const typename detail::BatchOperand<NumT>::type &low, const typename detail::BatchOperand<NumT>::type &high)
+    {
+      return detail::activeBatchTable<NumT>().countWithin(values, count, low, high);
+    }
+    
+    /**
+     * Returns the index of the first of `count` values, sorted in ascending
+     * order, which is not less than the given key, or `count` where every
+     * value is less, as `std::lower_bound` would. Each step of the search
+     * halves the range by a conditional move rather than a branch, so the
+     * search takes the same ceil(log2(count)) steps for every key and never
+     * mispredicts; it works for any type, vectorized or not.
+     * 
+     * \param values the sorted buffer of values to search
+     * \param count the number of values in the buffer
+     * \param key the value to search for
+     * \return Returns the index at which `key` would be inserted first.
+     */
+    template<typename NumT>
+    std::size_t lowerBound(const NumT *values, std::size_t count, const typename detail::BatchOperand<NumT>::type &key)
+    {
+      if(count == 0)
+        return 0;
+      
+      const NumT *base = values;
+      for(std::size_t length = count; length > 1; length -= length / 2)
+        base = (base[length / 2] < key) ? base + length / 2 : base;
+      
+      return std::size_t(base - values) + (*base < key);
+    }
+    
+# ifdef __cpp_lib_span
+    /** \overload */
+    template<typename NumT>
+    void add(std::span<NumT> values, const typename detail::BatchOperand<NumT>::type &other,
+        const typename detail::BatchOperand<NumT>::type &min, const typename detail::BatchOperand<NumT>::type &max)
+    {
+      batch::add(values.data(), values.size(), other, min, max);
+    }
+    
+    /** \overload */
+    template<typename NumT>
+    void subtract(std::span<NumT> values, const typename detail::BatchOperand<NumT>::type &other,
+        const typename detail::BatchOperand<NumT>::type &min, const typename detail::BatchOperand<NumT>::type &max)
+    {
+      batch::subtract(values.data(), values.size(), other, min, max);
+    }
+    
+    /** \overload */
+    template<typename NumT>
+    void multiply(std::span<NumT> values, const typename detail::BatchOperand<NumT>::type &other,
+        const typename detail::BatchOperand<NumT>::type &min, const typename detail::BatchOperand<NumT>::type &max)
+    {
+      batch::multiply(values.data(), values.size(), other, min, max);
+    }
+    
+    /** \overload */
+    template<typename NumT>
+    void divide(std::span<NumT> values, const typename detail::BatchOperand<NumT>::type &other,
+        const typename detail::BatchOperand<NumT>::type &min, const typename detail::BatchOperand<NumT>::type &max)
+    {
+      batch::divide(values.data(), values.size(), other, min, max);
+    }
+    
+    /** \overload The two spans must be of equal size. */
+    template<typename NumT>
+    void set(std::span<NumT> values, std::span<const NumT> newValues,
+        const typename detail::BatchOperand<NumT>::type &min, const typename detail::BatchOperand<NumT>::type &max)
+    {
+      batch::set(values.data(), newValues.data(), values.size(), min, max);
+    }
+    
+    /** \overload `mask` must hold `(values.size() + 63) / 64` words. */
+    template<typename NumT>
+    void compare(std::span<NumT> values, Comparison cmp, const typename detail::BatchOperand<NumT>::type &pivot,
+        uint64_t *mask)
+    {
+      batch::compare(values.data(), values.size(), cmp, pivot, mask);
+    }
+    
+    /** \overload `mask` must hold `(values.size() + 63) / 64` words. */
+    template<typename NumT>
+    void maskInRange(std::span<NumT> values, const typename detail::BatchOperand<NumT>::type &low,
+        const typename detail::BatchOperand<NumT>::type &high, uint64_t *mask)
+    {
+      batch::maskInRange(values.data(), values.size(), low, high, mask);
+    }
+    
+    /** \overload */
+    template<typename NumT>
+    std::size_t countInRange(std::span<NumT> values, const typename detail::BatchOperand<NumT>::type &low,
+        const typename detail::BatchOperand<NumT>::type &high)
+    {
+      return batch::countInRange(values.data(), values.size(), low, high);
+    }
+    
+    /** \overload */
+    template<typename NumT>
+    std::size_t lowerBound(std::span<NumT> values, const typename detail::BatchOperand<NumT>::type &key)
+    {
+      return batch::lowerBound(values.data(), values.size(), key);
+    }
+# endif
+  }
+}
+
+#ifdef CLAMPED_HEADER_ONLY
+#include "clamped_batch.inl"
+#endif
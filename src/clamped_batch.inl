@@ -0,0 +1,409 @@
+/** \file
+ * The definitions behind the batch operations in `clamped_batch.hh`.
+ * 
+ * This file is included by `clamped_batch.hh` when `CLAMPED_HEADER_ONLY` is
+ * defined, and is otherwise compiled once into the library by
+ * `clamped_batch.cc`. Each instruction set's vector loops are compiled for
+ * that instruction set alone, so a single binary carries every variant and
+ * picks one at run time.
+ */
+
+#pragma once
+
+#include <limits>
+#include <type_traits>
+
+#include "clamped_batch.hh"
+
+#if defined(CLAMPED_BATCH_X86)
+#include <immintrin.h>
+#elif defined(CLAMPED_BATCH_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace clamped
+{
+  namespace detail
+  {
+    // Returns whether value is below zero, without comparing unsigned types
+    template<typename NumT> constexpr
+    typename std::enable_if<std::is_signed<NumT>::value, bool>::type isNegative(const NumT &value)
+    {
+      return value < 0;
+    }
+    
+    template<typename NumT> constexpr
+    typename std::enable_if<!std::is_signed<NumT>::value, bool>::type isNegative(const NumT &)
+    {
+      return false;
+    }
+    
+    // Returns -value, wrapping the negation of the type minimum to itself
+    template<typename NumT> constexpr
+    NumT wrappingNegate(const NumT &value)
+    {
+      using UNumT = typename std::make_unsigned<NumT>::type;
+      return NumT(UNumT(UNumT(0) - UNumT(value)));
+    }
+    
+    // Whether the vector loops can multiply the element type with saturation
+    template<typename NumT>
+    struct HasVectorMultiply: std::false_type {};
+    
+    template<>
+    struct HasVectorMultiply<int16_t>: std::true_type {};
+    
+    // Gathers the even bits of x into its low half, in order, as for a byte
+    // mask of 16-bit lanes in which each lane sets two bits
+    constexpr uint32_t evenBits(uint32_t x)
+    {
+      x &= 0x55555555u;
+      x = (x | (x >> 1)) & 0x33333333u;
+      x = (x | (x >> 2)) & 0x0f0f0f0fu;
+      x = (x | (x >> 4)) & 0x00ff00ffu;
+      return (x | (x >> 8)) & 0x0000ffffu;
+    }
+    
+# ifdef CLAMPED_BATCH_X86
+    // ################################################# SSE4.1 ################################################# //
+    
+    namespace sse41
+    {
+#     define CLAMPED_BATCH_TARGET __attribute__((target("sse4.1")))
+#     define CLAMPED_BATCH_VECTOR(NUM, BITS, SIGN) \
+      template<> \
+      struct Vector<NUM> \
+      { \
+        using Num = NUM; \
+        using Reg = __m128i; \
+        static constexpr std::size_t lanes = sizeof(Reg) / sizeof(Num); \
+        CLAMPED_BATCH_TARGET static Reg load(const Num *p) { return _mm_loadu_si128((const Reg *) p); } \
+        CLAMPED_BATCH_TARGET static void store(Num *p, Reg x) { _mm_storeu_si128((Reg *) p, x); } \
+        CLAMPED_BATCH_TARGET static Reg broadcast(Num x) { return _mm_set1_epi##BITS(x); } \
+        CLAMPED_BATCH_TARGET static Reg add(Reg a, Reg b) { return _mm_add_epi##BITS(a, b); } \
+        CLAMPED_BATCH_TARGET static Reg min(Reg a, Reg b) { return _mm_min_##SIGN##BITS(a, b); } \
+        CLAMPED_BATCH_TARGET static Reg max(Reg a, Reg b) { return _mm_max_##SIGN##BITS(a, b); } \
+        CLAMPED_BATCH_TARGET static uint64_t equalBits(Reg a, Reg b) \
+        { return laneBits##BITS(_mm_cmpeq_epi##BITS(a, b)); } \
+      };
+      
+      template<typename NumT>
+      struct Vector;
+      
+      // One bit for each lane of a comparison's result, in lane order
+      CLAMPED_BATCH_TARGET inline uint64_t laneBits8(__m128i eq)
+      {
+        return uint32_t(_mm_movemask_epi8(eq));
+      }
+      
+      CLAMPED_BATCH_TARGET inline uint64_t laneBits16(__m128i eq)
+      {
+        return uint32_t(_mm_movemask_epi8(_mm_packs_epi16(eq, _mm_setzero_si128())));
+      }
+      
+      CLAMPED_BATCH_TARGET inline uint64_t laneBits32(__m128i eq)
+      {
+        return uint32_t(_mm_movemask_ps(_mm_castsi128_ps(eq)));
+      }
+      
+      CLAMPED_BATCH_VECTOR(int8_t, 8, epi)
+      CLAMPED_BATCH_VECTOR(int16_t, 16, epi)
+      CLAMPED_BATCH_VECTOR(int32_t, 32, epi)
+      CLAMPED_BATCH_VECTOR(uint8_t, 8, epu)
+      CLAMPED_BATCH_VECTOR(uint16_t, 16, epu)
+      CLAMPED_BATCH_VECTOR(uint32_t, 32, epu)
+      
+      // Forms each exact 32-bit product from its halves, then narrows it with
+      // signed saturation; both steps keep lanes in order
+      CLAMPED_BATCH_TARGET inline __m128i multiplySaturated(__m128i a, __m128i b)
+      {
+        const __m128i lo = _mm_mullo_epi16(a, b), hi = _mm_mulhi_epi16(a, b);
+        return _mm_packs_epi32(_mm_unpacklo_epi16(lo, hi), _mm_unpackhi_epi16(lo, hi));
+      }
+      
+#     include "clamped_batch_loops.inl"
+#     undef CLAMPED_BATCH_VECTOR
+#     undef CLAMPED_BATCH_TARGET
+    }
+    
+    // ################################################## AVX2 ################################################## //
+    
+    namespace avx2
+    {
+#     define CLAMPED_BATCH_TARGET __attribute__((target("avx2")))
+#     define CLAMPED_BATCH_VECTOR(NUM, BITS, SIGN) \
+      template<> \
+      struct Vector<NUM> \
+      { \
+        using Num = NUM; \
+        using Reg = __m256i; \
+        static constexpr std::size_t lanes = sizeof(Reg) / sizeof(Num); \
+        CLAMPED_BATCH_TARGET static Reg load(const Num *p) { return _mm256_loadu_si256((const Reg *) p); } \
+        CLAMPED_BATCH_TARGET static void store(Num *p, Reg x) { _mm256_storeu_si256((Reg *) p, x); } \
+        CLAMPED_BATCH_TARGET static Reg broadcast(Num x) { return _mm256_set1_epi##BITS(x); } \
+        CLAMPED_BATCH_TARGET static Reg add(Reg a, Reg b) { return _mm256_add_epi##BITS(a, b); } \
+        CLAMPED_BATCH_TARGET static Reg min(Reg a, Reg b) { return _mm256_min_##SIGN##BITS(a, b); } \
+        CLAMPED_BATCH_TARGET static Reg max(Reg a, Reg b) { return _mm256_max_##SIGN##BITS(a, b); } \
+        CLAMPED_BATCH_TARGET static uint64_t equalBits(Reg a, Reg b) \
+        { return laneBits##BITS(_mm256_cmpeq_epi##BITS(a, b)); } \
+      };
+      
+      template<typename NumT>
+      struct Vector;
+      
+      // As for SSE4.1; the byte mask of 16-bit lanes has two bits per lane
+      CLAMPED_BATCH_TARGET inline uint64_t laneBits8(__m256i eq)
+      {
+        return uint32_t(_mm256_movemask_epi8(eq));
+      }
+      
+      CLAMPED_BATCH_TARGET inline uint64_t laneBits16(__m256i eq)
+      {
+        return evenBits(uint32_t(_mm256_movemask_epi8(eq)));
+      }
+      
+      CLAMPED_BATCH_TARGET inline uint64_t laneBits32(__m256i eq)
+      {
+        return uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+      }
+      
+      CLAMPED_BATCH_VECTOR(int8_t, 8, epi)
+      CLAMPED_BATCH_VECTOR(int16_t, 16, epi)
+      CLAMPED_BATCH_VECTOR(int32_t, 32, epi)
+      CLAMPED_BATCH_VECTOR(uint8_t, 8, epu)
+      CLAMPED_BATCH_VECTOR(uint16_t, 16, epu)
+      CLAMPED_BATCH_VECTOR(uint32_t, 32, epu)
+      
+      // As for SSE4.1, within each 128-bit half
+      CLAMPED_BATCH_TARGET inline __m256i multiplySaturated(__m256i a, __m256i b)
+      {
+        const __m256i lo = _mm256_mullo_epi16(a, b), hi = _mm256_mulhi_epi16(a, b);
+        return _mm256_packs_epi32(_mm256_unpacklo_epi16(lo, hi), _mm256_unpackhi_epi16(lo, hi));
+      }
+      
+#     include "clamped_batch_loops.inl"
+#     undef CLAMPED_BATCH_VECTOR
+#     undef CLAMPED_BATCH_TARGET
+    }
+    
+    // ################################################ AVX-512BW ############################################### //
+    
+    // GCC 12 warns falsely of the undefined pass-through vectors in its
+    // AVX-512 min/max intrinsics
+#   if defined(__GNUC__) && !defined(__clang__)
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#   endif
+    
+    namespace avx512bw
+    {
+#     define CLAMPED_BATCH_TARGET __attribute__((target("avx512f,avx512bw")))
+#     define CLAMPED_BATCH_VECTOR(NUM, BITS, SIGN) \
+      template<> \
+      struct Vector<NUM> \
+      { \
+        using Num = NUM; \
+        using Reg = __m512i; \
+        static constexpr std::size_t lanes = sizeof(Reg) / sizeof(Num); \
+        CLAMPED_BATCH_TARGET static Reg load(const Num *p) { return _mm512_loadu_si512(p); } \
+        CLAMPED_BATCH_TARGET static void store(Num *p, Reg x) { _mm512_storeu_si512(p, x); } \
+        CLAMPED_BATCH_TARGET static Reg broadcast(Num x) { return _mm512_set1_epi##BITS(x); } \
+        CLAMPED_BATCH_TARGET static Reg add(Reg a, Reg b) { return _mm512_add_epi##BITS(a, b); } \
+        CLAMPED_BATCH_TARGET static Reg min(Reg a, Reg b) { return _mm512_min_##SIGN##BITS(a, b); } \
+        CLAMPED_BATCH_TARGET static Reg max(Reg a, Reg b) { return _mm512_max_##SIGN##BITS(a, b); } \
+        CLAMPED_BATCH_TARGET static uint64_t equalBits(Reg a, Reg b) { return _mm512_cmpeq_epi##BITS##_mask(a, b); } \
+      };
+      
+      template<typename NumT>
+      struct Vector;
+      
+      CLAMPED_BATCH_VECTOR(int8_t, 8, epi)
+      CLAMPED_BATCH_VECTOR(int16_t, 16, epi)
+      CLAMPED_BATCH_VECTOR(int32_t, 32, epi)
+      CLAMPED_BATCH_VECTOR(uint8_t, 8, epu)
+      CLAMPED_BATCH_VECTOR(uint16_t, 16, epu)
+      CLAMPED_BATCH_VECTOR(uint32_t, 32, epu)
+      
+      // As for SSE4.1, within each 128-bit quarter
+      CLAMPED_BATCH_TARGET inline __m512i multiplySaturated(__m512i a, __m512i b)
+      {
+        const __m512i lo = _mm512_mullo_epi16(a, b), hi = _mm512_mulhi_epi16(a, b);
+        return _mm512_packs_epi32(_mm512_unpacklo_epi16(lo, hi), _mm512_unpackhi_epi16(lo, hi));
+      }
+      
+#     include "clamped_batch_loops.inl"
+#     undef CLAMPED_BATCH_VECTOR
+#     undef CLAMPED_BATCH_TARGET
+    }
+    
+#   if defined(__GNUC__) && !defined(__clang__)
+#   pragma GCC diagnostic pop
+#   endif
+# endif
+
+# ifdef CLAMPED_BATCH_NEON
+    // ################################################## NEON ################################################## //
+    
+    namespace neon
+    {
+#     define CLAMPED_BATCH_TARGET
+#     define CLAMPED_BATCH_VECTOR(NUM, REG, SUFFIX) \
+      template<> \
+      struct Vector<NUM> \
+      { \
+        using Num = NUM; \
+        using Reg = REG; \
+        static constexpr std::size_t lanes = sizeof(Reg) / sizeof(Num); \
+        static Reg load(const Num *p) { return vld1q_##SUFFIX(p); } \
+        static void store(Num *p, Reg x) { vst1q_##SUFFIX(p, x); } \
+        static Reg broadcast(Num x) { return vdupq_n_##SUFFIX(x); } \
+        static Reg add(Reg a, Reg b) { return vaddq_##SUFFIX(a, b); } \
+        static Reg min(Reg a, Reg b) { return vminq_##SUFFIX(a, b); } \
+        static Reg max(Reg a, Reg b) { return vmaxq_##SUFFIX(a, b); } \
+        static uint64_t equalBits(Reg a, Reg b) { return laneBits(vceqq_##SUFFIX(a, b)); } \
+      };
+      
+      template<typename NumT>
+      struct Vector;
+      
+      // One bit for each lane of a comparison's result, in lane order, as the
+      // sum of each lane's weight where it is set
+      inline uint64_t laneBits(uint8x16_t eq)
+      {
+        static const uint8_t weights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+        const uint8x16_t bits = vandq_u8(eq, vld1q_u8(weights));
+        return vaddv_u8(vget_low_u8(bits)) | (uint64_t(vaddv_u8(vget_high_u8(bits))) << 8);
+      }
+      
+      inline uint64_t laneBits(uint16x8_t eq)
+      {
+        static const uint16_t weights[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+        return vaddvq_u16(vandq_u16(eq, vld1q_u16(weights)));
+      }
+      
+      inline uint64_t laneBits(uint32x4_t eq)
+      {
+        static const uint32_t weights[4] = {1, 2, 4, 8};
+        return vaddvq_u32(vandq_u32(eq, vld1q_u32(weights)));
+      }
+      
+      CLAMPED_BATCH_VECTOR(int8_t, int8x16_t, s8)
+      CLAMPED_BATCH_VECTOR(int16_t, int16x8_t, s16)
+      CLAMPED_BATCH_VECTOR(int32_t, int32x4_t, s32)
+      CLAMPED_BATCH_VECTOR(uint8_t, uint8x16_t, u8)
+      CLAMPED_BATCH_VECTOR(uint16_t, uint16x8_t, u16)
+      CLAMPED_BATCH_VECTOR(uint32_t, uint32x4_t, u32)
+      
+      // Widens each product to 32 bits, then narrows it with signed saturation
+      inline int16x8_t multiplySaturated(int16x8_t a, int16x8_t b)
+      {
+        const int32x4_t lo = vmull_s16(vget_low_s16(a), vget_low_s16(b)), hi = vmull_high_s16(a, b);
+        return vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi));
+      }
+      
+#     include "clamped_batch_loops.inl"
+#     undef CLAMPED_BATCH_VECTOR
+#     undef CLAMPED_BATCH_TARGET
+    }
+# endif
+    
+    // ################################################ Dispatch ################################################ //
+    
+    // Returns the vectorized implementations for the given instruction set,
+    // falling back to the scalar ones where it is unsupported
+    template<typename NumT>
+    const BatchTable<NumT> & vectorBatchTable(batch::Isa isa)
+    {
+      if(!batch::isSupported(isa))
+        return ScalarBatch<NumT>::table;
+      
+      switch(isa) {
+# ifdef CLAMPED_BATCH_X86
+        case batch::Isa::SSE41:    return sse41::VectorBatch<sse41::Vector<NumT>>::table;
+        case batch::Isa::AVX2:     return avx2::VectorBatch<avx2::Vector<NumT>>::table;
+        case batch::Isa::AVX512BW: return avx512bw::VectorBatch<avx512bw::Vector<NumT>>::table;
+# endif
+# ifdef CLAMPED_BATCH_NEON
+        case batch::Isa::NEON:     return neon::VectorBatch<neon::Vector<NumT>>::table;
+# endif
+        default:                   return ScalarBatch<NumT>::table;
+      }
+    }
+    
+    template<> CLAMPED_BATCH_INLINE
+    const BatchTable<int8_t> & batchTable<int8_t>(batch::Isa isa)
+    {
+      return vectorBatchTable<int8_t>(isa);
+    }
+    
+    template<> CLAMPED_BATCH_INLINE
+    const BatchTable<int16_t> & batchTable<int16_t>(batch::Isa isa)
+    {
+      return vectorBatchTable<int16_t>(isa);
+    }
+    
+    template<> CLAMPED_BATCH_INLINE
+    const BatchTable<int32_t> & batchTable<int32_t>(batch::Isa isa)
+    {
+      return vectorBatchTable<int32_t>(isa);
+    }
+    
+    template<> CLAMPED_BATCH_INLINE
+    const BatchTable<uint8_t> & batchTable<uint8_t>(batch::Isa isa)
+    {
+      return vectorBatchTable<uint8_t>(isa);
+    }
+    
+    template<> CLAMPED_BATCH_INLINE
+    const BatchTable<uint16_t> & batchTable<uint16_t>(batch::Isa isa)
+    {
+      return vectorBatchTable<uint16_t>(isa);
+    }
+    
+    template<> CLAMPED_BATCH_INLINE
+    const BatchTable<uint32_t> & batchTable<uint32_t>(batch::Isa isa)
+    {
+      return vectorBatchTable<uint32_t>(isa);
+    }
+  }
+}
+
+CLAMPED_BATCH_INLINE bool clamped::batch::isSupported(Isa isa)
+{
+  switch(isa) {
+    case Isa::SCALAR:
+      return true;
+      
+# ifdef CLAMPED_BATCH_X86
+    case Isa::SSE41:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("sse4.1");
+    
+    case Isa::AVX2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+    
+    case Isa::AVX512BW:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+# endif
+
+# ifdef CLAMPED_BATCH_NEON
+    case Isa::NEON:
+      return true;
+# endif
+    
+    default:
+      return false;
+  }
+}
+
+CLAMPED_BATCH_INLINE clamped::batch::Isa clamped::batch::activeIsa()
+{
+  static const Isa active = isSupported(Isa::AVX512BW) ? Isa::AVX512BW
+      : isSupported(Isa::AVX2) ? Isa::AVX2
+      : isSupported(Isa::SSE41) ? Isa::SSE41
+      : isSupported(Isa::NEON) ? Isa::NEON
+      : Isa::SCALAR;
+  return active;
+}
@@ -0,0 +1,223 @@
+// The vectorized batch loops, written once for every instruction set. This
+// file is deliberately unguarded: clamped_batch.inl includes it once within
+// each instruction set's namespace, after defining CLAMPED_BATCH_TARGET as the
+// attribute enabling that instruction set and the Vector<NumT> operations for
+// each element type.
+
+// Clamps whole vectors into a batch's bounds, broadcast once when shared...
+template<typename V, typename BoundsT>
+struct VectorBounds
+{
+  typename V::Reg minV;
+  typename V::Reg maxV;
+  
+  CLAMPED_BATCH_TARGET
+  explicit VectorBounds(const SharedBounds<typename V::Num> &bounds):
+      minV(V::broadcast(bounds.min)),
+      maxV(V::broadcast(bounds.max))
+  {}
+  
+  CLAMPED_BATCH_TARGET
+  typename V::Reg clamp(typename V::Reg x, std::size_t) const
+  {
+    return V::min(V::max(x, this->minV), this->maxV);
+  }
+};
+
+// ...or loaded alongside each vector of values when held per element
+template<typename V>
+struct VectorBounds<V, LaneBounds<typename V::Num>>
+{
+  LaneBounds<typename V::Num> bounds;
+  
+  explicit VectorBounds(const LaneBounds<typename V::Num> &bounds):
+      bounds(bounds)
+  {}
+  
+  CLAMPED_BATCH_TARGET
+  typename V::Reg clamp(typename V::Reg x, std::size_t i) const
+  {
+    return V::min(V::max(x, V::load(this->bounds.mins + i)), V::load(this->bounds.maxs + i));
+  }
+};
+
+// Offsets each complete vector of values by step and clamps the result. Each
+// value is first limited against guard, which is chosen so that the offset
+// can saturate at the type's limit but never wrap past it.
+template<typename V, bool GuardBelow, typename BoundsT> CLAMPED_BATCH_TARGET
+std::size_t offsetVectors(typename V::Num *values, std::size_t count, typename V::Num guard,
+    typename V::Num step, const VectorBounds<V, BoundsT> &bounds)
+{
+  const typename V::Reg guardV = V::broadcast(guard), stepV = V::broadcast(step);
+  
+  std::size_t i = 0;
+  for(; i + V::lanes <= count; i += V::lanes) {
+    typename V::Reg x = V::load(values + i);
+    x = GuardBelow ? V::max(x, guardV) : V::min(x, guardV);
+    x = V::add(x, stepV);
+    V::store(values + i, bounds.clamp(x, i));
+  }
+  
+  return i;
+}
+
+// Multiplies values by other using a saturating vector product where one
+// exists for the element type, or the scalar kernels otherwise
+template<typename V, bool = HasVectorMultiply<typename V::Num>::value>
+struct MultiplyVectors
+{
+  template<typename BoundsT>
+  static void multiply(typename V::Num *values, std::size_t count, typename V::Num other, const BoundsT &bounds)
+  {
+    ScalarBatch<typename V::Num>::multiplyWithin(values, count, other, bounds);
+  }
+};
+
+template<typename V>
+struct MultiplyVectors<V, true>
+{
+  template<typename BoundsT> CLAMPED_BATCH_TARGET
+  static void multiply(typename V::Num *values, std::size_t count, typename V::Num other, const BoundsT &bounds)
+  {
+    const VectorBounds<V, BoundsT> vectorBounds(bounds);
+    const typename V::Reg otherV = V::broadcast(other);
+    
+    std::size_t i = 0;
+    for(; i + V::lanes <= count; i += V::lanes)
+      V::store(values + i, vectorBounds.clamp(multiplySaturated(V::load(values + i), otherV), i));
+    
+    ScalarBatch<typename V::Num>::multiplyWithin(values + i, count - i, other, bounds.from(i));
+  }
+};
+
+// Every batch operation on one vector type, finishing each buffer's tail
+// with the scalar kernels
+template<typename V>
+struct VectorBatch
+{
+  using NumT = typename V::Num;
+  using Limits = std::numeric_limits<NumT>;
+  
+  template<typename BoundsT> CLAMPED_BATCH_TARGET
+  static void addWithin(NumT *values, std::size_t count, NumT other, const BoundsT &bounds)
+  {
+    const VectorBounds<V, BoundsT> vectorBounds(bounds);
+    const std::size_t done = isNegative(other)
+        ? offsetVectors<V, true>(values, count, NumT(Limits::min() - other), other, vectorBounds)
+        : offsetVectors<V, false>(values, count, NumT(Limits::max() - other), other, vectorBounds);
+    ScalarBatch<NumT>::addWithin(values + done, count - done, other, bounds.from(done));
+  }
+  
+  template<typename BoundsT> CLAMPED_BATCH_TARGET
+  static void subtractWithin(NumT *values, std::size_t count, NumT other, const BoundsT &bounds)
+  {
+    const VectorBounds<V, BoundsT> vectorBounds(bounds);
+    const std::size_t done = isNegative(other)
+        ? offsetVectors<V, false>(values, count, NumT(Limits::max() + other), wrappingNegate(other), vectorBounds)
+        : offsetVectors<V, true>(values, count, NumT(Limits::min() + other), wrappingNegate(other), vectorBounds);
+    ScalarBatch<NumT>::subtractWithin(values + done, count - done, other, bounds.from(done));
+  }
+  
+  template<typename BoundsT> CLAMPED_BATCH_TARGET
+  static void setWithin(NumT *values, const NumT *newValues, std::size_t count, const BoundsT &bounds)
+  {
+    const VectorBounds<V, BoundsT> vectorBounds(bounds);
+    
+    std::size_t i = 0;
+    for(; i + V::lanes <= count; i += V::lanes)
+      V::store(values + i, vectorBounds.clamp(V::load(newValues + i), i));
+    
+    ScalarBatch<NumT>::setWithin(values + i, newValues + i, count - i, bounds.from(i));
+  }
+  
+  static void add(NumT *values, std::size_t count, NumT other, NumT min, NumT max)
+  { addWithin(values, count, other, SharedBounds<NumT>{min, max}); }
+  
+  static void subtract(NumT *values, std::size_t count, NumT other, NumT min, NumT max)
+  { subtractWithin(values, count, other, SharedBounds<NumT>{min, max}); }
+  
+  static void multiply(NumT *values, std::size_t count, NumT other, NumT min, NumT max)
+  { MultiplyVectors<V>::multiply(values, count, other, SharedBounds<NumT>{min, max}); }
+  
+  static void set(NumT *values, const NumT *newValues, std::size_t count, NumT min, NumT max)
+  { setWithin(values, newValues, count, SharedBounds<NumT>{min, max}); }
+  
+  static void addLanes(NumT *values, std::size_t count, NumT other, const NumT *mins, const NumT *maxs)
+  { addWithin(values, count, other, LaneBounds<NumT>{mins, maxs}); }
+  
+  static void subtractLanes(NumT *values, std::size_t count, NumT other, const NumT *mins, const NumT *maxs)
+  { subtractWithin(values, count, other, LaneBounds<NumT>{mins, maxs}); }
+  
+  static void multiplyLanes(NumT *values, std::size_t count, NumT other, const NumT *mins, const NumT *maxs)
+  { MultiplyVectors<V>::multiply(values, count, other, LaneBounds<NumT>{mins, maxs}); }
+  
+  static void setLanes(NumT *values, const NumT *newValues, std::size_t count, const NumT *mins, const NumT *maxs)
+  { setWithin(values, newValues, count, LaneBounds<NumT>{mins, maxs}); }
+  
+  // Sets one bit of mask per value, for whether it lies within [low, high],
+  // or outside it where Outside holds: clamping a value into the range
+  // leaves it unchanged exactly when it lies within, so low <= high
+  template<bool Outside> CLAMPED_BATCH_TARGET
+  static void maskVectors(const NumT *values, std::size_t count, NumT low, NumT high, uint64_t *mask)
+  {
+    const VectorBounds<V, SharedBounds<NumT>> range(SharedBounds<NumT>{low, high});
+    const uint64_t lanes = ~uint64_t(0) >> (64 - V::lanes);
+    
+    std::size_t i = 0;
+    for(; i + V::lanes <= count; i += V::lanes) {
+      const typename V::Reg x = V::load(values + i);
+      const uint64_t bits = V::equalBits(range.clamp(x, i), x);
+      setMaskBits(mask, i, Outside ? ~bits & lanes : bits);
+    }
+    
+    for(; i < count; ++i)
+      setMaskBits(mask, i, within(values[i], low, high) != Outside);
+  }
+  
+  // Each comparison is a range of the element type, or the outside of one
+  static void compare(const NumT *values, std::size_t count, batch::Comparison cmp, NumT pivot, uint64_t *mask)
+  {
+    using Cmp = batch::Comparison;
+    switch(cmp) {
+      case Cmp::LESS:          maskVectors<true>(values, count, pivot, Limits::max(), mask); break;
+      case Cmp::LESS_EQUAL:    maskVectors<false>(values, count, Limits::min(), pivot, mask); break;
+      case Cmp::EQUAL:         maskVectors<false>(values, count, pivot, pivot, mask); break;
+      case Cmp::NOT_EQUAL:     maskVectors<true>(values, count, pivot, pivot, mask); break;
+      case Cmp::GREATER_EQUAL: maskVectors<false>(values, count, pivot, Limits::max(), mask); break;
+      case Cmp::GREATER:       maskVectors<true>(values, count, Limits::min(), pivot, mask); break;
+    }
+  }
+  
+  static void maskWithin(const NumT *values, std::size_t count, NumT low, NumT high, uint64_t *mask)
+  {
+    if(high < low)
+      ScalarBatch<NumT>::maskWithin(values, count, low, high, mask);
+    else
+      maskVectors<false>(values, count, low, high, mask);
+  }
+  
+  CLAMPED_BATCH_TARGET
+  static std::size_t countWithin(const NumT *values, std::size_t count, NumT low, NumT high)
+  {
+    if(high < low)
+      return 0;
+    
+    const VectorBounds<V, SharedBounds<NumT>> range(SharedBounds<NumT>{low, high});
+    std::size_t inRange = 0, i = 0;
+    for(; i + V::lanes <= count; i += V::lanes) {
+      const typename V::Reg x = V::load(values + i);
+      inRange += std::size_t(__builtin_popcountll(V::equalBits(range.clamp(x, i), x)));
+    }
+    
+    return inRange + ScalarBatch<NumT>::countWithin(values + i, count - i, low, high);
+  }
+  
+  static constexpr BatchTable<NumT> table = {
+    &add, &subtract, &multiply, &ScalarBatch<NumT>::divide, &set,
+    &addLanes, &subtractLanes, &multiplyLanes, &ScalarBatch<NumT>::divideLanes, &setLanes,
+    &compare, &maskWithin, &countWithin
+  };
+};
+
+template<typename V>
+constexpr BatchTable<typename V::Num> VectorBatch<V>::table;
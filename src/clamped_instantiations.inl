@@ -0,0 +1,53 @@
+// The widths precompiled into the library, as explicit instantiations. This
+// file is deliberately unguarded: clamped_numbers.hh includes it with
+// CLAMPED_EXTERN_TEMPLATE defined as `extern` to declare them, and
+// clamped_numbers.cc includes it again with the macro empty to define them.
+
+namespace clamped
+{
+# ifdef CLAMPED_INT8
+  CLAMPED_EXTERN_TEMPLATE template class BasicClampedNumber<int8_t>;
+  CLAMPED_EXTERN_TEMPLATE template class ClampedInteger<int8_t>;
+# endif
+  
+# ifdef CLAMPED_INT16
+  CLAMPED_EXTERN_TEMPLATE template class BasicClampedNumber<int16_t>;
+  CLAMPED_EXTERN_TEMPLATE template class ClampedInteger<int16_t>;
+# endif
+  
+# ifdef CLAMPED_INT32
+  CLAMPED_EXTERN_TEMPLATE template class BasicClampedNumber<int32_t>;
+  CLAMPED_EXTERN_TEMPLATE template class ClampedInteger<int32_t>;
+# endif
+  
+# ifdef CLAMPED_INT64
+  CLAMPED_EXTERN_TEMPLATE template class BasicClampedNumber<int64_t>;
+  CLAMPED_EXTERN_TEMPLATE template class ClampedInteger<int64_t>;
+# endif
+  
+# ifdef CLAMPED_UINT8
+  CLAMPED_EXTERN_TEMPLATE template class BasicClampedNumber<uint8_t>;
+  CLAMPED_EXTERN_TEMPLATE template class ClampedNaturalNumber<uint8_t>;
+# endif
+  
+# ifdef CLAMPED_UINT16
+  CLAMPED_EXTERN_TEMPLATE template class BasicClampedNumber<uint16_t>;
+  CLAMPED_EXTERN_TEMPLATE template class ClampedNaturalNumber<uint16_t>;
+# endif
+  
+# ifdef CLAMPED_UINT32
+  CLAMPED_EXTERN_TEMPLATE template class BasicClampedNumber<uint32_t>;
+  CLAMPED_EXTERN_TEMPLATE template class ClampedNaturalNumber<uint32_t>;
+# endif
+  
+# ifdef CLAMPED_UINT64
+  CLAMPED_EXTERN_TEMPLATE template class BasicClampedNumber<uint64_t>;
+  CLAMPED_EXTERN_TEMPLATE template class ClampedNaturalNumber<uint64_t>;
+# endif
+  
+  CLAMPED_EXTERN_TEMPLATE template class BasicClampedNumber<float>;
+  CLAMPED_EXTERN_TEMPLATE template class ClampedDecimal<float>;
+  
+  CLAMPED_EXTERN_TEMPLATE template class BasicClampedNumber<double>;
+  CLAMPED_EXTERN_TEMPLATE template class ClampedDecimal<double>;
+}
@@ -4,9 +4,20 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 #include <limits>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus > 201703L && defined(__has_include)
+# if __has_include(<span>)
+#include <span>
+# endif
+#endif
+
+#include "clamp_kernels.hh"
 
 #if !defined(CLAMPED_INT8) && defined(INT8_MAX) && defined(INT8_MIN)
 #define CLAMPED_INT8
@@ -103,6 +114,24 @@ namespace clamped
      */
     virtual ~BasicClampedNumber() = default;
     
+    /**
+     * Copies and moves are memberwise. They are declared explicitly because
+     * the virtual destructor would otherwise suppress the moves, so that a
+     * heavy `NumT` would be deep-copied wherever a number is returned or
+     * passed on by value. A moved-from number may only be assigned to or
+     * destroyed.
+     */
+    BasicClampedNumber(const BasicClampedNumber<NumT> &) = default;
+    
+    /** \copydoc BasicClampedNumber(const BasicClampedNumber<NumT> &) */
+    BasicClampedNumber(BasicClampedNumber<NumT> &&) = default;
+    
+    /** \copydoc BasicClampedNumber(const BasicClampedNumber<NumT> &) */
+    BasicClampedNumber<NumT> & operator=(const BasicClampedNumber<NumT> &) = default;
+    
+    /** \copydoc BasicClampedNumber(const BasicClampedNumber<NumT> &) */
+    BasicClampedNumber<NumT> & operator=(BasicClampedNumber<NumT> &&) = default;
+    
     public:
     
     /**
@@ -166,6 +195,23 @@ namespace clamped
      */
     virtual const NumT & minValue(const NumT &newMin) final;
 
+    /**
+     * Sets both of this number's bounds at once. Under the default
+     * `ReboundPolicy::STRETCH` this is the same as `minValue(newMin)` followed
+     * by `maxValue(newMax)`; under `ReboundPolicy::CLAMP` the bounds are taken
+     * as given and the current value is instead clamped into them.
+     * 
+     * \param newMin the new minimum for this number
+     * \param newMax the new maximum for this number
+     * 
+     * \see clamped::rebound()
+     */
+    template<ReboundPolicy Policy = ReboundPolicy::STRETCH>
+    void rebound(const NumT &newMin, const NumT &newMax)
+    {
+      detail::reboundClamped<Policy>(this->_value, this->_minValue, this->_maxValue, newMin, newMax);
+    }
+
     /**
      * Sets this number's current value to its maximum. After calling this
      * function, therefore, `value() == maxValue()`.
@@ -310,7 +356,7 @@ namespace clamped
      */
     virtual bool operator!=(const BasicClampedNumber<NumT> &other) const
     {
-      return !(*this == other);
+      return !(this->_value == other._value);
     }
     
     /**
@@ -331,13 +377,16 @@ namespace clamped
      * bounds of each number play no part in equality: only the primary stored
      * value is considered.
      * 
+     * Like each comparison, it compares both values directly, and so costs one
+     * virtual call and keeps the IEEE semantics of a NaN operand.
+     * 
      * \param other the right operand compared against
      * \return Returns true if this number is less than or equal to the other,
      * else false
      */
     virtual bool operator<=(const BasicClampedNumber<NumT> &other) const
     {
-      return *this < other || *this == other;
+      return this->_value <= other._value;
     }
     
     /**
@@ -350,7 +399,7 @@ namespace clamped
      */
     virtual bool operator>(const BasicClampedNumber<NumT> &other) const
     {
-      return !(*this <= other);
+      return this->_value > other._value;
     }
     
     /**
@@ -364,7 +413,7 @@ namespace clamped
      */
     virtual bool operator>=(const BasicClampedNumber<NumT> &other) const
     {
-      return !(*this < other);
+      return this->_value >= other._value;
     }
     
     /**
@@ -416,6 +465,31 @@ namespace clamped
   {
     public:
     
+    /**
+     * Constructs a new `ClampedNaturalNumber` with an initial value of zero and
+     * no bounds. With these default bounds left intact, this number will thus
+     * act like a `NatT` that does not overflow nor underflow when the maximum
+     * or minimum value it can represent is exceeded. This requires that
+     * `std::numeric_limits` be specialized for `NatT`, as it is for every
+     * builtin type.
+     */
+    ClampedNaturalNumber():
+        BasicClampedNumber<NatT>(0, std::numeric_limits<NatT>::min(), std::numeric_limits<NatT>::max())
+    {}
+    
+    /**
+     * Constructs a new `ClampedNaturalNumber` with the given initial value and
+     * no bounds. With these default bounds left intact, this number will thus
+     * act like a `NatT` that does not overflow nor underflow when the maximum
+     * or minimum value it can represent is exceeded. This requires that
+     * `std::numeric_limits` be specialized for `NatT`.
+     * 
+     * \param value the starting value of this number
+     */
+    ClampedNaturalNumber(const NatT &value):
+        BasicClampedNumber<NatT>(value, std::numeric_limits<NatT>::min(), std::numeric_limits<NatT>::max())
+    {}
+    
     /**
      * Constructs a new `ClampedNaturalNumber` with the specified current,
      * minimum, and maximum values. The minimum value must be less than or equal
@@ -427,7 +501,7 @@ namespace clamped
      * \param min the minimum value for this number
      * \param max the maximum value for this number
      */
-    ClampedNaturalNumber(const NatT &value, NatT min, NatT max):
+    ClampedNaturalNumber(const NatT &value, const NatT &min, const NatT &max):
         BasicClampedNumber<NatT>(value, min, max)
     {}
     
@@ -436,6 +510,20 @@ namespace clamped
      */
     virtual ~ClampedNaturalNumber() = default;
     
+    /**
+     * Copies and moves are memberwise, as for a `BasicClampedNumber`.
+     */
+    ClampedNaturalNumber(const ClampedNaturalNumber<NatT> &) = default;
+    
+    /** \copydoc ClampedNaturalNumber(const ClampedNaturalNumber<NatT> &) */
+    ClampedNaturalNumber(ClampedNaturalNumber<NatT> &&) = default;
+    
+    /** \copydoc ClampedNaturalNumber(const ClampedNaturalNumber<NatT> &) */
+    ClampedNaturalNumber<NatT> & operator=(const ClampedNaturalNumber<NatT> &) = default;
+    
+    /** \copydoc ClampedNaturalNumber(const ClampedNaturalNumber<NatT> &) */
+    ClampedNaturalNumber<NatT> & operator=(ClampedNaturalNumber<NatT> &&) = default;
+    
     public:
     
     /**
@@ -445,7 +533,7 @@ namespace clamped
      * \param other the right operand for addition
      * \return Returns this number, allowing chaining of operations.
      */
-    virtual ClampedNaturalNumber<NatT> & operator+=(const NatT &other);
+    virtual ClampedNaturalNumber<NatT> & operator+=(detail::ArgumentType<NatT> other);
     
     /**
      * Subtracts the given number from this one, as constrained by this
@@ -454,7 +542,7 @@ namespace clamped
      * \param other the right operand for subtraction
      * \return Returns this number, allowing chaining of operations.
      */
-    virtual ClampedNaturalNumber<NatT> & operator-=(const NatT &other);
+    virtual ClampedNaturalNumber<NatT> & operator-=(detail::ArgumentType<NatT> other);
     
     /**
      * Multiplies this number by the one given, as constrained by this
@@ -463,7 +551,7 @@ namespace clamped
      * \param other the right operand for multiplication
      * \return Returns this number, allowing chaining of operations.
      */
-    virtual ClampedNaturalNumber<NatT> & operator*=(const NatT &other);
+    virtual ClampedNaturalNumber<NatT> & operator*=(detail::ArgumentType<NatT> other);
     
     /**
      * Divides this number by the one given, as constrained by this number's
@@ -474,7 +562,7 @@ namespace clamped
      * \param other the right operand for division
      * \return Returns this number, allowing chaining of operations.
      */
-    virtual ClampedNaturalNumber<NatT> & operator/=(const NatT &other);
+    virtual ClampedNaturalNumber<NatT> & operator/=(detail::ArgumentType<NatT> other);
     
     /**
      * Sets this number's value to the remainder of division by the given
@@ -484,7 +572,53 @@ namespace clamped
      * \param other the value by which to divide this one
      * \return Returns this number, allowing chain of operations.
      */
-    virtual ClampedNaturalNumber<NatT> & operator%=(const NatT &other);
+    virtual ClampedNaturalNumber<NatT> & operator%=(detail::ArgumentType<NatT> other);
+    
+    /**
+     * Adds the given number to this one, as constrained by this number's
+     * bounds, reporting whether the sum saturated at either bound.
+     * 
+     * \param other the right operand for addition
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<NatT> addChecked(detail::ArgumentType<NatT> other);
+    
+    /**
+     * Subtracts the given number from this one, as constrained by this number's
+     * bounds, reporting whether the difference saturated at either bound.
+     * 
+     * \param other the right operand for subtraction
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<NatT> subtractChecked(detail::ArgumentType<NatT> other);
+    
+    /**
+     * Multiplies this number by the one given, as constrained by this number's
+     * bounds, reporting whether the product saturated at either bound.
+     * 
+     * \param other the right operand for multiplication
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<NatT> multiplyChecked(detail::ArgumentType<NatT> other);
+    
+    /**
+     * Divides this number by the one given, as constrained by this number's
+     * bounds, reporting whether the quotient saturated at either bound.
+     * 
+     * \param other the right operand for division
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<NatT> divideChecked(detail::ArgumentType<NatT> other);
+    
+    /**
+     * Sets this number's value to the remainder of division by the one given,
+     * as constrained by this number's bounds, reporting whether the remainder
+     * saturated at either bound.
+     * 
+     * \param other the value by which to divide this one
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<NatT> moduloChecked(detail::ArgumentType<NatT> other);
     
     /**
      * Increments this number by one, within its bounds.
@@ -549,7 +683,26 @@ namespace clamped
   ClampedNaturalNumber<NatT> operator+(const ClampedNaturalNumber<NatT> &lhs, const NatT &rhs)
   {
     ClampedNaturalNumber<NatT> sum(lhs);
-    return (sum += rhs);
+    sum += rhs;
+    return sum;
+  }
+  
+  /**
+   * Returns the sum of a temporary `ClampedNaturalNumber` and the given number,
+   * as the other overload does, but reusing the temporary in place of a copy,
+   * so that a chain such as num + a + b copies `num` only once.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the sum, moved out of `lhs`.
+   * 
+   * \related ClampedNaturalNumber
+   */
+  template<typename NatT>
+  ClampedNaturalNumber<NatT> operator+(ClampedNaturalNumber<NatT> &&lhs, const NatT &rhs)
+  {
+    lhs += rhs;
+    return std::move(lhs);
   }
   
   /**
@@ -568,7 +721,26 @@ namespace clamped
   ClampedNaturalNumber<NatT> operator-(const ClampedNaturalNumber<NatT> &lhs, const NatT &rhs)
   {
     ClampedNaturalNumber<NatT> difference(lhs);
-    return (difference -= rhs);
+    difference -= rhs;
+    return difference;
+  }
+  
+  /**
+   * Returns the difference of a temporary `ClampedNaturalNumber` and the given
+   * number, as the other overload does, but reusing the temporary in place of a
+   * copy, so that a chain such as num - a - b copies `num` only once.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the difference, moved out of `lhs`.
+   * 
+   * \related ClampedNaturalNumber
+   */
+  template<typename NatT>
+  ClampedNaturalNumber<NatT> operator-(ClampedNaturalNumber<NatT> &&lhs, const NatT &rhs)
+  {
+    lhs -= rhs;
+    return std::move(lhs);
   }
   
   /**
@@ -587,7 +759,26 @@ namespace clamped
   ClampedNaturalNumber<NatT> operator*(const ClampedNaturalNumber<NatT> &lhs, const NatT &rhs)
   {
     ClampedNaturalNumber<NatT> product(lhs);
-    return (product *= rhs);
+    product *= rhs;
+    return product;
+  }
+  
+  /**
+   * Returns the product of a temporary `ClampedNaturalNumber` and the given
+   * number, as the other overload does, but reusing the temporary in place of a
+   * copy, so that a chain such as num * a * b copies `num` only once.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the product, moved out of `lhs`.
+   * 
+   * \related ClampedNaturalNumber
+   */
+  template<typename NatT>
+  ClampedNaturalNumber<NatT> operator*(ClampedNaturalNumber<NatT> &&lhs, const NatT &rhs)
+  {
+    lhs *= rhs;
+    return std::move(lhs);
   }
   
   /**
@@ -606,7 +797,26 @@ namespace clamped
   ClampedNaturalNumber<NatT> operator/(const ClampedNaturalNumber<NatT> &lhs, const NatT &rhs)
   {
     ClampedNaturalNumber<NatT> quotient(lhs);
-    return (quotient /= rhs);
+    quotient /= rhs;
+    return quotient;
+  }
+  
+  /**
+   * Returns the quotient of a temporary `ClampedNaturalNumber` and the given
+   * number, as the other overload does, but reusing the temporary in place of a
+   * copy, so that a chain such as num / a / b copies `num` only once.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the quotient, moved out of `lhs`.
+   * 
+   * \related ClampedNaturalNumber
+   */
+  template<typename NatT>
+  ClampedNaturalNumber<NatT> operator/(ClampedNaturalNumber<NatT> &&lhs, const NatT &rhs)
+  {
+    lhs /= rhs;
+    return std::move(lhs);
   }
   
   /**
@@ -627,7 +837,75 @@ namespace clamped
   ClampedNaturalNumber<NatT> operator%(const ClampedNaturalNumber<NatT> &lhs, const NatT &rhs)
   {
     ClampedNaturalNumber<NatT> remainder(lhs);
-    return (remainder %= rhs);
+    remainder %= rhs;
+    return remainder;
+  }
+  
+  /**
+   * Returns the remainder of a temporary `ClampedNaturalNumber` and the given
+   * number, as the other overload does, but reusing the temporary in place of a
+   * copy, so that a chain such as num % a % b copies `num` only once.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the remainder, moved out of `lhs`.
+   * 
+   * \related ClampedNaturalNumber
+   */
+  template<typename NatT>
+  ClampedNaturalNumber<NatT> operator%(ClampedNaturalNumber<NatT> &&lhs, const NatT &rhs)
+  {
+    lhs %= rhs;
+    return std::move(lhs);
+  }
+  
+  /**
+   * Returns a new `ClampedNaturalNumber` with a value equal to that of the
+   * original multiplied by `a`, plus `b`, within the clamped number's bounds.
+   * Under the default `ClampPolicy::AT_END`, the expression is evaluated in a
+   * wider type and clamped once, rather than after both steps as `num * a + b`
+   * would.
+   * 
+   * \param x the original number which is multiplied
+   * \param a the number by which the original is multiplied
+   * \param b the number added onto the product
+   * \return Returns the product of the original and `a`, plus `b`.
+   * 
+   * \related ClampedNaturalNumber
+   */
+  template<ClampPolicy Policy = ClampPolicy::AT_END, typename NatT>
+  ClampedNaturalNumber<NatT> multiplyAdd(const ClampedNaturalNumber<NatT> &x, const NatT &a, const NatT &b)
+  {
+    NatT value = x.value();
+    detail::multiplyAdd<Policy, detail::NaturalKernels<NatT>>(value, a, b, x.minValue(), x.maxValue());
+    return {value, x.minValue(), x.maxValue()};
+  }
+  
+  /**
+   * Returns a new `ClampedNaturalNumber` with a value equal to that of the
+   * original multiplied by `a`, plus `b`, all divided by `c`, within the
+   * clamped number's bounds. Under the default `ClampPolicy::AT_END`, the
+   * expression is evaluated in a wider type and clamped once, rather than after
+   * every step as `(num * a + b) / c` would; for example, given a number with
+   * value 10 and bounds [0, 50], multiplyAddDivide(num, 10, 0, 4) returns a new
+   * number with value 25, where the operators would give 12.
+   * 
+   * \param x the original number which is multiplied
+   * \param a the number by which the original is multiplied
+   * \param b the number added onto the product
+   * \param c the number by which the sum is divided
+   * \return Returns the product of the original and `a`, plus `b`, over `c`.
+   * 
+   * \related ClampedNaturalNumber
+   */
+  template<ClampPolicy Policy = ClampPolicy::AT_END, typename NatT>
+  ClampedNaturalNumber<NatT> multiplyAddDivide(const ClampedNaturalNumber<NatT> &x,
+      const NatT &a, const NatT &b, const NatT &c)
+  {
+    NatT value = x.value();
+    detail::multiplyAddDivide<Policy, detail::NaturalKernels<NatT>>(value, a, b, c,
+        x.minValue(), x.maxValue());
+    return {value, x.minValue(), x.maxValue()};
   }
   
   /**
@@ -649,6 +927,31 @@ namespace clamped
   {
     public:
     
+    /**
+     * Constructs a new `ClampedInteger` with an initial value of zero and no
+     * bounds. With these default bounds left intact, this number will thus act
+     * like an `IntT` that does not overflow nor underflow when the maximum or
+     * minimum value it can represent is exceeded. This requires that
+     * `std::numeric_limits` be specialized for `IntT`, as it is for every
+     * builtin type.
+     */
+    ClampedInteger():
+        BasicClampedNumber<IntT>(0, std::numeric_limits<IntT>::min(), std::numeric_limits<IntT>::max())
+    {}
+    
+    /**
+     * Constructs a new `ClampedInteger` with the given initial value and no
+     * bounds. With these default bounds left intact, this number will thus act
+     * like an `IntT` that does not overflow nor underflow when the maximum or
+     * minimum value it can represent is exceeded. This requires that
+     * `std::numeric_limits` be specialized for `IntT`.
+     * 
+     * \param value the starting value of this number
+     */
+    ClampedInteger(const IntT &value):
+        BasicClampedNumber<IntT>(value, std::numeric_limits<IntT>::min(), std::numeric_limits<IntT>::max())
+    {}
+    
     /**
      * Constructs a new `ClampedInteger` with the specified current, minimum,
      * and maximum values. The minimum value must be less than or equal to the
@@ -669,6 +972,20 @@ namespace clamped
      */
     virtual ~ClampedInteger() = default;
     
+    /**
+     * Copies and moves are memberwise, as for a `BasicClampedNumber`.
+     */
+    ClampedInteger(const ClampedInteger<IntT> &) = default;
+    
+    /** \copydoc ClampedInteger(const ClampedInteger<IntT> &) */
+    ClampedInteger(ClampedInteger<IntT> &&) = default;
+    
+    /** \copydoc ClampedInteger(const ClampedInteger<IntT> &) */
+    ClampedInteger<IntT> & operator=(const ClampedInteger<IntT> &) = default;
+    
+    /** \copydoc ClampedInteger(const ClampedInteger<IntT> &) */
+    ClampedInteger<IntT> & operator=(ClampedInteger<IntT> &&) = default;
+    
     public:
     
     /**
@@ -678,7 +995,7 @@ namespace clamped
      * \param other the right operand for addition
      * \return Returns this number, allowing chaining of operations.
      */
-    virtual ClampedInteger<IntT> & operator+=(const IntT &other);
+    virtual ClampedInteger<IntT> & operator+=(detail::ArgumentType<IntT> other);
     
     /**
      * Subtracts the given number from this one, as constrained by this
@@ -687,7 +1004,7 @@ namespace clamped
      * \param other the right operand for subtraction
      * \return Returns this number, allowing chaining of operations.
      */
-    virtual ClampedInteger<IntT> & operator-=(const IntT &other);
+    virtual ClampedInteger<IntT> & operator-=(detail::ArgumentType<IntT> other);
     
     /**
      * Multiplies this number by the one given, as constrained by this
@@ -696,7 +1013,7 @@ namespace clamped
      * \param other the right operand for multiplication
      * \return Returns this number, allowing chaining of operations.
      */
-    virtual ClampedInteger<IntT> & operator*=(const IntT &other);
+    virtual ClampedInteger<IntT> & operator*=(detail::ArgumentType<IntT> other);
     
     /**
      * Divides this number by the one given, as constrained by this number's
@@ -707,7 +1024,7 @@ namespace clamped
      * \param other the right operand for division
      * \return Returns this number, allowing chaining of operations.
      */
-    virtual ClampedInteger<IntT> & operator/=(const IntT &other);
+    virtual ClampedInteger<IntT> & operator/=(detail::ArgumentType<IntT> other);
     
     /**
      * Sets this number's value to the remainder of division by the given
@@ -717,7 +1034,53 @@ namespace clamped
      * \param other the value by which to divide this one
      * \return Returns this number, allowing chain of operations.
      */
-    virtual ClampedInteger<IntT> & operator%=(const IntT &other);
+    virtual ClampedInteger<IntT> & operator%=(detail::ArgumentType<IntT> other);
+    
+    /**
+     * Adds the given number to this one, as constrained by this number's
+     * bounds, reporting whether the sum saturated at either bound.
+     * 
+     * \param other the right operand for addition
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<IntT> addChecked(detail::ArgumentType<IntT> other);
+    
+    /**
+     * Subtracts the given number from this one, as constrained by this number's
+     * bounds, reporting whether the difference saturated at either bound.
+     * 
+     * \param other the right operand for subtraction
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<IntT> subtractChecked(detail::ArgumentType<IntT> other);
+    
+    /**
+     * Multiplies this number by the one given, as constrained by this number's
+     * bounds, reporting whether the product saturated at either bound.
+     * 
+     * \param other the right operand for multiplication
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<IntT> multiplyChecked(detail::ArgumentType<IntT> other);
+    
+    /**
+     * Divides this number by the one given, as constrained by this number's
+     * bounds, reporting whether the quotient saturated at either bound.
+     * 
+     * \param other the right operand for division
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<IntT> divideChecked(detail::ArgumentType<IntT> other);
+    
+    /**
+     * Sets this number's value to the remainder of division by the one given,
+     * as constrained by this number's bounds, reporting whether the remainder
+     * saturated at either bound.
+     * 
+     * \param other the value by which to divide this one
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<IntT> moduloChecked(detail::ArgumentType<IntT> other);
     
     /**
      * Increments this number by one, within its bounds.
@@ -761,7 +1124,7 @@ namespace clamped
     virtual ClampedInteger<IntT> operator--(int)
     {
       ClampedInteger<IntT> preDecr(*this);
-      --(this);
+      --(*this);
       return preDecr;
     }
   };
@@ -783,7 +1146,26 @@ namespace clamped
   ClampedInteger<IntT> operator+(const ClampedInteger<IntT> &lhs, const IntT &rhs)
   {
     ClampedInteger<IntT> sum(lhs);
-    return (sum += rhs);
+    sum += rhs;
+    return sum;
+  }
+  
+  /**
+   * Returns the sum of a temporary `ClampedInteger` and the given number, as
+   * the other overload does, but reusing the temporary in place of a copy, so
+   * that a chain such as num + a + b copies `num` only once.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the sum, moved out of `lhs`.
+   * 
+   * \related ClampedInteger
+   */
+  template<typename IntT>
+  ClampedInteger<IntT> operator+(ClampedInteger<IntT> &&lhs, const IntT &rhs)
+  {
+    lhs += rhs;
+    return std::move(lhs);
   }
   
   /**
@@ -803,7 +1185,26 @@ namespace clamped
   ClampedInteger<IntT> operator-(const ClampedInteger<IntT> &lhs, const IntT &rhs)
   {
     ClampedInteger<IntT> difference(lhs);
-    return (difference -= rhs);
+    difference -= rhs;
+    return difference;
+  }
+  
+  /**
+   * Returns the difference of a temporary `ClampedInteger` and the given
+   * number, as the other overload does, but reusing the temporary in place of a
+   * copy, so that a chain such as num - a - b copies `num` only once.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the difference, moved out of `lhs`.
+   * 
+   * \related ClampedInteger
+   */
+  template<typename IntT>
+  ClampedInteger<IntT> operator-(ClampedInteger<IntT> &&lhs, const IntT &rhs)
+  {
+    lhs -= rhs;
+    return std::move(lhs);
   }
   
   /**
@@ -823,7 +1224,26 @@ namespace clamped
   ClampedInteger<IntT> operator*(const ClampedInteger<IntT> &lhs, const IntT &rhs)
   {
     ClampedInteger<IntT> product(lhs);
-    return (product *= rhs);
+    product *= rhs;
+    return product;
+  }
+  
+  /**
+   * Returns the product of a temporary `ClampedInteger` and the given number,
+   * as the other overload does, but reusing the temporary in place of a copy,
+   * so that a chain such as num * a * b copies `num` only once.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the product, moved out of `lhs`.
+   * 
+   * \related ClampedInteger
+   */
+  template<typename IntT>
+  ClampedInteger<IntT> operator*(ClampedInteger<IntT> &&lhs, const IntT &rhs)
+  {
+    lhs *= rhs;
+    return std::move(lhs);
   }
   
   /**
@@ -843,7 +1263,26 @@ namespace clamped
   ClampedInteger<IntT> operator/(const ClampedInteger<IntT> &lhs, const IntT &rhs)
   {
     ClampedInteger<IntT> quotient(lhs);
-    return (quotient /= rhs);
+    quotient /= rhs;
+    return quotient;
+  }
+  
+  /**
+   * Returns the quotient of a temporary `ClampedInteger` and the given number,
+   * as the other overload does, but reusing the temporary in place of a copy,
+   * so that a chain such as num / a / b copies `num` only once.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the quotient, moved out of `lhs`.
+   * 
+   * \related ClampedInteger
+   */
+  template<typename IntT>
+  ClampedInteger<IntT> operator/(ClampedInteger<IntT> &&lhs, const IntT &rhs)
+  {
+    lhs /= rhs;
+    return std::move(lhs);
   }
   
   /**
@@ -864,7 +1303,75 @@ namespace clamped
   ClampedInteger<IntT> operator%(const ClampedInteger<IntT> &lhs, const IntT &rhs)
   {
     ClampedInteger<IntT> remainder(lhs);
-    return (remainder %= rhs);
+    remainder %= rhs;
+    return remainder;
+  }
+  
+  /**
+   * Returns the remainder of a temporary `ClampedInteger` and the given number,
+   * as the other overload does, but reusing the temporary in place of a copy,
+   * so that a chain such as num % a % b copies `num` only once.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the remainder, moved out of `lhs`.
+   * 
+   * \related ClampedInteger
+   */
+  template<typename IntT>
+  ClampedInteger<IntT> operator%(ClampedInteger<IntT> &&lhs, const IntT &rhs)
+  {
+    lhs %= rhs;
+    return std::move(lhs);
+  }
+  
+  /**
+   * Returns a new `ClampedInteger` with a value equal to that of the original
+   * multiplied by `a`, plus `b`, within the clamped number's bounds. Under the
+   * default `ClampPolicy::AT_END`, the expression is evaluated in a wider
+   * type and clamped once, rather than after both steps as `num * a + b`
+   * would; for example, given a number with value 10 and bounds [0, 50],
+   * multiplyAdd(num, 10, -60) returns a new number with value 40, where the
+   * operators would give 0.
+   * 
+   * \param x the original number which is multiplied
+   * \param a the number by which the original is multiplied
+   * \param b the number added onto the product
+   * \return Returns the product of the original and `a`, plus `b`.
+   * 
+   * \related ClampedInteger
+   */
+  template<ClampPolicy Policy = ClampPolicy::AT_END, typename IntT>
+  ClampedInteger<IntT> multiplyAdd(const ClampedInteger<IntT> &x, const IntT &a, const IntT &b)
+  {
+    IntT value = x.value();
+    detail::multiplyAdd<Policy, detail::IntegerKernels<IntT>>(value, a, b, x.minValue(), x.maxValue());
+    return {value, x.minValue(), x.maxValue()};
+  }
+  
+  /**
+   * Returns a new `ClampedInteger` with a value equal to that of the original
+   * multiplied by `a`, plus `b`, all divided by `c`, within the clamped
+   * number's bounds. Under the default `ClampPolicy::AT_END`, the expression
+   * is evaluated in a wider type and clamped once, rather than after every
+   * step as `(num * a + b) / c` would.
+   * 
+   * \param x the original number which is multiplied
+   * \param a the number by which the original is multiplied
+   * \param b the number added onto the product
+   * \param c the number by which the sum is divided
+   * \return Returns the product of the original and `a`, plus `b`, over `c`.
+   * 
+   * \related ClampedInteger
+   */
+  template<ClampPolicy Policy = ClampPolicy::AT_END, typename IntT>
+  ClampedInteger<IntT> multiplyAddDivide(const ClampedInteger<IntT> &x,
+      const IntT &a, const IntT &b, const IntT &c)
+  {
+    IntT value = x.value();
+    detail::multiplyAddDivide<Policy, detail::IntegerKernels<IntT>>(value, a, b, c,
+        x.minValue(), x.maxValue());
+    return {value, x.minValue(), x.maxValue()};
   }
   
   /**
@@ -881,8 +1388,8 @@ namespace clamped
   template<typename IntT>
   ClampedInteger<IntT> operator-(const ClampedInteger<IntT> &orig)
   {
-    IntT negVal = -(orig._value);
-    return {negVal, orig._minValue, orig.maxValue};
+    IntT negVal = -orig.value();
+    return {negVal, orig.minValue(), orig.maxValue()};
   }
   
   /**
@@ -937,6 +1444,20 @@ namespace clamped
      */
     virtual ~ClampedDecimal() = default;
     
+    /**
+     * Copies and moves are memberwise, as for a `BasicClampedNumber`.
+     */
+    ClampedDecimal(const ClampedDecimal<FloatT> &) = default;
+    
+    /** \copydoc ClampedDecimal(const ClampedDecimal<FloatT> &) */
+    ClampedDecimal(ClampedDecimal<FloatT> &&) = default;
+    
+    /** \copydoc ClampedDecimal(const ClampedDecimal<FloatT> &) */
+    ClampedDecimal<FloatT> & operator=(const ClampedDecimal<FloatT> &) = default;
+    
+    /** \copydoc ClampedDecimal(const ClampedDecimal<FloatT> &) */
+    ClampedDecimal<FloatT> & operator=(ClampedDecimal<FloatT> &&) = default;
+    
     public:
     
     /**
@@ -946,7 +1467,7 @@ namespace clamped
      * \param other the right operand for addition
      * \return Returns this number, allowing chaining of operations.
      */
-    virtual ClampedDecimal<FloatT> & operator+=(const FloatT &other);
+    virtual ClampedDecimal<FloatT> & operator+=(detail::ArgumentType<FloatT> other);
     
     /**
      * Subtracts the given number from this one, as constrained by this
@@ -955,7 +1476,7 @@ namespace clamped
      * \param other the right operand for subtraction
      * \return Returns this number, allowing chaining of operations.
      */
-    virtual ClampedDecimal<FloatT> & operator-=(const FloatT &other);
+    virtual ClampedDecimal<FloatT> & operator-=(detail::ArgumentType<FloatT> other);
     
     /**
      * Multiplies this number by the one given, as constrained by this
@@ -964,7 +1485,7 @@ namespace clamped
      * \param other the right operand for multiplication
      * \return Returns this number, allowing chaining of operations.
      */
-    virtual ClampedDecimal<FloatT> & operator*=(const FloatT &other);
+    virtual ClampedDecimal<FloatT> & operator*=(detail::ArgumentType<FloatT> other);
     
     /**
      * Divides this number by the one given, as constrained by this number's
@@ -975,35 +1496,71 @@ namespace clamped
      * \param other the right operand for division
      * \return Returns this number, allowing chaining of operations.
      */
-    virtual ClampedDecimal<FloatT> & operator/=(const FloatT &other);
+    virtual ClampedDecimal<FloatT> & operator/=(detail::ArgumentType<FloatT> other);
     
     /**
-     * Increments this number by one, within its bounds.
+     * Adds the given number to this one, as constrained by this number's
+     * bounds, reporting whether the sum saturated at either bound.
      * 
-     * \return Returns this number post-incrementation.
+     * \param other the right operand for addition
+     * \return Returns this number's new value, and how it was clamped.
      */
-    virtual ClampedDecimal<FloatT> & operator++()
-    {
-      return (*this += 1);
-    }
+    virtual ClampResult<FloatT> addChecked(detail::ArgumentType<FloatT> other);
     
     /**
-     * Decrements this number by one, within its bounds.
+     * Subtracts the given number from this one, as constrained by this number's
+     * bounds, reporting whether the difference saturated at either bound.
      * 
-     * \return Returns this number post-decrementation.
+     * \param other the right operand for subtraction
+     * \return Returns this number's new value, and how it was clamped.
      */
-    virtual ClampedDecimal<FloatT> & operator--()
-    {
-      return (*this -= 1);
-    }
+    virtual ClampResult<FloatT> subtractChecked(detail::ArgumentType<FloatT> other);
     
     /**
-     * Increments this number by one, within its bounds.
+     * Multiplies this number by the one given, as constrained by this number's
+     * bounds, reporting whether the product saturated at either bound.
      * 
-     * \return Returns a copy of this number, reflecting its state prior
-     * to incrementation.
+     * \param other the right operand for multiplication
+     * \return Returns this number's new value, and how it was clamped.
      */
-    virtual ClampedDecimal<FloatT> operator++(int)
+    virtual ClampResult<FloatT> multiplyChecked(detail::ArgumentType<FloatT> other);
+    
+    /**
+     * Divides this number by the one given, as constrained by this number's
+     * bounds, reporting whether the quotient saturated at either bound.
+     * 
+     * \param other the right operand for division
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<FloatT> divideChecked(detail::ArgumentType<FloatT> other);
+    
+    /**
+     * Increments this number by one, within its bounds.
+     * 
+     * \return Returns this number post-incrementation.
+     */
+    virtual ClampedDecimal<FloatT> & operator++()
+    {
+      return (*this += 1);
+    }
+    
+    /**
+     * Decrements this number by one, within its bounds.
+     * 
+     * \return Returns this number post-decrementation.
+     */
+    virtual ClampedDecimal<FloatT> & operator--()
+    {
+      return (*this -= 1);
+    }
+    
+    /**
+     * Increments this number by one, within its bounds.
+     * 
+     * \return Returns a copy of this number, reflecting its state prior
+     * to incrementation.
+     */
+    virtual ClampedDecimal<FloatT> operator++(int)
     {
       ClampedDecimal<FloatT> preIncr(*this);
       ++(*this);
@@ -1041,7 +1598,26 @@ namespace clamped
   ClampedDecimal<FloatT> operator+(const ClampedDecimal<FloatT> &lhs, const FloatT &rhs)
   {
     ClampedDecimal<FloatT> sum(lhs);
-    return (sum += rhs);
+    sum += rhs;
+    return sum;
+  }
+  
+  /**
+   * Returns the sum of a temporary `ClampedDecimal` and the given number, as
+   * the other overload does, but reusing the temporary in place of a copy, so
+   * that a chain such as num + a + b copies `num` only once.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the sum, moved out of `lhs`.
+   * 
+   * \related ClampedDecimal
+   */
+  template<typename FloatT>
+  ClampedDecimal<FloatT> operator+(ClampedDecimal<FloatT> &&lhs, const FloatT &rhs)
+  {
+    lhs += rhs;
+    return std::move(lhs);
   }
   
   /**
@@ -1061,7 +1637,26 @@ namespace clamped
   ClampedDecimal<FloatT> operator-(const ClampedDecimal<FloatT> &lhs, const FloatT &rhs)
   {
     ClampedDecimal<FloatT> difference(lhs);
-    return (difference -= rhs);
+    difference -= rhs;
+    return difference;
+  }
+  
+  /**
+   * Returns the difference of a temporary `ClampedDecimal` and the given
+   * number, as the other overload does, but reusing the temporary in place of a
+   * copy, so that a chain such as num - a - b copies `num` only once.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the difference, moved out of `lhs`.
+   * 
+   * \related ClampedDecimal
+   */
+  template<typename FloatT>
+  ClampedDecimal<FloatT> operator-(ClampedDecimal<FloatT> &&lhs, const FloatT &rhs)
+  {
+    lhs -= rhs;
+    return std::move(lhs);
   }
   
   /**
@@ -1080,7 +1675,26 @@ namespace clamped
   ClampedDecimal<FloatT> operator*(const ClampedDecimal<FloatT> &lhs, const FloatT &rhs)
   {
     ClampedDecimal<FloatT> product(lhs);
-    return (product *= rhs);
+    product *= rhs;
+    return product;
+  }
+  
+  /**
+   * Returns the product of a temporary `ClampedDecimal` and the given number,
+   * as the other overload does, but reusing the temporary in place of a copy,
+   * so that a chain such as num * a * b copies `num` only once.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the product, moved out of `lhs`.
+   * 
+   * \related ClampedDecimal
+   */
+  template<typename FloatT>
+  ClampedDecimal<FloatT> operator*(ClampedDecimal<FloatT> &&lhs, const FloatT &rhs)
+  {
+    lhs *= rhs;
+    return std::move(lhs);
   }
   
   /**
@@ -1099,7 +1713,75 @@ namespace clamped
   ClampedDecimal<FloatT> operator/(const ClampedDecimal<FloatT> &lhs, const FloatT &rhs)
   {
     ClampedDecimal<FloatT> quotient(lhs);
-    return (quotient /= rhs);
+    quotient /= rhs;
+    return quotient;
+  }
+  
+  /**
+   * Returns the quotient of a temporary `ClampedDecimal` and the given number,
+   * as the other overload does, but reusing the temporary in place of a copy,
+   * so that a chain such as num / a / b copies `num` only once.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the quotient, moved out of `lhs`.
+   * 
+   * \related ClampedDecimal
+   */
+  template<typename FloatT>
+  ClampedDecimal<FloatT> operator/(ClampedDecimal<FloatT> &&lhs, const FloatT &rhs)
+  {
+    lhs /= rhs;
+    return std::move(lhs);
+  }
+  
+  /**
+   * Returns a new `ClampedDecimal` with a value equal to that of the original
+   * multiplied by `a`, plus `b`, within the clamped number's bounds. Under the
+   * default `ClampPolicy::AT_END`, the expression is evaluated in a wider
+   * type and clamped once, rather than after both steps as `num * a + b`
+   * would; for example, given a number with value 10.0 and bounds [0, 50],
+   * multiplyAdd(num, 10.0, -60.0) returns a new number with value 40.0, where
+   * the operators would give 0.0.
+   * 
+   * \param x the original number which is multiplied
+   * \param a the number by which the original is multiplied
+   * \param b the number added onto the product
+   * \return Returns the product of the original and `a`, plus `b`.
+   * 
+   * \related ClampedDecimal
+   */
+  template<ClampPolicy Policy = ClampPolicy::AT_END, typename FloatT>
+  ClampedDecimal<FloatT> multiplyAdd(const ClampedDecimal<FloatT> &x, const FloatT &a, const FloatT &b)
+  {
+    FloatT value = x.value();
+    detail::multiplyAdd<Policy, detail::DecimalKernels<FloatT>>(value, a, b, x.minValue(), x.maxValue());
+    return {value, x.minValue(), x.maxValue()};
+  }
+  
+  /**
+   * Returns a new `ClampedDecimal` with a value equal to that of the original
+   * multiplied by `a`, plus `b`, all divided by `c`, within the clamped
+   * number's bounds. Under the default `ClampPolicy::AT_END`, the expression
+   * is evaluated in a wider type and clamped once, rather than after every
+   * step as `(num * a + b) / c` would.
+   * 
+   * \param x the original number which is multiplied
+   * \param a the number by which the original is multiplied
+   * \param b the number added onto the product
+   * \param c the number by which the sum is divided
+   * \return Returns the product of the original and `a`, plus `b`, over `c`.
+   * 
+   * \related ClampedDecimal
+   */
+  template<ClampPolicy Policy = ClampPolicy::AT_END, typename FloatT>
+  ClampedDecimal<FloatT> multiplyAddDivide(const ClampedDecimal<FloatT> &x,
+      const FloatT &a, const FloatT &b, const FloatT &c)
+  {
+    FloatT value = x.value();
+    detail::multiplyAddDivide<Policy, detail::DecimalKernels<FloatT>>(value, a, b, c,
+        x.minValue(), x.maxValue());
+    return {value, x.minValue(), x.maxValue()};
   }
   
   /**
@@ -1116,10 +1798,263 @@ namespace clamped
   template<typename FloatT>
   ClampedDecimal<FloatT> operator-(const ClampedDecimal<FloatT> &orig)
   {
-    FloatT negVal = -(orig._value);
-    return {negVal, orig._minValue, orig._maxValue};
+    FloatT negVal = -orig.value();
+    return {negVal, orig.minValue(), orig.maxValue()};
+  }
+  
+  /**
+   * Returns a new clamped number of the same type and bounds as `lhs`, with a
+   * value equal to that of `lhs` plus `rhs`, where `rhs` is of an arithmetic
+   * type other than the wrapped `NumT`. The sum is formed in a type holding
+   * both operands exactly, chosen at compile time, and clamped once into the
+   * bounds, so `rhs` is never narrowed beforehand: given a `ClampedInt16`
+   * with value 5 and bounds [0, 1000], num + 70000 returns a number with
+   * value 1000, where converting 70000 to `int16_t` would first wrap it to
+   * 4464. Where `NumT` already holds every value of `rhs`'s type, as
+   * `int64_t` does `int`, the operand is converted losslessly and the usual
+   * kernels clamp the result; otherwise the sum is formed in `rhs`'s type
+   * where it holds every `NumT`, in a signed integer wider than both where
+   * neither holds the other, or in `long double` for a `ClampedDecimal`.
+   * 
+   * Integral numbers take only integral operands, as a decimal one would
+   * call for rounding. The result is constructed directly, without first
+   * copying `lhs`, and its operation is not virtual.
+   * 
+   * \param lhs the number which is added to
+   * \param rhs the number added onto it
+   * \return Returns the sum of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related BasicClampedNumber
+   */
+  template<template<typename> class ClampedT, typename NumT, typename OtherT>
+  typename std::enable_if<detail::MixesWith<BasicClampedNumber, ClampedT<NumT>, NumT, OtherT>::value,
+      ClampedT<NumT>>::type
+  operator+(const ClampedT<NumT> &lhs, const OtherT &rhs)
+  {
+    return detail::combineMixed<detail::Operation::ADD>(lhs, lhs.value(), rhs);
+  }
+  
+  /**
+   * Returns a new clamped number of the same type and bounds as `lhs`, with a
+   * value equal to that of `lhs` minus `rhs`, where `rhs` is of an arithmetic
+   * type other than the wrapped `NumT`. The difference is formed and clamped as
+   * the mixed `operator+()` forms a sum.
+   * 
+   * \param lhs the number which is subtracted from
+   * \param rhs the right operand
+   * \return Returns the difference of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related BasicClampedNumber
+   */
+  template<template<typename> class ClampedT, typename NumT, typename OtherT>
+  typename std::enable_if<detail::MixesWith<BasicClampedNumber, ClampedT<NumT>, NumT, OtherT>::value,
+      ClampedT<NumT>>::type
+  operator-(const ClampedT<NumT> &lhs, const OtherT &rhs)
+  {
+    return detail::combineMixed<detail::Operation::SUBTRACT>(lhs, lhs.value(), rhs);
+  }
+  
+  /**
+   * Returns a new clamped number of the same type and bounds as `lhs`, with a
+   * value equal to that of `lhs` multiplied by `rhs`, where `rhs` is of an
+   * arithmetic type other than the wrapped `NumT`. The product is formed and
+   * clamped as the mixed `operator+()` forms a sum.
+   * 
+   * \param lhs the number which is multiplied
+   * \param rhs the right operand
+   * \return Returns the product of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related BasicClampedNumber
+   */
+  template<template<typename> class ClampedT, typename NumT, typename OtherT>
+  typename std::enable_if<detail::MixesWith<BasicClampedNumber, ClampedT<NumT>, NumT, OtherT>::value,
+      ClampedT<NumT>>::type
+  operator*(const ClampedT<NumT> &lhs, const OtherT &rhs)
+  {
+    return detail::combineMixed<detail::Operation::MULTIPLY>(lhs, lhs.value(), rhs);
+  }
+  
+  /**
+   * Returns a new clamped number of the same type and bounds as `lhs`, with a
+   * value equal to that of `lhs` divided by `rhs`, where `rhs` is of an
+   * arithmetic type other than the wrapped `NumT`. The quotient is formed and
+   * clamped as the mixed `operator+()` forms a sum. Division by zero saturates
+   * toward the sign of `lhs`, as `/=` does.
+   * 
+   * \param lhs the number which is divided
+   * \param rhs the right operand
+   * \return Returns the quotient of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related BasicClampedNumber
+   */
+  template<template<typename> class ClampedT, typename NumT, typename OtherT>
+  typename std::enable_if<detail::MixesWith<BasicClampedNumber, ClampedT<NumT>, NumT, OtherT>::value,
+      ClampedT<NumT>>::type
+  operator/(const ClampedT<NumT> &lhs, const OtherT &rhs)
+  {
+    return detail::combineMixed<detail::Operation::DIVIDE>(lhs, lhs.value(), rhs);
+  }
+  
+  /**
+   * Returns a new clamped number of the same type and bounds as `lhs`, with a
+   * value equal to the remainder of dividing `lhs` by `rhs`, where `rhs` is of
+   * an integral type other than the wrapped `NumT`. The remainder is formed
+   * and clamped as the mixed `operator+()` forms a sum.
+   * As with the other operators, the remainder of division by zero is zero.
+   * 
+   * \param lhs the number which is divided
+   * \param rhs the right operand
+   * \return Returns the remainder of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related BasicClampedNumber
+   */
+  template<template<typename> class ClampedT, typename NumT, typename OtherT>
+  typename std::enable_if<detail::MixesIntegrally<BasicClampedNumber, ClampedT<NumT>, NumT, OtherT>::value,
+      ClampedT<NumT>>::type
+  operator%(const ClampedT<NumT> &lhs, const OtherT &rhs)
+  {
+    return detail::combineMixed<detail::Operation::MODULO>(lhs, lhs.value(), rhs);
+  }
+  
+  /**
+   * Returns a new clamped number of the same type and bounds as `lhs`, with a
+   * value equal to the sum of the values of `lhs` and `rhs`, which may wrap
+   * different types: `rhs`'s bounds are ignored, and its value is added as
+   * by the mixed `operator+()`, or as by the plain one where both wrap the
+   * same type.
+   * 
+   * \param lhs the number which is added to
+   * \param rhs the number whose value is the right operand
+   * \return Returns the sum of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related BasicClampedNumber
+   */
+  template<template<typename> class ClampedT, typename NumT,
+      template<typename> class OtherClampedT, typename OtherT>
+  typename std::enable_if<
+      detail::ClampedPair<BasicClampedNumber, ClampedT<NumT>, NumT, OtherClampedT<OtherT>, OtherT>::value,
+      ClampedT<NumT>>::type
+  operator+(const ClampedT<NumT> &lhs, const OtherClampedT<OtherT> &rhs)
+  {
+    return lhs + rhs.value();
   }
   
+  /**
+   * Returns a new clamped number of the same type and bounds as `lhs`, with a
+   * value equal to the difference of the values of `lhs` and `rhs`, formed as
+   * the sum of two clamped numbers is.
+   * 
+   * \param lhs the number which is subtracted from
+   * \param rhs the number whose value is the right operand
+   * \return Returns the difference of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related BasicClampedNumber
+   */
+  template<template<typename> class ClampedT, typename NumT,
+      template<typename> class OtherClampedT, typename OtherT>
+  typename std::enable_if<
+      detail::ClampedPair<BasicClampedNumber, ClampedT<NumT>, NumT, OtherClampedT<OtherT>, OtherT>::value,
+      ClampedT<NumT>>::type
+  operator-(const ClampedT<NumT> &lhs, const OtherClampedT<OtherT> &rhs)
+  {
+    return lhs - rhs.value();
+  }
+  
+  /**
+   * Returns a new clamped number of the same type and bounds as `lhs`, with a
+   * value equal to the product of the values of `lhs` and `rhs`, formed as the
+   * sum of two clamped numbers is.
+   * 
+   * \param lhs the number which is multiplied
+   * \param rhs the number whose value is the right operand
+   * \return Returns the product of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related BasicClampedNumber
+   */
+  template<template<typename> class ClampedT, typename NumT,
+      template<typename> class OtherClampedT, typename OtherT>
+  typename std::enable_if<
+      detail::ClampedPair<BasicClampedNumber, ClampedT<NumT>, NumT, OtherClampedT<OtherT>, OtherT>::value,
+      ClampedT<NumT>>::type
+  operator*(const ClampedT<NumT> &lhs, const OtherClampedT<OtherT> &rhs)
+  {
+    return lhs * rhs.value();
+  }
+  
+  /**
+   * Returns a new clamped number of the same type and bounds as `lhs`, with a
+   * value equal to the quotient of the values of `lhs` and `rhs`, formed as the
+   * sum of two clamped numbers is.
+   * 
+   * \param lhs the number which is divided
+   * \param rhs the number whose value is the right operand
+   * \return Returns the quotient of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related BasicClampedNumber
+   */
+  template<template<typename> class ClampedT, typename NumT,
+      template<typename> class OtherClampedT, typename OtherT>
+  typename std::enable_if<
+      detail::ClampedPair<BasicClampedNumber, ClampedT<NumT>, NumT, OtherClampedT<OtherT>, OtherT>::value,
+      ClampedT<NumT>>::type
+  operator/(const ClampedT<NumT> &lhs, const OtherClampedT<OtherT> &rhs)
+  {
+    return lhs / rhs.value();
+  }
+  
+  /**
+   * Returns a new clamped number of the same type and bounds as `lhs`, with a
+   * value equal to the remainder of the values of `lhs` and `rhs`, formed as
+   * the sum of two clamped numbers is.
+   * 
+   * \param lhs the number which is divided
+   * \param rhs the number whose value is the right operand
+   * \return Returns the remainder of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related BasicClampedNumber
+   */
+  template<template<typename> class ClampedT, typename NumT,
+      template<typename> class OtherClampedT, typename OtherT>
+  typename std::enable_if<
+      detail::ClampedPair<BasicClampedNumber, ClampedT<NumT>, NumT, OtherClampedT<OtherT>, OtherT>::value,
+      ClampedT<NumT>>::type
+  operator%(const ClampedT<NumT> &lhs, const OtherClampedT<OtherT> &rhs)
+  {
+    return lhs % rhs.value();
+  }
+  
+  /**
+   * Rebounds each of `count` contiguous clamped numbers, as though by calling
+   * `rebound<Policy>(newMin, newMax)` on each in turn, in one branch-free pass
+   * over the array. This suits tightening or loosening the limits of a whole
+   * population at once.
+   * 
+   * \param numbers the first of the numbers to rebound
+   * \param count the number of numbers to rebound
+   * \param newMin the new minimum for every number
+   * \param newMax the new maximum for every number
+   */
+  template<ReboundPolicy Policy = ReboundPolicy::STRETCH, typename ClampedT>
+  void rebound(ClampedT *numbers, std::size_t count, const detail::WrappedType<ClampedT> &newMin,
+      const detail::WrappedType<ClampedT> &newMax)
+  {
+    static_assert(std::is_base_of<BasicClampedNumber<detail::WrappedType<ClampedT>>, ClampedT>::value,
+        "rebound() requires an array of clamped numbers");
+    
+    for(std::size_t i = 0; i < count; ++i)
+      numbers[i].template rebound<Policy>(newMin, newMax);
+  }
+  
+# ifdef __cpp_lib_span
+  /** \overload */
+  template<ReboundPolicy Policy = ReboundPolicy::STRETCH, typename ClampedT>
+  void rebound(std::span<ClampedT> numbers, const detail::WrappedType<ClampedT> &newMin,
+      const detail::WrappedType<ClampedT> &newMax)
+  {
+    clamped::rebound<Policy>(numbers.data(), numbers.size(), newMin, newMax);
+  }
+# endif
+  
 # ifdef CLAMPED_INT8
   
   /**
@@ -1128,62 +2063,10 @@ namespace clamped
    * defined if `int8_t` from `<cstdint>`, upon which it relies, also exists. If
    * so, the macro `CLAMPED_INT8` will also be defined.
    * 
-   * This type specialization provides no additional functions or operators:
-   * it only has a pair of additional constructors that don't ask for explicit
-   * lower and upper bounds. The default bounds are the minimum and maximum
-   * values the wrapped type can represent. Such a number will therefore behave
-   * much the same as the wrapped type, but without integer underflow
-   * or overflow.
+   * As with any builtin width, the bounds may be omitted, in which case they
+   * default to the limits of `int8_t`: such a number behaves much the same as
+   * an `int8_t`, but without integer underflow or overflow.
    */
-  template<>
-  class ClampedInteger<int8_t>: public BasicClampedNumber<int8_t>
-  {
-    public:
-    
-    /**
-     * Constructs a new `ClampedInt8` with an initial value of zero and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like an `int8_t` that does not overflow nor underflow when the maximum
-     * or minimum value it can represent is exceeded.
-     */
-    ClampedInteger<int8_t>():
-        BasicClampedNumber<int8_t>(0, std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedInt8` with the given initial value and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like a `int8_t` that does not overflow nor underflow when the maximum or
-     * minimum value it can represent is exceeded.
-     * 
-     * \param value the starting value of this number
-     */
-    ClampedInteger<int8_t>(int8_t value):
-        BasicClampedNumber<int8_t>(value, std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedInt8` with the given initial value and the
-     * specified lower and upper bounds. The minimum value must be less than or
-     * equal to the starting value: if it is not, it is itself clamped to the
-     * starting value. The maximum value is similarly constrained, and must be
-     * greater than or equal to the starting value.
-     * 
-     * \param value the starting value of this number
-     * \param min the minimum value for this number
-     * \param max the maximum value for this number
-     */
-    ClampedInteger<int8_t>(int8_t value, int8_t min, int8_t max):
-        BasicClampedNumber<int8_t>(value, min, max)
-    {}
-    
-    /**
-     * Provides a virtual destructor with the default dehavior.
-     */
-    virtual ~ClampedInteger<int8_t>() = default;
-  };
-  
-  /** ClampedInteger<int8_t> is aliased as ClampedInt8, if it exists. */
   using ClampedInt8 = ClampedInteger<int8_t>;
   
 # endif
@@ -1196,62 +2079,10 @@ namespace clamped
    * defined if `int16_t` from `<cstdint>`, upon which it relies, also exists.
    * If so, the macro `CLAMPED_INT16` will also be defined.
    * 
-   * This type specialization provides no additional functions or operators:
-   * it only has a pair of additional constructors that don't ask for explicit
-   * lower and upper bounds. The default bounds are the minimum and maximum
-   * values the wrapped type can represent. Such a number will therefore behave
-   * much the same as the wrapped type, but without integer underflow
-   * or overflow.
+   * As with any builtin width, the bounds may be omitted, in which case they
+   * default to the limits of `int16_t`: such a number behaves much the same as
+   * an `int16_t`, but without integer underflow or overflow.
    */
-  template<>
-  class ClampedInteger<int16_t>: public BasicClampedNumber<int16_t>
-  {
-    public:
-    
-    /**
-     * Constructs a new `ClampedInt16` with an initial value of zero and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like an `int16_t` that does not overflow nor underflow when the maximum
-     * or minimum value it can represent is exceeded.
-     */
-    ClampedInteger<int16_t>():
-        BasicClampedNumber(0, std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedInt16` with the given initial value and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like a `int16_t` that does not overflow nor underflow when the maximum or
-     * minimum value it can represent is exceeded.
-     * 
-     * \param value the starting value of this number
-     */
-    ClampedInteger<int16_t>(int16_t value):
-        BasicClampedNumber(value, std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedInt16` with the given initial value and the
-     * specified lower and upper bounds. The minimum value must be less than or
-     * equal to the starting value: if it is not, it is itself clamped to the
-     * starting value. The maximum value is similarly constrained, and must be
-     * greater than or equal to the starting value.
-     * 
-     * \param value the starting value of this number
-     * \param min the minimum value for this number
-     * \param max the maximum value for this number
-     */
-    ClampedInteger<int16_t>(int16_t value, int16_t min, int16_t max):
-        BasicClampedNumber(value, min, max)
-    {}
-    
-    /**
-     * Provides a virtual destructor with the default dehavior.
-     */
-    virtual ~ClampedInteger<int16_t>() = default;
-  };
-  
-  /** ClampedInteger<int16_t> is aliased as ClampedInt16, if it exists. */
   using ClampedInt16 = ClampedInteger<int16_t>;
   
 # endif
@@ -1264,62 +2095,10 @@ namespace clamped
    * defined if `int32_t` from `<cstdint>`, upon which it relies, also exists.
    * If so, the macro `CLAMPED_INT32` will also be defined.
    * 
-   * This type specialization provides no additional functions or operators:
-   * it only has a pair of additional constructors that don't ask for explicit
-   * lower and upper bounds. The default bounds are the minimum and maximum
-   * values the wrapped type can represent. Such a number will therefore behave
-   * much the same as the wrapped type, but without integer underflow
-   * or overflow.
+   * As with any builtin width, the bounds may be omitted, in which case they
+   * default to the limits of `int32_t`: such a number behaves much the same as
+   * an `int32_t`, but without integer underflow or overflow.
    */
-  template<>
-  class ClampedInteger<int32_t>: public BasicClampedNumber<int32_t>
-  {
-    public:
-    
-    /**
-     * Constructs a new `ClampedInt32` with an initial value of zero and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like an `int32_t` that does not overflow nor underflow when the maximum
-     * or minimum value it can represent is exceeded.
-     */
-    ClampedInteger<int32_t>():
-        BasicClampedNumber(0, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedInt32` with the given initial value and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like a `int32_t` that does not overflow nor underflow when the maximum or
-     * minimum value it can represent is exceeded.
-     * 
-     * \param value the starting value of this number
-     */
-    ClampedInteger<int32_t>(int32_t value):
-        BasicClampedNumber(value, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedInt32` with the given initial value and the
-     * specified lower and upper bounds. The minimum value must be less than or
-     * equal to the starting value: if it is not, it is itself clamped to the
-     * starting value. The maximum value is similarly constrained, and must be
-     * greater than or equal to the starting value.
-     * 
-     * \param value the starting value of this number
-     * \param min the minimum value for this number
-     * \param max the maximum value for this number
-     */
-    ClampedInteger<int32_t>(int32_t value, int32_t min, int32_t max):
-        BasicClampedNumber(value, min, max)
-    {}
-    
-    /**
-     * Provides a virtual destructor with the default dehavior.
-     */
-    virtual ~ClampedInteger<int32_t>() = default;
-  };
-  
-  /** ClampedInteger<int32_t> is aliased as ClampedInt32, if it exists. */
   using ClampedInt32 = ClampedInteger<int32_t>;
   
 # endif
@@ -1332,62 +2111,10 @@ namespace clamped
    * defined if `int164_t` from `<cstdint>`, upon which it relies, also exists.
    * If so, the macro `CLAMPED_INT64` will also be defined.
    * 
-   * This type specialization provides no additional functions or operators:
-   * it only has a pair of additional constructors that don't ask for explicit
-   * lower and upper bounds. The default bounds are the minimum and maximum
-   * values the wrapped type can represent. Such a number will therefore behave
-   * much the same as the wrapped type, but without integer underflow
-   * or overflow.
+   * As with any builtin width, the bounds may be omitted, in which case they
+   * default to the limits of `int64_t`: such a number behaves much the same as
+   * an `int64_t`, but without integer underflow or overflow.
    */
-  template<>
-  class ClampedInteger<int64_t>: public BasicClampedNumber<int64_t>
-  {
-    public:
-    
-    /**
-     * Constructs a new `ClampedInt64` with an initial value of zero and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like an `int64_t` that does not overflow nor underflow when the maximum
-     * or minimum value it can represent is exceeded.
-     */
-    ClampedInteger<int64_t>():
-        BasicClampedNumber(0, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedInt64` with the given initial value and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like a `int64_t` that does not overflow nor underflow when the maximum or
-     * minimum value it can represent is exceeded.
-     * 
-     * \param value the starting value of this number
-     */
-    ClampedInteger<int64_t>(int64_t value):
-        BasicClampedNumber(value, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedInt64` with the given initial value and the
-     * specified lower and upper bounds. The minimum value must be less than or
-     * equal to the starting value: if it is not, it is itself clamped to the
-     * starting value. The maximum value is similarly constrained, and must be
-     * greater than or equal to the starting value.
-     * 
-     * \param value the starting value of this number
-     * \param min the minimum value for this number
-     * \param max the maximum value for this number
-     */
-    ClampedInteger<int64_t>(int64_t value, int64_t min, int64_t max):
-        BasicClampedNumber(value, min, max)
-    {}
-    
-    /**
-     * Provides a virtual destructor with the default dehavior.
-     */
-    virtual ~ClampedInteger<int64_t>() = default;
-  };
-  
-  /** ClampedInteger<int64_t> is aliased as ClampedInt64, if it exists. */
   using ClampedInt64 = ClampedInteger<int64_t>;
   
 # endif
@@ -1400,63 +2127,11 @@ namespace clamped
    * defined if `uint8_t` from `<cstdint>`, upon which it relies, also exists.
    * If so, the macro `CLAMPED_UINT8` will also be defined.
    * 
-   * This type specialization provides no additional functions or operators:
-   * it only has a pair of additional constructors that don't ask for explicit
-   * lower and upper bounds. The default bounds are the minimum and maximum
-   * values the wrapped type can represent. Such a number will therefore behave
-   * much the same as the wrapped type, but without integer underflow
-   * or overflow.
+   * As with any builtin width, the bounds may be omitted, in which case they
+   * default to the limits of `uint8_t`: such a number behaves much the same as
+   * a `uint8_t`, but without integer underflow or overflow.
    */
-  template<>
-  class ClampedNaturalNumber<uint8_t>: public BasicClampedNumber<uint8_t>
-  {
-    public:
-    
-    /**
-     * Constructs a new `ClampedUInt8` with an initial value of zero and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like a `uint8_t` that does not overflow nor underflow when the maximum or
-     * minimum value it can represent is exceeded.
-     */
-    ClampedNaturalNumber<uint8_t>():
-        BasicClampedNumber(0, std::numeric_limits<uint8_t>::min(), std::numeric_limits<uint8_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedUInt8` with the given initial value and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like a `uint8_t` that does not overflow nor underflow when the maximum or
-     * minimum value it can represent is exceeded.
-     * 
-     * \param value the starting value of this number
-     */
-    ClampedNaturalNumber<uint8_t>(uint8_t value):
-        BasicClampedNumber(value, std::numeric_limits<uint8_t>::min(), std::numeric_limits<uint8_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedUInt8` with the given initial value and the
-     * specified lower and upper bounds. The minimum value must be less than or
-     * equal to the starting value: if it is not, it is itself clamped to the
-     * starting value. The maximum value is similarly constrained, and must be
-     * greater than or equal to the starting value.
-     * 
-     * \param value the starting value of this number
-     * \param min the minimum value for this number
-     * \param max the maximum value for this number
-     */
-    ClampedNaturalNumber<uint8_t>(uint8_t value, uint8_t min, uint8_t max):
-        BasicClampedNumber(value, min, max)
-    {}
-    
-    /**
-     * Provides a virtual destructor with the default dehavior.
-     */
-    virtual ~ClampedNaturalNumber<uint8_t>() = default;
-  };
-  
-  /** ClampedInteger<uint8_t> is aliased as ClampedUInt8, if it exists. */
-  using ClampedUInt8 = ClampedInteger<uint8_t>;
+  using ClampedUInt8 = ClampedNaturalNumber<uint8_t>;
   
 # endif
   
@@ -1468,63 +2143,11 @@ namespace clamped
    * defined if `uint16_t` from `<cstdint>`, upon which it relies, also exists.
    * If so, the macro `CLAMPED_UINT16` will also be defined.
    * 
-   * This type specialization provides no additional functions or operators:
-   * it only has a pair of additional constructors that don't ask for explicit
-   * lower and upper bounds. The default bounds are the minimum and maximum
-   * values the wrapped type can represent. Such a number will therefore behave
-   * much the same as the wrapped type, but without integer underflow
-   * or overflow.
+   * As with any builtin width, the bounds may be omitted, in which case they
+   * default to the limits of `uint16_t`: such a number behaves much the same as
+   * a `uint16_t`, but without integer underflow or overflow.
    */
-  template<>
-  class ClampedNaturalNumber<uint16_t>: public BasicClampedNumber<uint16_t>
-  {
-    public:
-    
-    /**
-     * Constructs a new `ClampedUInt16` with an initial value of zero and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like a `uint16_t` that does not overflow nor underflow when the maximum
-     * or minimum value it can represent is exceeded.
-     */
-    ClampedNaturalNumber<uint16_t>():
-        BasicClampedNumber(0, std::numeric_limits<uint16_t>::min(), std::numeric_limits<uint16_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedUInt16` with the given initial value and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like a `uint16_t` that does not overflow nor underflow when the maximum
-     * or minimum value it can represent is exceeded.
-     * 
-     * \param value the starting value of this number
-     */
-    ClampedNaturalNumber<uint16_t>(uint16_t value):
-        BasicClampedNumber(value, std::numeric_limits<uint16_t>::min(), std::numeric_limits<uint16_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedUInt16` with the given initial value and the
-     * specified lower and upper bounds. The minimum value must be less than or
-     * equal to the starting value: if it is not, it is itself clamped to the
-     * starting value. The maximum value is similarly constrained, and must be
-     * greater than or equal to the starting value.
-     * 
-     * \param value the starting value of this number
-     * \param min the minimum value for this number
-     * \param max the maximum value for this number
-     */
-    ClampedNaturalNumber<uint16_t>(uint16_t value, uint16_t min, uint16_t max):
-        BasicClampedNumber(value, min, max)
-    {}
-    
-    /**
-     * Provides a virtual destructor with the default dehavior.
-     */
-    virtual ~ClampedNaturalNumber<uint16_t>() = default;
-  };
-  
-  /** ClampedInteger<uint16_t> is aliased as ClampedUInt16, if it exists. */
-  using ClampedUInt16 = ClampedInteger<uint16_t>;
+  using ClampedUInt16 = ClampedNaturalNumber<uint16_t>;
   
 # endif
   
@@ -1536,63 +2159,11 @@ namespace clamped
    * defined if `uint32_t` from `<cstdint>`, upon which it relies, also exists.
    * If so, the macro `CLAMPED_UINT32` will also be defined.
    * 
-   * This type specialization provides no additional functions or operators:
-   * it only has a pair of additional constructors that don't ask for explicit
-   * lower and upper bounds. The default bounds are the minimum and maximum
-   * values the wrapped type can represent. Such a number will therefore behave
-   * much the same as the wrapped type, but without integer underflow
-   * or overflow.
+   * As with any builtin width, the bounds may be omitted, in which case they
+   * default to the limits of `uint32_t`: such a number behaves much the same as
+   * a `uint32_t`, but without integer underflow or overflow.
    */
-  template<>
-  class ClampedNaturalNumber<uint32_t>: public BasicClampedNumber<uint32_t>
-  {
-    public:
-    
-    /**
-     * Constructs a new `ClampedUInt32` with an initial value of zero and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like a `uint32_t` that does not overflow nor underflow when the maximum
-     * or minimum value it can represent is exceeded.
-     */
-    ClampedNaturalNumber<uint32_t>():
-        BasicClampedNumber(0, std::numeric_limits<uint32_t>::min(), std::numeric_limits<uint32_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedUInt32` with the given initial value and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like a `uint32_t` that does not overflow nor underflow when the maximum
-     * or minimum value it can represent is exceeded.
-     * 
-     * \param value the starting value of this number
-     */
-    ClampedNaturalNumber<uint32_t>(uint32_t value):
-        BasicClampedNumber(value, std::numeric_limits<uint32_t>::min(), std::numeric_limits<uint32_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedUInt32` with the given initial value and the
-     * specified lower and upper bounds. The minimum value must be less than or
-     * equal to the starting value: if it is not, it is itself clamped to the
-     * starting value. The maximum value is similarly constrained, and must be
-     * greater than or equal to the starting value.
-     * 
-     * \param value the starting value of this number
-     * \param min the minimum value for this number
-     * \param max the maximum value for this number
-     */
-    ClampedNaturalNumber<uint32_t>(uint32_t value, uint32_t min, uint32_t max):
-        BasicClampedNumber(value, min, max)
-    {}
-    
-    /**
-     * Provides a virtual destructor with the default dehavior.
-     */
-    virtual ~ClampedNaturalNumber<uint32_t>() = default;
-  };
-  
-  /** ClampedInteger<uint32_t> is aliased as ClampedUInt32, if it exists. */
-  using ClampedUInt32 = ClampedInteger<uint32_t>;
+  using ClampedUInt32 = ClampedNaturalNumber<uint32_t>;
   
 # endif
   
@@ -1604,64 +2175,11 @@ namespace clamped
    * defined if `uint64_t` from `<cstdint>`, upon which it relies, also exists.
    * If so, the macro `CLAMPED_UINT64` will also be defined.
    * 
-   * This type specialization provides no additional functions or operators:
-   * it only has a pair of additional constructors that don't ask for explicit
-   * lower and upper bounds. The default bounds are the minimum and maximum
-   * values the wrapped type can represent. Such a number will therefore behave
-   * much the same as the wrapped type, but without integer underflow
-   * or overflow.
+   * As with any builtin width, the bounds may be omitted, in which case they
+   * default to the limits of `uint64_t`: such a number behaves much the same as
+   * a `uint64_t`, but without integer underflow or overflow.
    */
-  template<>
-  class ClampedNaturalNumber<uint64_t>: public BasicClampedNumber<uint64_t>
-  {
-    public:
-    
-    /**
-     * Constructs a new `ClampedUInt64` with an initial value of zero and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like a `uint64_t` that does not overflow nor underflow when the maximum
-     * or minimum value it can represent is exceeded.
-     */
-    ClampedNaturalNumber<uint64_t>():
-        BasicClampedNumber(0, std::numeric_limits<uint64_t>::min(), std::numeric_limits<uint64_t>::max())
-    {}
-    
-    /**
-     * Constructs a new `ClampedUInt64` with the given initial value and no
-     * bounds. With these default bounds left intact, this number will thus act
-     * like a `uint64_t` that does not overflow nor underflow when the maximum
-     * or minimum value it can represent is exceeded.
-     * 
-     * \param value the starting value of this number
-     */
-    ClampedNaturalNumber<uint64_t>(uint64_t value) :
-        BasicClampedNumber(value, std::numeric_limits<uint64_t>::min(), std::numeric_limits<uint64_t>::max())
-    {
-    }
-    
-    /**
-     * Constructs a new `ClampedUInt64` with the given initial value and the
-     * specified lower and upper bounds. The minimum value must be less than or
-     * equal to the starting value: if it is not, it is itself clamped to the
-     * starting value. The maximum value is similarly constrained, and must be
-     * greater than or equal to the starting value.
-     * 
-     * \param value the starting value of this number
-     * \param min the minimum value for this number
-     * \param max the maximum value for this number
-     */
-    ClampedNaturalNumber<uint64_t>(uint64_t value, uint64_t min, uint64_t max):
-        BasicClampedNumber(value, min, max)
-    {}
-    
-    /**
-     * Provides a virtual destructor with the default dehavior.
-     */
-    virtual ~ClampedNaturalNumber<uint64_t>() = default;
-  };
-  
-  /** ClampedInteger<uint64_t> is aliased as ClampedUInt64, if it exists. */
-  using ClampedUInt64 = ClampedInteger<uint64_t>;
+  using ClampedUInt64 = ClampedNaturalNumber<uint64_t>;
   
 # endif
   
@@ -1686,3 +2204,13 @@ namespace clamped
   /** ClampedDecimal<long double> is aliased as ClampedLongDouble. */
   using ClampedLongDouble = ClampedDecimal<long double>;
 }
+
+// Either expose every member definition to the includer, or declare that the
+// common widths are instantiated once in the precompiled library
+
+#if defined(CLAMPED_HEADER_ONLY)
+#include "clamped_numbers.inl"
+#elif !defined(CLAMPED_EXTERN_TEMPLATE)
+#define CLAMPED_EXTERN_TEMPLATE extern
+#include "clamped_instantiations.inl"
+#endif
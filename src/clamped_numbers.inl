@@ -0,0 +1,270 @@
+/** \file
+ * The out-of-line member definitions for the clamped number templates.
+ * 
+ * This file is included by `clamped_numbers.hh` when `CLAMPED_HEADER_ONLY` is
+ * defined, making every operator visible to (and inlinable by) each
+ * translation unit. Otherwise the widths listed in `clamped_numbers.hh` are
+ * instantiated once in `clamped_numbers.cc`, and only code wrapping some other
+ * numeric type needs to include this file itself.
+ */
+
+#pragma once
+
+#include "clamped_numbers.hh"
+#include "clamp_kernels.hh"
+
+template<typename NumT>
+const NumT & clamped::BasicClampedNumber<NumT>::value(const NumT &newVal)
+{
+  detail::observe<NumT>(detail::Operation::ASSIGN,
+      detail::assignClamped(this->_value, newVal, this->_minValue, this->_maxValue));
+  return this->_value;
+}
+
+template<typename NumT>
+const NumT & clamped::BasicClampedNumber<NumT>::minValue(const NumT &newMin)
+{
+  return detail::stretchMinimum(this->_value, this->_minValue, newMin);
+}
+
+template<typename NumT>
+const NumT & clamped::BasicClampedNumber<NumT>::maxValue(const NumT &newMax)
+{
+  return detail::stretchMaximum(this->_value, this->_maxValue, newMax);
+}
+
+// ############################################### BasicClampedNumber ############################################### //
+// ################################################################################################################## //
+// ############################################## ClampedNaturalNumber ############################################## //
+
+template<typename NatT>
+clamped::ClampedNaturalNumber<NatT> & clamped::ClampedNaturalNumber<NatT>::operator+=(detail::ArgumentType<NatT> other)
+{
+  detail::observe<NatT>(detail::Operation::ADD,
+      detail::NaturalKernels<NatT>::add(this->_value, other, this->_minValue, this->_maxValue));
+  return *this;
+}
+
+template<typename NatT>
+clamped::ClampedNaturalNumber<NatT> & clamped::ClampedNaturalNumber<NatT>::operator-=(detail::ArgumentType<NatT> other)
+{
+  detail::observe<NatT>(detail::Operation::SUBTRACT,
+      detail::NaturalKernels<NatT>::subtract(this->_value, other, this->_minValue, this->_maxValue));
+  return *this;
+}
+
+template<typename NatT>
+clamped::ClampedNaturalNumber<NatT> & clamped::ClampedNaturalNumber<NatT>::operator*=(detail::ArgumentType<NatT> other)
+{
+  detail::observe<NatT>(detail::Operation::MULTIPLY,
+      detail::NaturalKernels<NatT>::multiply(this->_value, other, this->_minValue, this->_maxValue));
+  return *this;
+}
+
+template<typename NatT>
+clamped::ClampedNaturalNumber<NatT> & clamped::ClampedNaturalNumber<NatT>::operator/=(detail::ArgumentType<NatT> other)
+{
+  detail::observe<NatT>(detail::Operation::DIVIDE,
+      detail::NaturalKernels<NatT>::divide(this->_value, other, this->_minValue, this->_maxValue));
+  return *this;
+}
+
+template<typename NatT>
+clamped::ClampedNaturalNumber<NatT> & clamped::ClampedNaturalNumber<NatT>::operator%=(detail::ArgumentType<NatT> other)
+{
+  detail::observe<NatT>(detail::Operation::MODULO,
+      detail::NaturalKernels<NatT>::modulo(this->_value, other, this->_minValue, this->_maxValue));
+  return *this;
+}
+
+template<typename NatT>
+clamped::ClampResult<NatT> clamped::ClampedNaturalNumber<NatT>::addChecked(detail::ArgumentType<NatT> other)
+{
+  const ClampReaction reaction = detail::observe<NatT>(detail::Operation::ADD,
+      detail::NaturalKernels<NatT>::add(this->_value, other, this->_minValue, this->_maxValue));
+  return {this->_value, reaction};
+}
+
+template<typename NatT>
+clamped::ClampResult<NatT> clamped::ClampedNaturalNumber<NatT>::subtractChecked(detail::ArgumentType<NatT> other)
+{
+  const ClampReaction reaction = detail::observe<NatT>(detail::Operation::SUBTRACT,
+      detail::NaturalKernels<NatT>::subtract(this->_value, other, this->_minValue, this->_maxValue));
+  return {this->_value, reaction};
+}
+
+template<typename NatT>
+clamped::ClampResult<NatT> clamped::ClampedNaturalNumber<NatT>::multiplyChecked(detail::ArgumentType<NatT> other)
+{
+  const ClampReaction reaction = detail::observe<NatT>(detail::Operation::MULTIPLY,
+      detail::NaturalKernels<NatT>::multiply(this->_value, other, this->_minValue, this->_maxValue));
+  return {this->_value, reaction};
+}
+
+template<typename NatT>
+clamped::ClampResult<NatT> clamped::ClampedNaturalNumber<NatT>::divideChecked(detail::ArgumentType<NatT> other)
+{
+  const ClampReaction reaction = detail::observe<NatT>(detail::Operation::DIVIDE,
+      detail::NaturalKernels<NatT>::divide(this->_value, other, this->_minValue, this->_maxValue));
+  return {this->_value, reaction};
+}
+
+template<typename NatT>
+clamped::ClampResult<NatT> clamped::ClampedNaturalNumber<NatT>::moduloChecked(detail::ArgumentType<NatT> other)
+{
+  const ClampReaction reaction = detail::observe<NatT>(detail::Operation::MODULO,
+      detail::NaturalKernels<NatT>::modulo(this->_value, other, this->_minValue, this->_maxValue));
+  return {this->_value, reaction};
+}
+
+// ############################################## ClampedNaturalNumber ############################################## //
+// ################################################################################################################## //
+// ################################################# ClampedInteger ################################################# //
+
+template<typename IntT>
+clamped::ClampedInteger<IntT> & clamped::ClampedInteger<IntT>::operator+=(detail::ArgumentType<IntT> other)
+{
+  detail::observe<IntT>(detail::Operation::ADD,
+      detail::IntegerKernels<IntT>::add(this->_value, other, this->_minValue, this->_maxValue));
+  return *this;
+}
+
+template<typename IntT>
+clamped::ClampedInteger<IntT> & clamped::ClampedInteger<IntT>::operator-=(detail::ArgumentType<IntT> other)
+{
+  detail::observe<IntT>(detail::Operation::SUBTRACT,
+      detail::IntegerKernels<IntT>::subtract(this->_value, other, this->_minValue, this->_maxValue));
+  return *this;
+}
+
+template<typename IntT>
+clamped::ClampedInteger<IntT> & clamped::ClampedInteger<IntT>::operator*=(detail::ArgumentType<IntT> other)
+{
+  detail::observe<IntT>(detail::Operation::MULTIPLY,
+      detail::IntegerKernels<IntT>::multiply(this->_value, other, this->_minValue, this->_maxValue));
+  return *this;
+}
+
+template<typename IntT>
+clamped::ClampedInteger<IntT> & clamped::ClampedInteger<IntT>::operator/=(detail::ArgumentType<IntT> other)
+{
+  detail::observe<IntT>(detail::Operation::DIVIDE,
+      detail::IntegerKernels<IntT>::divide(this->_value, other, this->_minValue, this->_maxValue));
+  return *this;
+}
+
+template<typename IntT>
+clamped::ClampedInteger<IntT> & clamped::ClampedInteger<IntT>::operator%=(detail::ArgumentType<IntT> other)
+{
+  detail::observe<IntT>(detail::Operation::MODULO,
+      detail::IntegerKernels<IntT>::modulo(this->_value, other, this->_minValue, this->_maxValue));
+  return *this;
+}
+
+template<typename IntT>
+clamped::ClampResult<IntT> clamped::ClampedInteger<IntT>::addChecked(detail::ArgumentType<IntT> other)
+{
+  const ClampReaction reaction = detail::observe<IntT>(detail::Operation::ADD,
+      detail::IntegerKernels<IntT>::add(this->_value, other, this->_minValue, this->_maxValue));
+  return {this->_value, reaction};
+}
+
+template<typename IntT>
+clamped::ClampResult<IntT> clamped::ClampedInteger<IntT>::subtractChecked(detail::ArgumentType<IntT> other)
+{
+  const ClampReaction reaction = detail::observe<IntT>(detail::Operation::SUBTRACT,
+      detail::IntegerKernels<IntT>::subtract(this->_value, other, this->_minValue, this->_maxValue));
+  return {this->_value, reaction};
+}
+
+template<typename IntT>
+clamped::ClampResult<IntT> clamped::ClampedInteger<IntT>::multiplyChecked(detail::ArgumentType<IntT> other)
+{
+  const ClampReaction reaction = detail::observe<IntT>(detail::Operation::MULTIPLY,
+      detail::IntegerKernels<IntT>::multiply(this->_value, other, this->_minValue, this->_maxValue));
+  return {this->_value, reaction};
+}
+
+template<typename IntT>
+clamped::ClampResult<IntT> clamped::ClampedInteger<IntT>::divideChecked(detail::ArgumentType<IntT> other)
+{
+  const ClampReaction reaction = detail::observe<IntT>(detail::Operation::DIVIDE,
+      detail::IntegerKernels<IntT>::divide(this->_value, other, this->_minValue, this->_maxValue));
+  return {this->_value, reaction};
+}
+
+template<typename IntT>
+clamped::ClampResult<IntT> clamped::ClampedInteger<IntT>::moduloChecked(detail::ArgumentType<IntT> other)
+{
+  const ClampReaction reaction = detail::observe<IntT>(detail::Operation::MODULO,
+      detail::IntegerKernels<IntT>::modulo(this->_value, other, this->_minValue, this->_maxValue));
+  return {this->_value, reaction};
+}
+
+// ################################################# ClampedInteger ################################################# //
+// ################################################################################################################## //
+// ################################################# ClampedDecimal ################################################# //
+
+template<typename FloatT>
+clamped::ClampedDecimal<FloatT> & clamped::ClampedDecimal<FloatT>::operator+=(detail::ArgumentType<FloatT> other)
+{
+  detail::observe<FloatT>(detail::Operation::ADD,
+      detail::DecimalKernels<FloatT>::add(this->_value, other, this->_minValue, this->_maxValue));
+  return *this;
+}
+
+template<typename FloatT>
+clamped::ClampedDecimal<FloatT> & clamped::ClampedDecimal<FloatT>::operator-=(detail::ArgumentType<FloatT> other)
+{
+  detail::observe<FloatT>(detail::Operation::SUBTRACT,
+      detail::DecimalKernels<FloatT>::subtract(this->_value, other, this->_minValue, this->_maxValue));
+  return *this;
+}
+
+template<typename FloatT>
+clamped::ClampedDecimal<FloatT> & clamped::ClampedDecimal<FloatT>::operator*=(detail::ArgumentType<FloatT> other)
+{
+  detail::observe<FloatT>(detail::Operation::MULTIPLY,
+      detail::DecimalKernels<FloatT>::multiply(this->_value, other, this->_minValue, this->_maxValue));
+  return *this;
+}
+
+template<typename FloatT>
+clamped::ClampedDecimal<FloatT> & clamped::ClampedDecimal<FloatT>::operator/=(detail::ArgumentType<FloatT> other)
+{
+  detail::observe<FloatT>(detail::Operation::DIVIDE,
+      detail::DecimalKernels<FloatT>::divide(this->_value, other, this->_minValue, this->_maxValue));
+  return *this;
+}
+
+template<typename FloatT>
+clamped::ClampResult<FloatT> clamped::ClampedDecimal<FloatT>::addChecked(detail::ArgumentType<FloatT> other)
+{
+  const ClampReaction reaction = detail::observe<FloatT>(detail::Operation::ADD,
+      detail::DecimalKernels<FloatT>::add(this->_value, other, this->_minValue, this->_maxValue));
+  return {this->_value, reaction};
+}
+
+template<typename FloatT>
+clamped::ClampResult<FloatT> clamped::ClampedDecimal<FloatT>::subtractChecked(detail::ArgumentType<FloatT> other)
+{
+  const ClampReaction reaction = detail::observe<FloatT>(detail::Operation::SUBTRACT,
+      detail::DecimalKernels<FloatT>::subtract(this->_value, other, this->_minValue, this->_maxValue));
+  return {this->_value, reaction};
+}
+
+template<typename FloatT>
+clamped::ClampResult<FloatT> clamped::ClampedDecimal<FloatT>::multiplyChecked(detail::ArgumentType<FloatT> other)
+{
+  const ClampReaction reaction = detail::observe<FloatT>(detail::Operation::MULTIPLY,
+      detail::DecimalKernels<FloatT>::multiply(this->_value, other, this->_minValue, this->_maxValue));
+  return {this->_value, reaction};
+}
+
+template<typename FloatT>
+clamped::ClampResult<FloatT> clamped::ClampedDecimal<FloatT>::divideChecked(detail::ArgumentType<FloatT> other)
+{
+  const ClampReaction reaction = detail::observe<FloatT>(detail::Operation::DIVIDE,
+      detail::DecimalKernels<FloatT>::divide(this->_value, other, this->_minValue, this->_maxValue));
+  return {this->_value, reaction};
+}
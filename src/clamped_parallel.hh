@@ -0,0 +1,523 @@
+/** \file
+ * Bulk operations over `ClampedArray`s spread across many threads.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "clamp_kernels.hh"
+#include "clamped_array.hh"
+#include "clamped_batch.hh"
+#include "clamped_reduce.hh"
+
+namespace clamped
+{
+  /**
+   * Bulk operations on `ClampedArray`s too large for one thread, such as
+   * arrays of hundreds of millions of elements. Each operation splits the
+   * array into one contiguous chunk per thread of a `Pool`, runs the
+   * vectorized batch kernels over every chunk at once, and returns when all
+   * of them are done. Every element saturates exactly as it would under the
+   * array's own operators.
+   * 
+   * Chunking is static: an array is always split the same way for a given
+   * pool, each chunk begins on a cache line, and chunk `i` always runs on the
+   * pool's thread `i`. Repeated passes over one array thus keep each portion
+   * of it in the same thread's caches, and on the same memory node as that
+   * thread where the operating system keeps threads in place. Arrays too
+   * small to be worth splitting run on the calling thread alone.
+   */
+  namespace parallel
+  {
+    /**
+     * A fixed set of threads which run the chunks of bulk operations. The
+     * calling thread takes part as thread zero, so a pool of `n` threads
+     * starts `n - 1` of its own, once, and keeps them waiting between
+     * operations rather than starting threads on every call.
+     * 
+     * Operations on one pool run one at a time: a thread calling `run()`
+     * while another's is in progress waits for it to finish. A task run by a
+     * pool must not itself run tasks on the same pool.
+     */
+    class Pool
+    {
+      // The tasks of one call to run(), erased of their type
+      struct Job
+      {
+        void (*invoke)(void *, std::size_t);
+        void *function;
+        std::size_t tasks;
+      };
+      
+      std::vector<std::thread> _workers;
+      std::mutex _runMutex;
+      std::mutex _mutex;
+      std::condition_variable _started;
+      std::condition_variable _finished;
+      Job _job;
+      uint64_t _generation;
+      std::size_t _pending;
+      bool _stopping;
+      
+      public:
+      
+      /**
+       * Constructs a new `Pool` of the given number of threads, including
+       * the calling thread, starting the rest.
+       * 
+       * \param threadCount the number of threads which run each operation,
+       * by default one per hardware thread
+       */
+      explicit Pool(std::size_t threadCount = defaultThreadCount()):
+          _job{nullptr, nullptr, 0}, _generation(0), _pending(0), _stopping(false)
+      {
+        for(std::size_t i = 1; i < threadCount; ++i)
+          this->_workers.emplace_back(&Pool::work, this, i);
+      }
+      
+      /**
+       * Pools are neither copyable nor movable, as their threads refer to
+       * them.
+       */
+      Pool(const Pool &) = delete;
+      
+      /**
+       * Pools are neither copyable nor movable, as their threads refer to
+       * them.
+       */
+      Pool & operator=(const Pool &) = delete;
+      
+      /**
+       * Stops and joins every thread this pool started.
+       */
+      ~Pool()
+      {
+        {
+          std::lock_guard<std::mutex> lock(this->_mutex);
+          this->_stopping = true;
+        }
+        
+        this->_started.notify_all();
+        for(std::thread &worker : this->_workers)
+          worker.join();
+      }
+      
+      public:
+      
+      /**
+       * Returns the number of threads used when none is given: one per
+       * hardware thread, as reported by the standard library.
+       * 
+       * \return Returns the default number of threads.
+       */
+      static std::size_t defaultThreadCount()
+      {
+        const unsigned int threads = std::thread::hardware_concurrency();
+        return threads ? threads : 1;
+      }
+      
+      /**
+       * Returns the pool used by bulk operations when none is given, of the
+       * default number of threads, which is started on first use and stopped
+       * as the program exits.
+       * 
+       * \return Returns the shared pool.
+       */
+      static Pool & shared()
+      {
+        static Pool pool;
+        return pool;
+      }
+      
+      /**
+       * Returns the number of threads which run each operation, including
+       * the calling thread.
+       * 
+       * \return Returns the number of threads in this pool.
+       */
+      std::size_t threadCount() const
+      {
+        return this->_workers.size() + 1;
+      }
+      
+      /**
+       * Calls `function(i)` for every task index `i` below `tasks`, spread
+       * statically across this pool's threads: thread `t` runs tasks `t`,
+       * `t + threadCount()`, and so on, in order. Returns once every task is
+       * done. A single task runs on the calling thread without waking any
+       * other.
+       * 
+       * \param tasks the number of tasks to run
+       * \param function the task to run, which must not throw
+       */
+      template<typename FnT>
+      void run(std::size_t tasks, FnT &&function)
+      {
+        using FunctionT = typename std::remove_reference<FnT>::type;
+        if(tasks <= 1 || this->_workers.empty()) {
+          for(std::size_t i = 0; i < tasks; ++i)
+            function(i);
+          return;
+        }
+        
+        std::lock_guard<std::mutex> running(this->_runMutex);
+        const Job job = {[](void *fn, std::size_t task) { (*static_cast<FunctionT *>(fn))(task); },
+            const_cast<void *>(static_cast<const void *>(&function)), tasks};
+        {
+          std::lock_guard<std::mutex> lock(this->_mutex);
+          this->_job = job;
+          this->_pending = this->_workers.size();
+          ++this->_generation;
+        }
+        
+        this->_started.notify_all();
+        this->share(job, 0);
+        
+        std::unique_lock<std::mutex> lock(this->_mutex);
+        this->_finished.wait(lock, [this]() { return this->_pending == 0; });
+      }
+      
+      private:
+      
+      // Runs one thread's share of a job's tasks
+      void share(const Job &job, std::size_t thread) const
+      {
+        for(std::size_t task = thread; task < job.tasks; task += this->threadCount())
+          job.invoke(job.function, task);
+      }
+      
+      // The loop of each started thread, which runs its share of every job
+      void work(std::size_t thread)
+      {
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(this->_mutex);
+        for(;;) {
+          this->_started.wait(lock, [&]() { return this->_stopping || this->_generation != seen; });
+          if(this->_stopping)
+            return;
+          
+          seen = this->_generation;
+          const Job job = this->_job;
+          lock.unlock();
+          this->share(job, thread);
+          lock.lock();
+          if(--this->_pending == 0)
+            this->_finished.notify_one();
+        }
+      }
+    };
+    
+    /**
+     * The least number of elements given to any one thread: arrays with
+     * fewer elements than this per thread are split into fewer chunks, and
+     * those smaller than it run on the calling thread alone.
+     */
+    constexpr std::size_t minimumChunk = std::size_t(1) << 15;
+  }
+  
+  namespace detail
+  {
+    struct ArrayAccess
+    {
+      template<typename NumT>
+      static NumT * values(ClampedArray<NumT> &array) { return array._values.data(); }
+      
+      template<typename NumT>
+      static NumT * minValues(ClampedArray<NumT> &array) { return array._minValues.data(); }
+      
+      template<typename NumT>
+      static NumT * maxValues(ClampedArray<NumT> &array) { return array._maxValues.data(); }
+      
+      template<typename NumT>
+      static void sharedBounds(ClampedArray<NumT> &array, const NumT &min, const NumT &max)
+      {
+        array._sharedMin = min;
+        array._sharedMax = max;
+      }
+    };
+    
+    // The number of chunks an array of count elements is split into
+    inline std::size_t chunkCount(std::size_t count, const parallel::Pool &pool)
+    {
+      const std::size_t wanted = (count + parallel::minimumChunk - 1) / parallel::minimumChunk;
+      return (wanted < pool.threadCount()) ? (wanted ? wanted : 1) : pool.threadCount();
+    }
+    
+    // The elements [begin, end) of the index-th of chunks chunks: every
+    // chunk but the last holds a whole number of cache lines
+    template<typename NumT>
+    std::pair<std::size_t, std::size_t> chunkRange(std::size_t count, std::size_t chunks, std::size_t index)
+    {
+      const std::size_t line = (sizeof(NumT) < 64) ? 64 / sizeof(NumT) : 1;
+      const std::size_t lines = ((count + chunks - 1) / chunks + line - 1) / line;
+      const std::size_t begin = (index * lines * line < count) ? index * lines * line : count;
+      const std::size_t end = (count - begin > lines * line) ? begin + lines * line : count;
+      return {begin, end};
+    }
+    
+    // Calls function(index, begin, end) over every chunk of an array of
+    // count elements, across the pool's threads
+    template<typename NumT, typename FnT>
+    void forEachChunk(std::size_t count, parallel::Pool &pool, FnT function)
+    {
+      const std::size_t chunks = chunkCount(count, pool);
+      pool.run(chunks, [&](std::size_t index) {
+        const std::pair<std::size_t, std::size_t> range = chunkRange<NumT>(count, chunks, index);
+        if(range.first < range.second)
+          function(index, range.first, range.second);
+      });
+    }
+    
+    // Applies one batch operation to every element of an array in parallel,
+    // through the shared- or per-lane-bounds form of the operation
+    template<typename NumT>
+    void applyParallel(ClampedArray<NumT> &array, const NumT &other, parallel::Pool &pool,
+        void (*shared)(NumT *, std::size_t, NumT, NumT, NumT),
+        void (*lanes)(NumT *, std::size_t, NumT, const NumT *, const NumT *))
+    {
+      NumT *values = ArrayAccess::values(array);
+      const NumT *mins = ArrayAccess::minValues(array), *maxs = ArrayAccess::maxValues(array);
+      forEachChunk<NumT>(array.size(), pool, [&](std::size_t, std::size_t begin, std::size_t end) {
+        if(array.layout() == BoundsLayout::SHARED)
+          shared(values + begin, end - begin, other, array.minValue(0), array.maxValue(0));
+        else
+          lanes(values + begin, end - begin, other, mins + begin, maxs + begin);
+      });
+    }
+  }
+  
+  namespace parallel
+  {
+    /**
+     * Adds the given number to every element of the array, as constrained
+     * by their bounds, across the threads of a pool.
+     * 
+     * \param array the array to modify
+     * \param other the right operand for addition
+     * \param pool the threads over which to split the array
+     */
+    template<typename NumT>
+    void add(ClampedArray<NumT> &array, const NumT &other, Pool &pool = Pool::shared())
+    {
+      const detail::BatchTable<NumT> &table = detail::activeBatchTable<NumT>();
+      detail::applyParallel(array, other, pool, table.add, table.addLanes);
+    }
+    
+    /**
+     * Subtracts the given number from every element of the array, as
+     * constrained by their bounds, across the threads of a pool.
+     * 
+     * \param array the array to modify
+     * \param other the right operand for subtraction
+     * \param pool the threads over which to split the array
+     */
+    template<typename NumT>
+    void subtract(ClampedArray<NumT> &array, const NumT &other, Pool &pool = Pool::shared())
+    {
+      const detail::BatchTable<NumT> &table = detail::activeBatchTable<NumT>();
+      detail::applyParallel(array, other, pool, table.subtract, table.subtractLanes);
+    }
+    
+    /**
+     * Multiplies every element of the array by the number given, as
+     * constrained by their bounds, across the threads of a pool.
+     * 
+     * \param array the array to modify
+     * \param other the right operand for multiplication
+     * \param pool the threads over which to split the array
+     */
+    template<typename NumT>
+    void multiply(ClampedArray<NumT> &array, const NumT &other, Pool &pool = Pool::shared())
+    {
+      const detail::BatchTable<NumT> &table = detail::activeBatchTable<NumT>();
+      detail::applyParallel(array, other, pool, table.multiply, table.multiplyLanes);
+    }
+    
+    /**
+     * Divides every element of the array by the number given, as
+     * constrained by their bounds, across the threads of a pool. Division by
+     * zero yields each element's maximum or minimum, depending on the sign
+     * of its value prior to division.
+     * 
+     * \param array the array to modify
+     * \param other the right operand for division
+     * \param pool the threads over which to split the array
+     */
+    template<typename NumT>
+    void divide(ClampedArray<NumT> &array, const NumT &other, Pool &pool = Pool::shared())
+    {
+      const detail::BatchTable<NumT> &table = detail::activeBatchTable<NumT>();
+      detail::applyParallel(array, other, pool, table.divide, table.divideLanes);
+    }
+    
+    /**
+     * Sets the value of every element of the array from the given array of
+     * `size()` values, each clamped into its element's bounds, across the
+     * threads of a pool.
+     * 
+     * \param array the array to modify
+     * \param newValues the new values, which may be `array.values()` itself
+     * \param pool the threads over which to split the array
+     */
+    template<typename NumT>
+    void assign(ClampedArray<NumT> &array, const NumT *newValues, Pool &pool = Pool::shared())
+    {
+      const detail::BatchTable<NumT> &table = detail::activeBatchTable<NumT>();
+      NumT *values = detail::ArrayAccess::values(array);
+      const NumT *mins = array.minValues(), *maxs = array.maxValues();
+      detail::forEachChunk<NumT>(array.size(), pool, [&](std::size_t, std::size_t begin, std::size_t end) {
+        if(array.layout() == BoundsLayout::SHARED)
+          table.set(values + begin, newValues + begin, end - begin, array.minValue(0), array.maxValue(0));
+        else
+          table.setLanes(values + begin, newValues + begin, end - begin, mins + begin, maxs + begin);
+      });
+    }
+    
+    /**
+     * Gives every element of the array the same new bounds, clamping each
+     * value into them, across the threads of a pool. Unlike the setters of
+     * single bounds, this never stretches the bounds to admit a value: an
+     * element outside them is moved to the nearer bound. The layout of the
+     * array is kept, so that under `BoundsLayout::PER_LANE` every lane is
+     * given the new bounds. Bounds given in the wrong order are swapped.
+     * 
+     * \param array the array to modify
+     * \param min the new minimum of every element
+     * \param max the new maximum of every element
+     * \param pool the threads over which to split the array
+     */
+    template<typename NumT>
+    void rebound(ClampedArray<NumT> &array, const NumT &min, const NumT &max, Pool &pool = Pool::shared())
+    {
+      const detail::BatchTable<NumT> &table = detail::activeBatchTable<NumT>();
+      const NumT lower = (min <= max) ? min : max, upper = (min <= max) ? max : min;
+      detail::ArrayAccess::sharedBounds(array, lower, upper);
+      
+      NumT *values = detail::ArrayAccess::values(array);
+      NumT *mins = detail::ArrayAccess::minValues(array), *maxs = detail::ArrayAccess::maxValues(array);
+      detail::forEachChunk<NumT>(array.size(), pool, [&](std::size_t, std::size_t begin, std::size_t end) {
+        if(array.layout() == BoundsLayout::PER_LANE)
+          for(std::size_t i = begin; i < end; ++i) {
+            mins[i] = lower;
+            maxs[i] = upper;
+          }
+        
+        table.set(values + begin, values + begin, end - begin, lower, upper);
+      });
+    }
+    
+    /**
+     * Returns the least value of any element of the array, which must not
+     * be empty, searching its chunks across the threads of a pool.
+     * 
+     * \param array the array to search
+     * \param pool the threads over which to split the array
+     * \return Returns the array's least value.
+     */
+    template<typename NumT>
+    NumT minimum(const ClampedArray<NumT> &array, Pool &pool = Pool::shared())
+    {
+      const NumT *values = array.values();
+      std::vector<NumT> partials(detail::chunkCount(array.size(), pool), values[0]);
+      detail::forEachChunk<NumT>(array.size(), pool, [&](std::size_t index, std::size_t begin, std::size_t end) {
+        NumT least = values[begin];
+        for(std::size_t i = begin + 1; i < end; ++i)
+          least = (values[i] < least) ? values[i] : least;
+        
+        partials[index] = least;
+      });
+      
+      NumT least = partials[0];
+      for(const NumT &partial : partials)
+        least = (partial < least) ? partial : least;
+      
+      return least;
+    }
+    
+    /**
+     * Returns the greatest value of any element of the array, which must not
+     * be empty, searching its chunks across the threads of a pool.
+     * 
+     * \param array the array to search
+     * \param pool the threads over which to split the array
+     * \return Returns the array's greatest value.
+     */
+    template<typename NumT>
+    NumT maximum(const ClampedArray<NumT> &array, Pool &pool = Pool::shared())
+    {
+      const NumT *values = array.values();
+      std::vector<NumT> partials(detail::chunkCount(array.size(), pool), values[0]);
+      detail::forEachChunk<NumT>(array.size(), pool, [&](std::size_t index, std::size_t begin, std::size_t end) {
+        NumT greatest = values[begin];
+        for(std::size_t i = begin + 1; i < end; ++i)
+          greatest = (values[i] > greatest) ? values[i] : greatest;
+        
+        partials[index] = greatest;
+      });
+      
+      NumT greatest = partials[0];
+      for(const NumT &partial : partials)
+        greatest = (partial > greatest) ? partial : greatest;
+      
+      return greatest;
+    }
+    
+    /**
+     * Returns the sum of every element of the array, clamped into the given
+     * bounds, summing its chunks across the threads of a pool.
+     * 
+     * The sum is exact, and clamped once: each chunk is summed in a type
+     * wider than `NumT`, `int64_t` or `uint64_t` for integers of up to 32
+     * bits and the 128-bit integers for 64-bit ones, the chunks' sums are
+     * added together in that type, and only their total is clamped into
+     * `[min, max]`. This is the sum `ClampPolicy::AT_END` would give, and
+     * does not depend on how the array is chunked; it differs from adding
+     * the elements in turn to a clamped number, which would saturate at
+     * each step. Where the compiler has no 128-bit integers, 64-bit sums
+     * saturate at the limits of `NumT` itself, within each chunk and then
+     * across them, and so are exact only while every partial sum lies
+     * within those limits. Floating-point elements are summed in
+     * `long double`, chunk by chunk, so that rounding, though slight, may
+     * depend on the number of threads.
+     * 
+     * \param array the array to sum
+     * \param min the minimum value of the sum
+     * \param max the maximum value of the sum
+     * \param pool the threads over which to split the array
+     * \return Returns the clamped sum, and how it was clamped.
+     */
+    template<typename NumT>
+    ClampResult<NumT> sum(const ClampedArray<NumT> &array, const NumT &min, const NumT &max,
+        Pool &pool = Pool::shared())
+    {
+      static_assert(std::is_arithmetic<NumT>::value, "parallel::sum requires an arithmetic NumT");
+      
+      using AccT = typename detail::SumAccumulator<NumT>::type;
+      const NumT *values = array.values();
+      std::vector<AccT> partials(detail::chunkCount(array.size(), pool), AccT(0));
+      detail::forEachChunk<NumT>(array.size(), pool, [&](std::size_t index, std::size_t begin, std::size_t end) {
+        partials[index] = detail::sumChunk<NumT, AccT>(values + begin, end - begin);
+      });
+      
+      AccT total = 0;
+      for(const AccT &partial : partials)
+        detail::ClampKernels<AccT>::add(total, partial, std::numeric_limits<AccT>::lowest(),
+            std::numeric_limits<AccT>::max());
+      
+      const NumT lower = (min <= max) ? min : max, upper = (min <= max) ? max : min;
+      NumT result = lower;
+      const ClampReaction reaction = detail::clampIntermediate(result, total, lower, upper);
+      return {result, reaction};
+    }
+  }
+}
@@ -0,0 +1,332 @@
+/** \file
+ * Contiguous allocation of heap-held clamped numbers, freed all at once.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+# if __has_include(<memory_resource>)
+#   include <memory_resource>
+#   define CLAMPED_HAS_PMR
+# endif
+#endif
+
+#include "clamped_numbers.hh"
+
+namespace clamped
+{
+  /**
+   * Allocates and constructs one clamped number of type `ClampedT` through
+   * the given allocator, which is rebound to `ClampedT`. This accepts any
+   * standard allocator, including `std::pmr::polymorphic_allocator` and a
+   * `ClampedNumberPool` viewed through one.
+   * 
+   * \param alloc the allocator from which to allocate the number
+   * \param args the arguments with which to construct the number
+   * \return Returns a pointer to the new number.
+   * 
+   * \see deallocateClamped()
+   */
+  template<typename ClampedT, typename AllocT, typename... ArgTs>
+  ClampedT * allocateClamped(const AllocT &alloc, ArgTs &&... args)
+  {
+    using Traits = typename std::allocator_traits<AllocT>::template rebind_traits<ClampedT>;
+    typename Traits::allocator_type rebound(alloc);
+    ClampedT *number = Traits::allocate(rebound, 1);
+    Traits::construct(rebound, number, std::forward<ArgTs>(args)...);
+    return number;
+  }
+  
+  /**
+   * Destroys and deallocates a clamped number made by `allocateClamped()`
+   * through an allocator equal to the given one. `ClampedT` must be the type
+   * the number was allocated as, not merely a base of it, as allocators need
+   * the size of what they free.
+   * 
+   * \param alloc the allocator through which the number was allocated
+   * \param number the number to destroy, which may be null
+   */
+  template<typename ClampedT, typename AllocT>
+  void deallocateClamped(const AllocT &alloc, ClampedT *number)
+  {
+    if(!number)
+      return;
+    
+    using Traits = typename std::allocator_traits<AllocT>::template rebind_traits<ClampedT>;
+    typename Traits::allocator_type rebound(alloc);
+    Traits::destroy(rebound, number);
+    Traits::deallocate(rebound, number, 1);
+  }
+  
+  namespace detail
+  {
+    // The interface through which a pool is offered to std::pmr, where the
+    // standard library has one
+#   ifdef CLAMPED_HAS_PMR
+    using PoolResource = std::pmr::memory_resource;
+#   else
+    struct PoolResource
+    {};
+#   endif
+    
+    // Whether a pool may skip destroying a ClampedT: only where it is one of
+    // the library's own types, which add no members, over a trivially
+    // destructible NumT. Every other type is recorded and destroyed.
+    template<typename ClampedT, typename NumT>
+    struct DestroysTrivially: std::integral_constant<bool, std::is_trivially_destructible<NumT>::value
+        && (std::is_same<ClampedT, BasicClampedNumber<NumT>>::value
+        || std::is_same<ClampedT, ClampedInteger<NumT>>::value
+        || std::is_same<ClampedT, ClampedNaturalNumber<NumT>>::value
+        || std::is_same<ClampedT, ClampedDecimal<NumT>>::value)>
+    {};
+  }
+  
+  /**
+   * A monotonic arena of clamped numbers wrapping `NumT`, for programs
+   * holding many of them polymorphically: `create()` places each number
+   * directly after the last in large blocks of memory, so they lie
+   * contiguously, rather than making a separate allocation for each.
+   * Numbers are never freed singly; `release()` and the destructor free
+   * every one at once.
+   * 
+   * Blocks grow geometrically, each twice the size of the one before, so
+   * that `n` numbers take only `O(log n)` calls to the upstream allocator,
+   * and freeing them takes as many again. Where `NumT` is trivially
+   * destructible, as are every builtin type, the library's own clamped
+   * types are not destroyed individually either, so teardown does no work
+   * per number. Any other type, such as a derived clamped type holding
+   * members of its own, and every number of other `NumT`, is destroyed in
+   * reverse order of creation.
+   * 
+   * Where the standard library offers `<memory_resource>` (from C++17), a
+   * pool draws its blocks from any upstream `std::pmr::memory_resource`,
+   * and is itself one, so that a `std::pmr::polymorphic_allocator` over it
+   * may be given to `allocateClamped()` or to a container. Memory allocated
+   * that way is likewise reclaimed only on release, and objects constructed
+   * in it are not destroyed by the pool. A pool is not safe to use from
+   * several threads at once.
+   * 
+   * \param NumT the numeric type wrapped by the clamped numbers in the pool
+   */
+  template<typename NumT>
+  class ClampedNumberPool: public detail::PoolResource
+  {
+    // The header of each block, linking it to the one allocated before
+    struct Block
+    {
+      Block *previous;
+      std::size_t size;
+    };
+    
+    // The bookkeeping placed before each number which needs destruction
+    struct Record
+    {
+      Record *previous;
+      BasicClampedNumber<NumT> *number;
+    };
+    
+    Block *_blocks;
+    char *_cursor;
+    char *_end;
+    Record *_records;
+    std::size_t _count;
+    std::size_t _nextBlockSize;
+#   ifdef CLAMPED_HAS_PMR
+    std::pmr::memory_resource *_upstream;
+#   endif
+    
+    public:
+    
+    /** The size in bytes of the first block a pool allocates by default. */
+    static constexpr std::size_t defaultBlockSize = 4096;
+    
+    /**
+     * Constructs a new, empty `ClampedNumberPool`, which allocates nothing
+     * until its first number is created.
+     * 
+     * \param blockSize the size in bytes of the first block to allocate
+     */
+    explicit ClampedNumberPool(std::size_t blockSize = defaultBlockSize):
+        _blocks(nullptr), _cursor(nullptr), _end(nullptr), _records(nullptr), _count(0),
+        _nextBlockSize(blockSize ? blockSize : defaultBlockSize)
+#   ifdef CLAMPED_HAS_PMR
+        , _upstream(std::pmr::get_default_resource())
+#   endif
+    {}
+    
+#   ifdef CLAMPED_HAS_PMR
+    /**
+     * Constructs a new, empty `ClampedNumberPool` which draws its blocks
+     * from the given memory resource.
+     * 
+     * \param upstream the resource from which to allocate blocks
+     * \param blockSize the size in bytes of the first block to allocate
+     */
+    explicit ClampedNumberPool(std::pmr::memory_resource *upstream, std::size_t blockSize = defaultBlockSize):
+        ClampedNumberPool(blockSize)
+    {
+      this->_upstream = upstream;
+    }
+#   endif
+    
+    /**
+     * Pools are neither copyable nor movable, as the numbers within them
+     * would be left behind.
+     */
+    ClampedNumberPool(const ClampedNumberPool &) = delete;
+    
+    /**
+     * Pools are neither copyable nor movable, as the numbers within them
+     * would be left behind.
+     */
+    ClampedNumberPool & operator=(const ClampedNumberPool &) = delete;
+    
+    /**
+     * Frees every number in this pool, as `release()` does.
+     */
+    ~ClampedNumberPool()
+    {
+      this->release();
+    }
+    
+    /**
+     * Constructs a new clamped number of type `ClampedT` in this pool. The
+     * number remains valid until the pool is released or destroyed, and
+     * must not be deleted.
+     * 
+     * \param args the arguments with which to construct the number
+     * \return Returns a pointer to the new number.
+     */
+    template<typename ClampedT, typename... ArgTs>
+    ClampedT * create(ArgTs &&... args)
+    {
+      static_assert(std::is_base_of<BasicClampedNumber<NumT>, ClampedT>::value,
+          "ClampedNumberPool holds only clamped numbers wrapping its NumT");
+      
+      const bool recorded = !detail::DestroysTrivially<ClampedT, NumT>::value;
+      void *record = recorded ? this->bump(sizeof(Record), alignof(Record)) : nullptr;
+      ClampedT *number = new(this->bump(sizeof(ClampedT), alignof(ClampedT))) ClampedT(std::forward<ArgTs>(args)...);
+      if(recorded)
+        this->_records = new(record) Record{this->_records, number};
+      
+      ++this->_count;
+      return number;
+    }
+    
+    /**
+     * Returns the number of clamped numbers created in this pool since it
+     * was constructed or last released.
+     * 
+     * \return Returns the number of live numbers in this pool.
+     */
+    std::size_t size() const
+    {
+      return this->_count;
+    }
+    
+    /**
+     * Returns the number of blocks this pool holds from its upstream
+     * allocator.
+     * 
+     * \return Returns the number of blocks allocated.
+     */
+    std::size_t blockCount() const
+    {
+      std::size_t blocks = 0;
+      for(const Block *block = this->_blocks; block; block = block->previous)
+        ++blocks;
+      
+      return blocks;
+    }
+    
+    /**
+     * Destroys every number in this pool which needs destruction, then
+     * returns every block to the upstream allocator, invalidating every
+     * pointer into the pool. The pool may be used again afterwards.
+     */
+    void release()
+    {
+      for(Record *record = this->_records; record; record = record->previous)
+        record->number->~BasicClampedNumber<NumT>();
+      
+      while(this->_blocks) {
+        Block *block = this->_blocks;
+        this->_blocks = block->previous;
+        this->freeBlock(block, block->size);
+      }
+      
+      this->_cursor = this->_end = nullptr;
+      this->_records = nullptr;
+      this->_count = 0;
+    }
+    
+    private:
+    
+    // Returns size bytes aligned to align from the current block, allocating
+    // a new block where it has too little room left
+    void * bump(std::size_t size, std::size_t align)
+    {
+      std::uintptr_t start = (reinterpret_cast<std::uintptr_t>(this->_cursor) + align - 1) & ~std::uintptr_t(align - 1);
+      if(!this->_cursor || start + size > reinterpret_cast<std::uintptr_t>(this->_end)) {
+        const std::size_t needed = sizeof(Block) + size + align;
+        const std::size_t blockSize = (this->_nextBlockSize > needed) ? this->_nextBlockSize : needed;
+        Block *block = static_cast<Block *>(this->allocateBlock(blockSize));
+        *block = Block{this->_blocks, blockSize};
+        this->_blocks = block;
+        this->_cursor = reinterpret_cast<char *>(block + 1);
+        this->_end = reinterpret_cast<char *>(block) + blockSize;
+        this->_nextBlockSize = 2 * blockSize;
+        start = (reinterpret_cast<std::uintptr_t>(this->_cursor) + align - 1) & ~std::uintptr_t(align - 1);
+      }
+      
+      this->_cursor = reinterpret_cast<char *>(start + size);
+      return reinterpret_cast<void *>(start);
+    }
+    
+    void * allocateBlock(std::size_t size)
+    {
+#   ifdef CLAMPED_HAS_PMR
+      return this->_upstream->allocate(size, alignof(std::max_align_t));
+#   else
+      return ::operator new(size);
+#   endif
+    }
+    
+    void freeBlock(Block *block, std::size_t size)
+    {
+#   ifdef CLAMPED_HAS_PMR
+      this->_upstream->deallocate(block, size, alignof(std::max_align_t));
+#   else
+      (void) size;
+      ::operator delete(block);
+#   endif
+    }
+    
+#   ifdef CLAMPED_HAS_PMR
+    void * do_allocate(std::size_t size, std::size_t align) override
+    {
+      return this->bump(size, align);
+    }
+    
+    // Memory is reclaimed only as the whole pool is released
+    void do_deallocate(void *, std::size_t, std::size_t) override
+    {}
+    
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+      return this == &other;
+    }
+#   endif
+  };
+  
+  template<typename NumT>
+  constexpr std::size_t ClampedNumberPool<NumT>::defaultBlockSize;
+}
@@ -0,0 +1,497 @@
+/** \file
+ * Saturating reductions over arrays of numbers and `ClampedArray`s.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <limits>
+#include <type_traits>
+
+#if __cplusplus > 201703L && defined(__has_include)
+# if __has_include(<span>)
+#include <span>
+# endif
+#endif
+
+#include "clamp_kernels.hh"
+#include "clamped_array.hh"
+#include "clamped_batch.hh"
+
+namespace clamped
+{
+  namespace detail
+  {
+    // The type in which sums of NumT accumulate: wide enough that no sum of
+    // up to 2^31 values can overflow it, where such a type exists
+    template<typename NumT, typename = void>
+    struct SumAccumulator
+    {
+      using type = NumT;
+    };
+    
+    template<typename IntT>
+    struct SumAccumulator<IntT, typename std::enable_if<std::is_integral<IntT>::value>::type>
+    {
+      using type = typename std::conditional<(sizeof(IntT) < sizeof(int64_t)),
+          typename std::conditional<std::is_signed<IntT>::value, int64_t, uint64_t>::type,
+          typename FusedIntermediate<IntT>::type>::type;
+    };
+    
+    template<typename FloatT>
+    struct SumAccumulator<FloatT, typename std::enable_if<std::is_floating_point<FloatT>::value>::type>
+    {
+      using type = long double;
+    };
+    
+    // Whether plain addition of up to 2^31 values of NumT cannot overflow its
+    // accumulator, so that sums need not saturate per element
+    template<typename NumT>
+    using SumsWithoutOverflow = std::integral_constant<bool, std::is_floating_point<NumT>::value
+        || (std::is_integral<NumT>::value && sizeof(typename SumAccumulator<NumT>::type) >= 2 * sizeof(NumT))>;
+    
+    // Sums count terms of TermT exactly in blocks which cannot overflow,
+    // saturating only as the blocks are combined
+    template<typename TermT, typename AccT, typename FnT>
+    typename std::enable_if<SumsWithoutOverflow<TermT>::value, AccT>::type
+    sumTerms(std::size_t count, const FnT &term)
+    {
+      const std::size_t blockSize = std::size_t(1) << 31;
+      AccT total = 0;
+      for(std::size_t block = 0; block < count; block += blockSize) {
+        const std::size_t end = (count - block > blockSize) ? block + blockSize : count;
+        AccT partial = 0;
+        for(std::size_t i = block; i < end; ++i)
+          partial += AccT(term(i));
+        
+        ClampKernels<AccT>::add(total, partial, std::numeric_limits<AccT>::lowest(),
+            std::numeric_limits<AccT>::max());
+      }
+      
+      return total;
+    }
+    
+    // Sums count terms of TermT saturating at the limits of the accumulator
+    // at every step, where no wider accumulator exists
+    template<typename TermT, typename AccT, typename FnT>
+    typename std::enable_if<!SumsWithoutOverflow<TermT>::value, AccT>::type
+    sumTerms(std::size_t count, const FnT &term)
+    {
+      AccT total = 0;
+      for(std::size_t i = 0; i < count; ++i)
+        ClampKernels<AccT>::add(total, AccT(term(i)), std::numeric_limits<AccT>::lowest(),
+            std::numeric_limits<AccT>::max());
+      
+      return total;
+    }
+    
+    // Sums count values of NumT in AccT, as sumTerms() does
+    template<typename NumT, typename AccT>
+    AccT sumChunk(const NumT *values, std::size_t count)
+    {
+      return sumTerms<NumT, AccT>(count, [values](std::size_t i) { return values[i]; });
+    }
+    
+    // The type in which decimals are summed pairwise: double for float,
+    // which still vectorizes, and the type itself otherwise
+    template<typename FloatT>
+    struct PairwiseAccumulator
+    {
+      using type = FloatT;
+    };
+    
+    template<>
+    struct PairwiseAccumulator<float>
+    {
+      using type = double;
+    };
+    
+    // Sums the terms in [begin, end) by halving the range until it fits one
+    // block, then adding the block's halves together elementwise until one
+    // term remains, so that every step vectorizes; rounding error grows with
+    // the logarithm of the count rather than with the count itself
+    template<typename AccT, typename FnT>
+    AccT pairwiseSum(std::size_t begin, std::size_t end, const FnT &term)
+    {
+      const std::size_t blockSize = 128;
+      if(end - begin > blockSize) {
+        const std::size_t middle = begin + ((end - begin) / 2 + blockSize - 1) / blockSize * blockSize;
+        return pairwiseSum<AccT>(begin, middle, term) + pairwiseSum<AccT>(middle, end, term);
+      }
+      
+      AccT block[blockSize];
+      const std::size_t count = end - begin;
+      for(std::size_t i = 0; i < count; ++i)
+        block[i] = AccT(term(begin + i));
+      for(std::size_t i = count; i < blockSize; ++i)
+        block[i] = AccT(0);
+      for(std::size_t width = blockSize / 2; width > 0; width /= 2)
+        for(std::size_t i = 0; i < width; ++i)
+          block[i] += block[i + width];
+      
+      return block[0];
+    }
+    
+    // The type in which a product of two NumT is formed: wide enough to hold
+    // it exactly, where such a type exists
+    template<typename NumT>
+    using ProductType = typename FusedIntermediate<NumT>::type;
+    
+    // Returns a * b in ProductType<NumT>, saturated at the limits of that
+    // type where it is no wider than NumT
+    template<typename NumT>
+    ProductType<NumT> wideProduct(const NumT &a, const NumT &b)
+    {
+      using ProductT = ProductType<NumT>;
+      ProductT product = ProductT(a);
+      if(sizeof(ProductT) >= 2 * sizeof(NumT))
+        product = ProductT(product * ProductT(b));
+      else
+        ClampKernels<ProductT>::multiply(product, ProductT(b), std::numeric_limits<ProductT>::lowest(),
+            std::numeric_limits<ProductT>::max());
+      
+      return product;
+    }
+    
+    // Picks the extreme of count values, which must be at least one, in
+    // eight independent lanes, so that the comparisons vectorize
+    template<typename NumT, typename PickT>
+    NumT extremum(const NumT *values, std::size_t count, const PickT &pick)
+    {
+      const std::size_t lanes = 8;
+      NumT partials[lanes];
+      for(std::size_t lane = 0; lane < lanes; ++lane)
+        partials[lane] = values[0];
+      
+      std::size_t i = 0;
+      for(; i + lanes <= count; i += lanes)
+        for(std::size_t lane = 0; lane < lanes; ++lane)
+          partials[lane] = pick(values[i + lane], partials[lane]);
+      
+      NumT best = values[0];
+      for(std::size_t lane = 0; lane < lanes; ++lane)
+        best = pick(partials[lane], best);
+      for(; i < count; ++i)
+        best = pick(values[i], best);
+      
+      return best;
+    }
+    
+    // Reductions clamping after every step, through the same kernels as the
+    // operators of a clamped number
+    template<typename NumT>
+    struct SteppedReduction
+    {
+      using Kernels = ClampKernels<NumT>;
+      
+      static ClampResult<NumT> sum(const NumT *values, std::size_t count, const NumT &min, const NumT &max)
+      {
+        NumT total = min;
+        ClampReaction reaction = assignClamped(total, NumT(0), min, max);
+        for(std::size_t i = 0; i < count; ++i)
+          reaction = Kernels::add(total, values[i], min, max);
+        
+        return {total, reaction};
+      }
+      
+      static ClampResult<NumT> product(const NumT *values, std::size_t count, const NumT &min, const NumT &max)
+      {
+        NumT total = min;
+        ClampReaction reaction = assignClamped(total, NumT(1), min, max);
+        for(std::size_t i = 0; i < count; ++i)
+          reaction = Kernels::multiply(total, values[i], min, max);
+        
+        return {total, reaction};
+      }
+      
+      static ClampResult<NumT> dot(const NumT *a, const NumT *b, std::size_t count, const NumT &min,
+          const NumT &max)
+      {
+        NumT total = min;
+        ClampReaction reaction = assignClamped(total, NumT(0), min, max);
+        for(std::size_t i = 0; i < count; ++i) {
+          NumT term = min;
+          clampIntermediate(term, wideProduct(a[i], b[i]), min, max);
+          reaction = Kernels::add(total, term, min, max);
+        }
+        
+        return {total, reaction};
+      }
+    };
+    
+    // Reductions clamping only their result, computed exactly in a wider
+    // type for integers and pairwise for decimals
+    template<typename NumT, bool = std::is_floating_point<NumT>::value>
+    struct FusedReduction
+    {
+      using AccT = typename SumAccumulator<NumT>::type;
+      
+      static ClampResult<NumT> sum(const NumT *values, std::size_t count, const NumT &min, const NumT &max)
+      {
+        NumT result = min;
+        const ClampReaction reaction = clampIntermediate(result, sumChunk<NumT, AccT>(values, count), min, max);
+        return {result, reaction};
+      }
+      
+      static ClampResult<NumT> product(const NumT *values, std::size_t count, const NumT &min, const NumT &max)
+      {
+        // Nonzero integers never shrink a product, so saturating at the limits
+        // of the wider type leaves the clamped result unchanged
+        using ProductT = ProductType<NumT>;
+        ProductT total = 1;
+        for(std::size_t i = 0; i < count; ++i)
+          ClampKernels<ProductT>::multiply(total, ProductT(values[i]), std::numeric_limits<ProductT>::lowest(),
+              std::numeric_limits<ProductT>::max());
+        
+        NumT result = min;
+        const ClampReaction reaction = clampIntermediate(result, total, min, max);
+        return {result, reaction};
+      }
+      
+      static ClampResult<NumT> dot(const NumT *a, const NumT *b, std::size_t count, const NumT &min,
+          const NumT &max)
+      {
+        using ProductT = ProductType<NumT>;
+        using DotT = typename SumAccumulator<ProductT>::type;
+        const DotT total = sumTerms<ProductT, DotT>(count, [a, b](std::size_t i) { return wideProduct(a[i], b[i]); });
+        
+        NumT result = min;
+        const ClampReaction reaction = clampIntermediate(result, total, min, max);
+        return {result, reaction};
+      }
+    };
+    
+    template<typename FloatT>
+    struct FusedReduction<FloatT, true>
+    {
+      using AccT = typename PairwiseAccumulator<FloatT>::type;
+      
+      static ClampResult<FloatT> sum(const FloatT *values, std::size_t count, const FloatT &min, const FloatT &max)
+      {
+        const AccT total = pairwiseSum<AccT>(0, count, [values](std::size_t i) { return AccT(values[i]); });
+        FloatT result = min;
+        const ClampReaction reaction = clampIntermediate(result, total, min, max);
+        return {result, reaction};
+      }
+      
+      static ClampResult<FloatT> product(const FloatT *values, std::size_t count, const FloatT &min,
+          const FloatT &max)
+      {
+        using ProductT = ProductType<FloatT>;
+        ProductT total = 1;
+        for(std::size_t i = 0; i < count; ++i)
+          total *= ProductT(values[i]);
+        
+        FloatT result = min;
+        const ClampReaction reaction = clampIntermediate(result, total, min, max);
+        return {result, reaction};
+      }
+      
+      static ClampResult<FloatT> dot(const FloatT *a, const FloatT *b, std::size_t count, const FloatT &min,
+          const FloatT &max)
+      {
+        const AccT total = pairwiseSum<AccT>(0, count, [a, b](std::size_t i) { return AccT(a[i]) * AccT(b[i]); });
+        FloatT result = min;
+        const ClampReaction reaction = clampIntermediate(result, total, min, max);
+        return {result, reaction};
+      }
+    };
+    
+    // The reductions for the given policy
+    template<ClampPolicy Policy, typename NumT>
+    using Reduction = typename std::conditional<Policy == ClampPolicy::EVERY_STEP,
+        SteppedReduction<NumT>, FusedReduction<NumT>>::type;
+  }
+  
+  /**
+   * Reductions of many numbers into one clamped result, without the virtual
+   * call and branches per element that a loop over a clamped number's
+   * operators would make. Each reduction reads a contiguous array of raw
+   * values, such as `ClampedArray::values()`, and clamps its result into
+   * the bounds it is given, which are swapped if given out of order.
+   * 
+   * Under `ClampPolicy::AT_END`, the default, only the result is clamped.
+   * Integers are summed and multiplied exactly in a wider type (as for
+   * `multiplyAdd()`), several elements at a time where the type allows;
+   * where no type is wide enough, as for products of 64-bit integers
+   * without 128-bit support, the wider type saturates at its own limits,
+   * and the result is exact only while every partial result lies within
+   * those limits. Decimals are summed pairwise, in `double` for `float`,
+   * so that rounding error grows only with the logarithm of the count.
+   * Under `ClampPolicy::EVERY_STEP`, each element is instead applied in turn
+   * with the kernels of the clamped number types, exactly as a loop
+   * applying `+=` (or `*=`) to a clamped number bounded by `[min, max]` and
+   * starting at zero (or one) would do.
+   */
+  namespace reduce
+  {
+    /**
+     * Returns the sum of `count` values, clamped into `[min, max]`.
+     * 
+     * \param values the first of the values to sum
+     * \param count the number of values to sum
+     * \param min the minimum value of the sum
+     * \param max the maximum value of the sum
+     * \return Returns the clamped sum, and how its last step was clamped.
+     */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename NumT>
+    ClampResult<NumT> sum(const NumT *values, std::size_t count, const typename detail::BatchOperand<NumT>::type &min,
+        const typename detail::BatchOperand<NumT>::type &max)
+    {
+      static_assert(std::is_arithmetic<NumT>::value, "reduce::sum requires an arithmetic NumT");
+      
+      const NumT lower = (min <= max) ? min : max, upper = (min <= max) ? max : min;
+      return detail::Reduction<Policy, NumT>::sum(values, count, lower, upper);
+    }
+    
+    /**
+     * Returns the product of `count` values, clamped into `[min, max]`.
+     * 
+     * \param values the first of the values to multiply
+     * \param count the number of values to multiply
+     * \param min the minimum value of the product
+     * \param max the maximum value of the product
+     * \return Returns the clamped product, and how its last step was clamped.
+     */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename NumT>
+    ClampResult<NumT> product(const NumT *values, std::size_t count,
+        const typename detail::BatchOperand<NumT>::type &min, const typename detail::BatchOperand<NumT>::type &max)
+    {
+      static_assert(std::is_arithmetic<NumT>::value, "reduce::product requires an arithmetic NumT");
+      
+      const NumT lower = (min <= max) ? min : max, upper = (min <= max) ? max : min;
+      return detail::Reduction<Policy, NumT>::product(values, count, lower, upper);
+    }
+    
+    /**
+     * Returns the dot product of two arrays of `count` values each, clamped
+     * into `[min, max]`. Under `ClampPolicy::EVERY_STEP`, each product is
+     * clamped into the bounds before it is added.
+     * 
+     * \param a the first of the values of the left operand
+     * \param b the first of the values of the right operand
+     * \param count the number of values in each operand
+     * \param min the minimum value of the dot product
+     * \param max the maximum value of the dot product
+     * \return Returns the clamped dot product, and how its last step was
+     * clamped.
+     */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename NumT>
+    ClampResult<NumT> dot(const NumT *a, const NumT *b, std::size_t count,
+        const typename detail::BatchOperand<NumT>::type &min, const typename detail::BatchOperand<NumT>::type &max)
+    {
+      static_assert(std::is_arithmetic<NumT>::value, "reduce::dot requires an arithmetic NumT");
+      
+      const NumT lower = (min <= max) ? min : max, upper = (min <= max) ? max : min;
+      return detail::Reduction<Policy, NumT>::dot(a, b, count, lower, upper);
+    }
+    
+    /**
+     * Returns the least of `count` values, of which there must be at least
+     * one. No clamping is needed, so there is no policy.
+     * 
+     * \param values the first of the values to search
+     * \param count the number of values to search
+     * \return Returns the least value.
+     */
+    template<typename NumT>
+    NumT minimum(const NumT *values, std::size_t count)
+    {
+      return detail::extremum(values, count, [](const NumT &x, const NumT &best) { return (x < best) ? x : best; });
+    }
+    
+    /**
+     * Returns the greatest of `count` values, of which there must be at
+     * least one. No clamping is needed, so there is no policy.
+     * 
+     * \param values the first of the values to search
+     * \param count the number of values to search
+     * \return Returns the greatest value.
+     */
+    template<typename NumT>
+    NumT maximum(const NumT *values, std::size_t count)
+    {
+      return detail::extremum(values, count, [](const NumT &x, const NumT &best) { return (x > best) ? x : best; });
+    }
+    
+    /** \overload Sums the values of every element of the array. */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename NumT>
+    ClampResult<NumT> sum(const ClampedArray<NumT> &array, const typename detail::BatchOperand<NumT>::type &min,
+        const typename detail::BatchOperand<NumT>::type &max)
+    {
+      return reduce::sum<Policy>(array.values(), array.size(), min, max);
+    }
+    
+    /** \overload Multiplies the values of every element of the array. */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename NumT>
+    ClampResult<NumT> product(const ClampedArray<NumT> &array, const typename detail::BatchOperand<NumT>::type &min,
+        const typename detail::BatchOperand<NumT>::type &max)
+    {
+      return reduce::product<Policy>(array.values(), array.size(), min, max);
+    }
+    
+    /** \overload The two arrays must be of equal size. */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename NumT>
+    ClampResult<NumT> dot(const ClampedArray<NumT> &a, const ClampedArray<NumT> &b,
+        const typename detail::BatchOperand<NumT>::type &min, const typename detail::BatchOperand<NumT>::type &max)
+    {
+      return reduce::dot<Policy>(a.values(), b.values(), a.size(), min, max);
+    }
+    
+    /** \overload The array must not be empty. */
+    template<typename NumT>
+    NumT minimum(const ClampedArray<NumT> &array)
+    {
+      return reduce::minimum(array.values(), array.size());
+    }
+    
+    /** \overload The array must not be empty. */
+    template<typename NumT>
+    NumT maximum(const ClampedArray<NumT> &array)
+    {
+      return reduce::maximum(array.values(), array.size());
+    }
+    
+# ifdef __cpp_lib_span
+    /** \overload */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename NumT, std::size_t Extent>
+    ClampResult<std::remove_const_t<NumT>> sum(std::span<NumT, Extent> values,
+        const std::remove_const_t<NumT> &min, const std::remove_const_t<NumT> &max)
+    {
+      return reduce::sum<Policy>(values.data(), values.size(), min, max);
+    }
+    
+    /** \overload */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename NumT, std::size_t Extent>
+    ClampResult<std::remove_const_t<NumT>> product(std::span<NumT, Extent> values,
+        const std::remove_const_t<NumT> &min, const std::remove_const_t<NumT> &max)
+    {
+      return reduce::product<Policy>(values.data(), values.size(), min, max);
+    }
+    
+    /** \overload The two spans must be of equal size. */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename NumT, std::size_t Extent>
+    ClampResult<std::remove_const_t<NumT>> dot(std::span<NumT, Extent> a, std::span<NumT, Extent> b,
+        const std::remove_const_t<NumT> &min, const std::remove_const_t<NumT> &max)
+    {
+      return reduce::dot<Policy>(a.data(), b.data(), a.size(), min, max);
+    }
+    
+    /** \overload The span must not be empty. */
+    template<typename NumT, std::size_t Extent>
+    std::remove_const_t<NumT> minimum(std::span<NumT, Extent> values)
+    {
+      return reduce::minimum(values.data(), values.size());
+    }
+    
+    /** \overload The span must not be empty. */
+    template<typename NumT, std::size_t Extent>
+    std::remove_const_t<NumT> maximum(std::span<NumT, Extent> values)
+    {
+      return reduce::maximum(values.data(), values.size());
+    }
+# endif
+  }
+}
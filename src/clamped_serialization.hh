@@ -0,0 +1,525 @@
+/** \file
+ * A compact binary format for buffers of clamped numbers, and zero-copy views
+ * of it.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <limits>
+#include <type_traits>
+
+#include "clamped_array.hh"
+#include "static_clamped.hh"
+
+namespace clamped
+{
+  /**
+   * Serialization of `ClampedArray`s and buffers of `StaticClamped` numbers.
+   * 
+   * The format is a fixed 64-byte header followed by one section holding
+   * every element's value and, for arrays using `BoundsLayout::PER_LANE`,
+   * two more holding their minima and maxima. Each section starts on a
+   * 64-byte boundary, padded with zeroes. Shared bounds are kept in the
+   * header instead. Every field is stored little-endian, whatever the
+   * writing host's byte order:
+   * 
+   * | Offset | Size  | Field                                                   |
+   * | ------ | ----- | ------------------------------------------------------- |
+   * | 0      | 4     | magic bytes `CLMP`                                      |
+   * | 4      | 2     | format version, currently 1                             |
+   * | 6      | 1     | element kind: 0 unsigned, 1 signed, 2 IEEE 754 floating |
+   * | 7      | 1     | element width in bytes: 1, 2, 4, or 8                   |
+   * | 8      | 1     | bounds layout: 0 shared, 1 per lane                     |
+   * | 16     | 8     | element count                                           |
+   * | 24     | width | shared minimum, or zero                                 |
+   * | 32     | width | shared maximum, or zero                                 |
+   * 
+   * Every other header byte is zero. Readers reject versions newer than their
+   * own, so future revisions may reuse those bytes.
+   */
+  namespace serial
+  {
+    /** The format version written, and the newest which can be read. */
+    constexpr uint16_t formatVersion = 1;
+    
+    /** The size of the header, and the alignment of every section. */
+    constexpr std::size_t sectionAlignment = 64;
+    
+    /**
+     * The outcome of reading a serialized buffer.
+     */
+    enum class ReadStatus
+    {
+      OK,             ///< The buffer is valid, and may be read
+      TRUNCATED,      ///< The buffer is shorter than its header requires
+      BAD_MAGIC,      ///< The buffer does not begin with the magic bytes
+      BAD_VERSION,    ///< The buffer was written by a newer format version
+      BAD_TYPE,       ///< The elements are not of the type being read
+      BAD_LAYOUT,     ///< The bounds layout is unknown, or cannot be read as requested
+      MISALIGNED,     ///< The buffer is not aligned for its elements
+      FOREIGN_ENDIAN, ///< This host is not little-endian, so cannot view the buffer in place
+      OUT_OF_BOUNDS,  ///< Some bounds are inverted, or some value lies outside them
+      TOO_SMALL       ///< The buffer read into cannot hold every element
+    };
+  }
+  
+  namespace detail
+  {
+    // Header field offsets, as documented under clamped::serial
+    constexpr std::size_t serialVersionOffset = 4;
+    constexpr std::size_t serialKindOffset = 6;
+    constexpr std::size_t serialWidthOffset = 7;
+    constexpr std::size_t serialLayoutOffset = 8;
+    constexpr std::size_t serialCountOffset = 16;
+    constexpr std::size_t serialMinOffset = 24;
+    constexpr std::size_t serialMaxOffset = 32;
+    constexpr unsigned char serialMagic[4] = {'C', 'L', 'M', 'P'};
+    
+    // The unsigned integral type whose bits serialization stores for a
+    // number of each width
+    template<std::size_t Width> struct SerialBits;
+    template<> struct SerialBits<1> { using type = uint8_t; };
+    template<> struct SerialBits<2> { using type = uint16_t; };
+    template<> struct SerialBits<4> { using type = uint32_t; };
+    template<> struct SerialBits<8> { using type = uint64_t; };
+    
+    // The element kind recorded in the header for NumT
+    template<typename NumT>
+    constexpr uint8_t serialKind()
+    {
+      static_assert((std::is_integral<NumT>::value
+          || (std::is_floating_point<NumT>::value && std::numeric_limits<NumT>::is_iec559))
+          && (sizeof(NumT) == 1 || sizeof(NumT) == 2 || sizeof(NumT) == 4 || sizeof(NumT) == 8),
+          "Serialization requires an integral or IEEE 754 NumT of 1, 2, 4, or 8 bytes");
+      return std::is_floating_point<NumT>::value ? 2 : std::is_signed<NumT>::value ? 1 : 0;
+    }
+    
+    inline bool hostIsLittleEndian()
+    {
+      const uint16_t probe = 1;
+      unsigned char first = 0;
+      std::memcpy(&first, &probe, 1);
+      return first == 1;
+    }
+    
+    // The size of a section of the given number of bytes, once padded
+    inline std::size_t paddedSection(std::size_t bytes)
+    {
+      return (bytes + serial::sectionAlignment - 1) & ~(serial::sectionAlignment - 1);
+    }
+    
+    template<typename NumT>
+    void storeLittle(unsigned char *out, const NumT &value)
+    {
+      using BitsT = typename SerialBits<sizeof(NumT)>::type;
+      BitsT bits = 0;
+      std::memcpy(&bits, &value, sizeof(NumT));
+      for(std::size_t i = 0; i < sizeof(NumT); ++i)
+        out[i] = static_cast<unsigned char>(bits >> (8 * i));
+    }
+    
+    template<typename NumT>
+    NumT loadLittle(const unsigned char *in)
+    {
+      using BitsT = typename SerialBits<sizeof(NumT)>::type;
+      BitsT bits = 0;
+      for(std::size_t i = 0; i < sizeof(NumT); ++i)
+        bits = BitsT(bits | BitsT(BitsT(in[i]) << (8 * i)));
+      
+      NumT value;
+      std::memcpy(&value, &bits, sizeof(NumT));
+      return value;
+    }
+    
+    // Writes the header, returning the address of the first section
+    template<typename NumT>
+    unsigned char * storeHeader(unsigned char *out, std::size_t count, BoundsLayout layout, const NumT &min,
+        const NumT &max)
+    {
+      std::memset(out, 0, serial::sectionAlignment);
+      std::memcpy(out, serialMagic, sizeof(serialMagic));
+      storeLittle(out + serialVersionOffset, serial::formatVersion);
+      out[serialKindOffset] = serialKind<NumT>();
+      out[serialWidthOffset] = uint8_t(sizeof(NumT));
+      out[serialLayoutOffset] = (layout == BoundsLayout::SHARED) ? 0 : 1;
+      storeLittle(out + serialCountOffset, uint64_t(count));
+      if(layout == BoundsLayout::SHARED) {
+        storeLittle(out + serialMinOffset, min);
+        storeLittle(out + serialMaxOffset, max);
+      }
+      
+      return out + serial::sectionAlignment;
+    }
+    
+    // Writes one section of numbers, reading each through get, and returns
+    // the address past its padding
+    template<typename NumT, typename GetT>
+    unsigned char * storeSection(unsigned char *out, std::size_t count, GetT get)
+    {
+      for(std::size_t i = 0; i < count; ++i)
+        storeLittle(out + i * sizeof(NumT), get(i));
+      
+      const std::size_t bytes = count * sizeof(NumT);
+      std::memset(out + bytes, 0, paddedSection(bytes) - bytes);
+      return out + paddedSection(bytes);
+    }
+    
+    // Whether every value lies within the shared bounds. NaN lies within no
+    // bounds. The loop never exits early, and accumulates into an integer as
+    // wide as the elements, so that it vectorizes.
+    template<typename NumT>
+    bool allWithin(const NumT *values, std::size_t count, NumT min, NumT max)
+    {
+      using BitsT = typename SerialBits<sizeof(NumT)>::type;
+      BitsT outside = !(min <= max);
+      for(std::size_t i = 0; i < count; ++i)
+        outside |= BitsT(!(values[i] >= min)) | BitsT(!(values[i] <= max));
+      
+      return !outside;
+    }
+    
+    // Whether every value lies within its own bounds
+    template<typename NumT>
+    bool allWithin(const NumT *values, std::size_t count, const NumT *mins, const NumT *maxs)
+    {
+      using BitsT = typename SerialBits<sizeof(NumT)>::type;
+      BitsT outside = 0;
+      for(std::size_t i = 0; i < count; ++i)
+        outside |= BitsT(!(values[i] >= mins[i])) | BitsT(!(values[i] <= maxs[i]));
+      
+      return !outside;
+    }
+  }
+  
+  namespace serial
+  {
+    /**
+     * Returns the number of bytes `serialize()` writes for the given array.
+     * 
+     * \param array the array to measure
+     * \return Returns the serialized size of the array.
+     */
+    template<typename NumT>
+    std::size_t serializedSize(const ClampedArray<NumT> &array)
+    {
+      const std::size_t sections = (array.layout() == BoundsLayout::SHARED) ? 1 : 3;
+      return sectionAlignment + sections * detail::paddedSection(array.size() * sizeof(NumT));
+    }
+    
+    /**
+     * Returns the number of bytes `serialize()` writes for the given buffer
+     * of statically clamped numbers.
+     * 
+     * \param count the number of numbers in the buffer
+     * \return Returns the serialized size of the buffer.
+     */
+    template<typename NumT, NumT Min, NumT Max>
+    std::size_t serializedSize(const StaticClamped<NumT, Min, Max> *, std::size_t count)
+    {
+      return sectionAlignment + detail::paddedSection(count * sizeof(NumT));
+    }
+    
+    /**
+     * Writes the given array in the serial format. Shared bounds are written
+     * into the header, and per-lane bounds into sections of their own.
+     * 
+     * \param array the array to write
+     * \param out the buffer written to, of at least `serializedSize(array)`
+     * bytes
+     * \return Returns the number of bytes written.
+     */
+    template<typename NumT>
+    std::size_t serialize(const ClampedArray<NumT> &array, void *out)
+    {
+      const std::size_t count = array.size();
+      unsigned char *cursor = detail::storeHeader(static_cast<unsigned char *>(out), count, array.layout(),
+          count ? array.minValue(0) : NumT(0), count ? array.maxValue(0) : NumT(0));
+      cursor = detail::storeSection<NumT>(cursor, count, [&](std::size_t i) { return array.value(i); });
+      if(array.layout() == BoundsLayout::PER_LANE) {
+        cursor = detail::storeSection<NumT>(cursor, count, [&](std::size_t i) { return array.minValue(i); });
+        cursor = detail::storeSection<NumT>(cursor, count, [&](std::size_t i) { return array.maxValue(i); });
+      }
+      
+      return std::size_t(cursor - static_cast<unsigned char *>(out));
+    }
+    
+    /**
+     * Writes the given buffer of statically clamped numbers in the serial
+     * format, with their bounds shared in the header.
+     * 
+     * \param numbers the numbers to write
+     * \param count the number of numbers to write
+     * \param out the buffer written to, of at least
+     * `serializedSize(numbers, count)` bytes
+     * \return Returns the number of bytes written.
+     */
+    template<typename NumT, NumT Min, NumT Max>
+    std::size_t serialize(const StaticClamped<NumT, Min, Max> *numbers, std::size_t count, void *out)
+    {
+      unsigned char *cursor = detail::storeHeader(static_cast<unsigned char *>(out), count, BoundsLayout::SHARED,
+          Min, Max);
+      cursor = detail::storeSection<NumT>(cursor, count, [&](std::size_t i) { return numbers[i].value(); });
+      return std::size_t(cursor - static_cast<unsigned char *>(out));
+    }
+  }
+  
+  /**
+   * A read-only view of a serialized array of clamped numbers, which reads
+   * the elements in place rather than copying them. This suits a buffer
+   * mapped straight from a file: constructing the view checks the header and
+   * validates every element against its bounds in one pass, without branching
+   * per element, and touches nothing else.
+   * 
+   * A view is usable only if `status()` is `serial::ReadStatus::OK`. It reads
+   * in place, so requires a little-endian host and a buffer aligned for
+   * `NumT`, as any page-aligned mapping is. It never outlives the buffer it
+   * points into.
+   * 
+   * \param NumT the numeric type of the serialized elements
+   * 
+   * \see ClampedArray serial::serialize
+   */
+  template<typename NumT>
+  class ClampedArrayView
+  {
+    const NumT *_values;
+    const NumT *_minValues;
+    const NumT *_maxValues;
+    std::size_t _size;
+    NumT _sharedMin;
+    NumT _sharedMax;
+    BoundsLayout _layout;
+    serial::ReadStatus _status;
+    
+    public:
+    
+    /**
+     * Constructs a view of the serialized array held in the given buffer,
+     * validating its header and every element.
+     * 
+     * \param data the start of the serialized array
+     * \param size the number of bytes available at `data`
+     */
+    ClampedArrayView(const void *data, std::size_t size):
+        _values(nullptr), _minValues(nullptr), _maxValues(nullptr), _size(0), _sharedMin(0), _sharedMax(0),
+        _layout(BoundsLayout::SHARED), _status(open(static_cast<const unsigned char *>(data), size))
+    {}
+    
+    public:
+    
+    /**
+     * Returns whether the viewed buffer was read successfully, or else why
+     * not.
+     * 
+     * \return Returns the status of reading the buffer.
+     */
+    serial::ReadStatus status() const
+    {
+      return this->_status;
+    }
+    
+    /**
+     * Returns the number of elements in the viewed array, or zero if it could
+     * not be read.
+     * 
+     * \return Returns the number of elements.
+     */
+    std::size_t size() const
+    {
+      return this->_size;
+    }
+    
+    /**
+     * Returns how the viewed array holds its bounds.
+     * 
+     * \return Returns the bounds layout of the array.
+     */
+    BoundsLayout layout() const
+    {
+      return this->_layout;
+    }
+    
+    /**
+     * Returns the value of one element.
+     * 
+     * \param index the index of the element
+     * \return Returns the element's value.
+     */
+    const NumT & value(std::size_t index) const
+    {
+      return this->_values[index];
+    }
+    
+    /**
+     * Returns the minimum of one element.
+     * 
+     * \param index the index of the element
+     * \return Returns the element's minimum value.
+     */
+    const NumT & minValue(std::size_t index) const
+    {
+      return (this->_layout == BoundsLayout::SHARED) ? this->_sharedMin : this->_minValues[index];
+    }
+    
+    /**
+     * Returns the maximum of one element.
+     * 
+     * \param index the index of the element
+     * \return Returns the element's maximum value.
+     */
+    const NumT & maxValue(std::size_t index) const
+    {
+      return (this->_layout == BoundsLayout::SHARED) ? this->_sharedMax : this->_maxValues[index];
+    }
+    
+    /**
+     * Returns the values of every element, in place in the viewed buffer.
+     * 
+     * \return Returns the array of values.
+     */
+    const NumT * values() const
+    {
+      return this->_values;
+    }
+    
+    /**
+     * Returns the minima of every element, in place in the viewed buffer, or
+     * null if the bounds are shared.
+     * 
+     * \return Returns the array of minima.
+     */
+    const NumT * minValues() const
+    {
+      return this->_minValues;
+    }
+    
+    /**
+     * Returns the maxima of every element, in place in the viewed buffer, or
+     * null if the bounds are shared.
+     * 
+     * \return Returns the array of maxima.
+     */
+    const NumT * maxValues() const
+    {
+      return this->_maxValues;
+    }
+    
+    /**
+     * Copies the viewed elements into a new, modifiable `ClampedArray` of the
+     * same layout. The view must be valid.
+     * 
+     * \return Returns a copy of the viewed array.
+     */
+    ClampedArray<NumT> toArray() const
+    {
+      if(this->_layout == BoundsLayout::SHARED) {
+        ClampedArray<NumT> array(this->_size, this->_sharedMin, this->_sharedMin, this->_sharedMax);
+        array.assign(this->_values);
+        return array;
+      }
+      
+      // Every value lies within its bounds, so no stretch ever applies
+      ClampedArray<NumT> array(this->_size, NumT(0), std::numeric_limits<NumT>::lowest(),
+          std::numeric_limits<NumT>::max(), BoundsLayout::PER_LANE);
+      array.assign(this->_values);
+      for(std::size_t i = 0; i < this->_size; ++i) {
+        array[i].minValue(this->_minValues[i]);
+        array[i].maxValue(this->_maxValues[i]);
+      }
+      
+      return array;
+    }
+    
+    private:
+    
+    // Checks the header and elements, pointing this view at the sections
+    serial::ReadStatus open(const unsigned char *bytes, std::size_t size)
+    {
+      using serial::ReadStatus;
+      if(size < serial::sectionAlignment)
+        return ReadStatus::TRUNCATED;
+      else if(std::memcmp(bytes, detail::serialMagic, sizeof(detail::serialMagic)) != 0)
+        return ReadStatus::BAD_MAGIC;
+      else if(detail::loadLittle<uint16_t>(bytes + detail::serialVersionOffset) > serial::formatVersion)
+        return ReadStatus::BAD_VERSION;
+      else if(bytes[detail::serialKindOffset] != detail::serialKind<NumT>()
+          || bytes[detail::serialWidthOffset] != sizeof(NumT))
+        return ReadStatus::BAD_TYPE;
+      else if(bytes[detail::serialLayoutOffset] > 1)
+        return ReadStatus::BAD_LAYOUT;
+      else if(!detail::hostIsLittleEndian())
+        return ReadStatus::FOREIGN_ENDIAN;
+      else if(reinterpret_cast<std::uintptr_t>(bytes) % alignof(NumT) != 0)
+        return ReadStatus::MISALIGNED;
+      
+      // Reject counts whose sections cannot fit, before computing their size
+      const BoundsLayout layout = bytes[detail::serialLayoutOffset] ? BoundsLayout::PER_LANE : BoundsLayout::SHARED;
+      const std::size_t sections = (layout == BoundsLayout::SHARED) ? 1 : 3;
+      const uint64_t count = detail::loadLittle<uint64_t>(bytes + detail::serialCountOffset);
+      if(count > (size - serial::sectionAlignment) / sizeof(NumT) / sections)
+        return ReadStatus::TRUNCATED;
+      
+      const std::size_t section = detail::paddedSection(std::size_t(count) * sizeof(NumT));
+      if(size - serial::sectionAlignment < sections * section)
+        return ReadStatus::TRUNCATED;
+      
+      const NumT *values = reinterpret_cast<const NumT *>(bytes + serial::sectionAlignment);
+      const NumT min = detail::loadLittle<NumT>(bytes + detail::serialMinOffset);
+      const NumT max = detail::loadLittle<NumT>(bytes + detail::serialMaxOffset);
+      const NumT *mins = (layout == BoundsLayout::PER_LANE)
+          ? reinterpret_cast<const NumT *>(bytes + serial::sectionAlignment + section) : nullptr;
+      const NumT *maxs = (layout == BoundsLayout::PER_LANE)
+          ? reinterpret_cast<const NumT *>(bytes + serial::sectionAlignment + 2 * section) : nullptr;
+      
+      const bool within = (layout == BoundsLayout::SHARED)
+          ? detail::allWithin(values, std::size_t(count), min, max)
+          : detail::allWithin(values, std::size_t(count), mins, maxs);
+      if(!within)
+        return ReadStatus::OUT_OF_BOUNDS;
+      
+      this->_values = values;
+      this->_minValues = mins;
+      this->_maxValues = maxs;
+      this->_size = std::size_t(count);
+      this->_sharedMin = (layout == BoundsLayout::SHARED) ? min : NumT(0);
+      this->_sharedMax = (layout == BoundsLayout::SHARED) ? max : NumT(0);
+      this->_layout = layout;
+      return ReadStatus::OK;
+    }
+  };
+  
+  namespace serial
+  {
+    /**
+     * Copies the elements of a view into a buffer of statically clamped
+     * numbers. This succeeds only if the view is valid, its bounds are shared,
+     * and they lie within [Min, Max], so that no value need be clamped, and
+     * `out` holds at least `view.size()` numbers.
+     * 
+     * \param view the view whose elements are copied
+     * \param out the buffer written to
+     * \param capacity the number of numbers `out` holds
+     * \return Returns `OK` if the numbers were copied, else why not.
+     */
+    template<typename NumT, NumT Min, NumT Max>
+    ReadStatus copyTo(const ClampedArrayView<NumT> &view, StaticClamped<NumT, Min, Max> *out, std::size_t capacity)
+    {
+      if(view.status() != ReadStatus::OK)
+        return view.status();
+      else if(view.layout() != BoundsLayout::SHARED)
+        return ReadStatus::BAD_LAYOUT;
+      else if(view.size() > capacity)
+        return ReadStatus::TOO_SMALL;
+      else if(view.size() && (view.minValue(0) < Min || view.maxValue(0) > Max))
+        return ReadStatus::OUT_OF_BOUNDS;
+      
+      for(std::size_t i = 0; i < view.size(); ++i)
+        out[i] = StaticClamped<NumT, Min, Max>(view.value(i));
+      return ReadStatus::OK;
+    }
+  }
+}
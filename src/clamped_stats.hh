@@ -0,0 +1,255 @@
+/** \file
+ * Counts of how often clamped operations saturate, kept when instrumented.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "clamp_kernels.hh"
+
+namespace clamped
+{
+  /**
+   * Instrumentation of the clamped number operators. When a program is built
+   * with `CLAMPED_INSTRUMENTATION` defined (throughout, including the
+   * precompiled library), every scalar operator of every clamped type records
+   * the `ClampReaction` it produced: `MINIMUM` or `MAXIMUM` where the result
+   * saturated at that bound, else `NONE`. Otherwise nothing is recorded, and
+   * the operators compile exactly as they would without this header.
+   * 
+   * Reactions are tallied per wrapped type `NumT` and per operation, so that
+   * `ClampedInt32`, `flat::ClampedInt32`, and every other wrapper of `int32_t`
+   * share one set of counts. Each thread keeps its own tallies, uncontended by
+   * any other, which `tally()` sums on demand. The bulk operations of
+   * `clamped::batch` and `ClampedArray` compute no reactions, and so are not
+   * counted; neither is evaluation during compilation.
+   * 
+   * A hook may also be installed for each `NumT`, which is called on the
+   * operating thread with every reaction as it is recorded.
+   */
+  namespace stats
+  {
+    /** The operations whose reactions are counted. */
+    using Operation = detail::Operation;
+    
+    /** The reaction of one clamped operation. */
+    using Reaction = ClampReaction;
+    
+    /** A function called with each reaction recorded for one type. */
+    using Hook = void (*)(Operation op, Reaction reaction);
+    
+    /** Whether this program records reactions at all. */
+#   ifdef CLAMPED_INSTRUMENTATION
+    constexpr bool enabled = true;
+#   else
+    constexpr bool enabled = false;
+#   endif
+    
+    /**
+     * The number of reactions of each kind recorded for some operation.
+     */
+    struct Tally
+    {
+      /** The number of results which saturated at the minimum. */
+      uint64_t minimum = 0;
+      
+      /** The number of results which saturated at the maximum. */
+      uint64_t maximum = 0;
+      
+      /** The number of results which lay within the bounds. */
+      uint64_t none = 0;
+      
+      /**
+       * Returns the number of reactions recorded.
+       * 
+       * \return Returns the sum of every count in this tally.
+       */
+      uint64_t total() const
+      {
+        return this->minimum + this->maximum + this->none;
+      }
+      
+      /**
+       * Adds the counts of another tally to this one.
+       * 
+       * \param other the tally to add
+       * \return Returns this tally, allowing chaining of operations.
+       */
+      Tally & operator+=(const Tally &other)
+      {
+        this->minimum += other.minimum;
+        this->maximum += other.maximum;
+        this->none += other.none;
+        return *this;
+      }
+    };
+    
+    namespace detail
+    {
+      constexpr std::size_t operationCount = std::size_t(Operation::ASSIGN) + 1;
+      constexpr std::size_t reactionCount = std::size_t(Reaction::NONE) + 1;
+      
+      // Counts for every operation and reaction on one type
+      struct Counts
+      {
+        std::atomic<uint64_t> counts[operationCount][reactionCount];
+        
+        Counts()
+        {
+          this->reset();
+        }
+        
+        void reset()
+        {
+          for(auto &operation : this->counts)
+            for(std::atomic<uint64_t> &count : operation)
+              count.store(0, std::memory_order_relaxed);
+        }
+        
+        Tally tally(Operation op) const
+        {
+          const std::atomic<uint64_t> *counts = this->counts[std::size_t(op)];
+          Tally result;
+          result.minimum = counts[std::size_t(Reaction::MINIMUM)].load(std::memory_order_relaxed);
+          result.maximum = counts[std::size_t(Reaction::MAXIMUM)].load(std::memory_order_relaxed);
+          result.none = counts[std::size_t(Reaction::NONE)].load(std::memory_order_relaxed);
+          return result;
+        }
+      };
+      
+      // Every thread's counts for one type, along with those of threads which
+      // have since exited, and the type's hook
+      template<typename NumT>
+      struct Registry
+      {
+        std::mutex mutex;
+        std::vector<Counts *> live;
+        Counts retired;
+        std::atomic<Hook> hook;
+        
+        Registry():
+            hook(nullptr)
+        {}
+        
+        static Registry & instance()
+        {
+          static Registry registry;
+          return registry;
+        }
+      };
+      
+      // One thread's counts for one type, registered for as long as the
+      // thread runs and folded into the retired counts when it exits
+      template<typename NumT>
+      struct ThreadCounts: Counts
+      {
+        ThreadCounts()
+        {
+          Registry<NumT> &registry = Registry<NumT>::instance();
+          std::lock_guard<std::mutex> lock(registry.mutex);
+          registry.live.push_back(this);
+        }
+        
+        ~ThreadCounts()
+        {
+          Registry<NumT> &registry = Registry<NumT>::instance();
+          std::lock_guard<std::mutex> lock(registry.mutex);
+          for(std::size_t op = 0; op < operationCount; ++op)
+            for(std::size_t reaction = 0; reaction < reactionCount; ++reaction)
+              registry.retired.counts[op][reaction].fetch_add(
+                  this->counts[op][reaction].load(std::memory_order_relaxed), std::memory_order_relaxed);
+          
+          registry.live.erase(std::find(registry.live.begin(), registry.live.end(), this));
+        }
+        
+        static ThreadCounts & local()
+        {
+          thread_local ThreadCounts counts;
+          return counts;
+        }
+      };
+    }
+    
+    /**
+     * Returns the reactions recorded for one operation on `NumT`, summed over
+     * every thread, since the program started or `reset<NumT>()` was last
+     * called. Counts from threads still running may be momentarily behind.
+     * 
+     * \param op the operation whose reactions are returned
+     * \return Returns the reactions recorded for the operation.
+     */
+    template<typename NumT>
+    Tally tally(Operation op)
+    {
+      detail::Registry<NumT> &registry = detail::Registry<NumT>::instance();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      Tally result = registry.retired.tally(op);
+      for(const detail::Counts *counts : registry.live)
+        result += counts->tally(op);
+      
+      return result;
+    }
+    
+    /**
+     * Returns the reactions recorded for every operation on `NumT`, summed
+     * over every thread.
+     * 
+     * \return Returns the reactions recorded for the type.
+     */
+    template<typename NumT>
+    Tally tally()
+    {
+      Tally result;
+      for(std::size_t op = 0; op < detail::operationCount; ++op)
+        result += tally<NumT>(Operation(op));
+      
+      return result;
+    }
+    
+    /**
+     * Discards every reaction recorded so far for `NumT`, on every thread.
+     */
+    template<typename NumT>
+    void reset()
+    {
+      detail::Registry<NumT> &registry = detail::Registry<NumT>::instance();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      registry.retired.reset();
+      for(detail::Counts *counts : registry.live)
+        counts->reset();
+    }
+    
+    /**
+     * Installs the hook called with each reaction recorded for `NumT`,
+     * replacing any installed before. The hook is called on the thread which
+     * performed the operation, after its reaction is tallied.
+     * 
+     * \param hook the function to call, or null to remove the hook
+     */
+    template<typename NumT>
+    void setHook(Hook hook)
+    {
+      detail::Registry<NumT>::instance().hook.store(hook, std::memory_order_release);
+    }
+  }
+  
+# ifdef CLAMPED_INSTRUMENTATION
+  template<typename NumT>
+  void detail::recordReaction(Operation op, ClampReaction reaction)
+  {
+    stats::detail::ThreadCounts<NumT>::local().counts[std::size_t(op)][std::size_t(reaction)].fetch_add(1,
+        std::memory_order_relaxed);
+    
+    const stats::Hook hook = stats::detail::Registry<NumT>::instance().hook.load(std::memory_order_acquire);
+    if(hook)
+      hook(op, reaction);
+  }
+# endif
+}
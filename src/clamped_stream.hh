@@ -0,0 +1,406 @@
+/** \file
+ * Streaming pipelines which clamp chunks of raw numbers as they arrive.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "clamp_kernels.hh"
+#include "clamped_batch.hh"
+#include "clamped_stats.hh"
+
+namespace clamped
+{
+  /**
+   * Pipeline stages for streams of raw numbers, such as sensor readings
+   * ingested in chunks. A `Clamper` holds one pair of bounds and a sequence
+   * of clamped operations, and applies them in place to each chunk it is
+   * given; `pump()` feeds it chunks from a reader while the next chunk is
+   * being read.
+   */
+  namespace stream
+  {
+    /**
+     * Running counts of what a `Clamper` has processed.
+     */
+    struct Statistics
+    {
+      /** The number of chunks processed. */
+      uint64_t chunks = 0;
+      
+      /** The number of values processed, over every chunk. */
+      uint64_t elements = 0;
+      
+      /**
+       * How each raw value was clamped into the bounds before any operation
+       * was applied: `minimum` and `maximum` count those which lay beyond
+       * that bound, `none` those which lay within.
+       */
+      stats::Tally input;
+      
+      /**
+       * Where each value rested once every operation was applied: `minimum`
+       * and `maximum` count those equal to that bound, whether saturated or
+       * exactly computed, and `none` those strictly within.
+       */
+      stats::Tally output;
+    };
+    
+    /**
+     * A pipeline stage which clamps chunks of raw numbers into one pair of
+     * bounds, then applies a fixed sequence of clamped operations to them, in
+     * place. Each operation saturates exactly as the compound assignment
+     * operators of the clamped number types do, and runs over a whole chunk
+     * at a time through the vectorized kernels of `clamped::batch`.
+     * 
+     * The sequence is built by chaining `add()`, `subtract()`, `multiply()`,
+     * and `divide()`, which append operations rather than apply them:
+     * 
+     *     stream::Clamper<double> scale(0.0, 100.0);
+     *     scale.multiply(0.5).add(10.0);
+     *     scale.process(chunk, count);
+     * 
+     * A `Clamper` keeps running `Statistics` over every chunk it processes.
+     * It allocates only while its sequence is built, never while processing,
+     * and is not safe to use from several threads at once.
+     * 
+     * \param NumT the numeric type being clamped
+     * 
+     * \see pump() batch::add
+     */
+    template<typename NumT>
+    class Clamper
+    {
+      using Kernels = detail::ClampKernels<NumT>;
+      
+      struct Step
+      {
+        detail::Operation op;
+        NumT operand;
+      };
+      
+      std::vector<Step> _steps;
+      NumT _minValue;
+      NumT _maxValue;
+      Statistics _statistics;
+      
+      public:
+      
+      /**
+       * Constructs a new `Clamper` for the given bounds, with no operations.
+       * Bounds given in the wrong order are swapped.
+       * 
+       * \param min the minimum value of every processed number
+       * \param max the maximum value of every processed number
+       */
+      Clamper(const NumT &min, const NumT &max):
+          _minValue((min <= max) ? min : max), _maxValue((min <= max) ? max : min)
+      {}
+      
+      public:
+      
+      /**
+       * Returns the minimum value of every processed number.
+       * 
+       * \return Returns this stage's minimum value.
+       */
+      const NumT & minValue() const
+      {
+        return this->_minValue;
+      }
+      
+      /**
+       * Returns the maximum value of every processed number.
+       * 
+       * \return Returns this stage's maximum value.
+       */
+      const NumT & maxValue() const
+      {
+        return this->_maxValue;
+      }
+      
+      /**
+       * Appends the addition of the given number to this stage's operations.
+       * 
+       * \param other the right operand for addition
+       * \return Returns this stage, allowing chaining of operations.
+       */
+      Clamper & add(const NumT &other)
+      {
+        this->_steps.push_back({detail::Operation::ADD, other});
+        return *this;
+      }
+      
+      /**
+       * Appends the subtraction of the given number to this stage's
+       * operations.
+       * 
+       * \param other the right operand for subtraction
+       * \return Returns this stage, allowing chaining of operations.
+       */
+      Clamper & subtract(const NumT &other)
+      {
+        this->_steps.push_back({detail::Operation::SUBTRACT, other});
+        return *this;
+      }
+      
+      /**
+       * Appends multiplication by the given number to this stage's
+       * operations.
+       * 
+       * \param other the right operand for multiplication
+       * \return Returns this stage, allowing chaining of operations.
+       */
+      Clamper & multiply(const NumT &other)
+      {
+        this->_steps.push_back({detail::Operation::MULTIPLY, other});
+        return *this;
+      }
+      
+      /**
+       * Appends division by the given number to this stage's operations.
+       * Division by zero saturates toward the sign of each value, as it does
+       * for the clamped number types.
+       * 
+       * \param other the right operand for division
+       * \return Returns this stage, allowing chaining of operations.
+       */
+      Clamper & divide(const NumT &other)
+      {
+        this->_steps.push_back({detail::Operation::DIVIDE, other});
+        return *this;
+      }
+      
+      /**
+       * Returns the number of operations this stage applies after clamping.
+       * 
+       * \return Returns the length of this stage's sequence of operations.
+       */
+      std::size_t stepCount() const
+      {
+        return this->_steps.size();
+      }
+      
+      /**
+       * Clamps each of `count` values into this stage's bounds, then applies
+       * every operation in turn to the whole chunk, in place.
+       * 
+       * \param values the chunk of values to modify in place
+       * \param count the number of values in the chunk
+       */
+      void process(NumT *values, std::size_t count)
+      {
+        this->countInput(values, values + count);
+        batch::set(values, values, count, this->_minValue, this->_maxValue);
+        for(const Step &step : this->_steps)
+          switch(step.op) {
+            case detail::Operation::ADD:
+              batch::add(values, count, step.operand, this->_minValue, this->_maxValue);
+            break;
+            case detail::Operation::SUBTRACT:
+              batch::subtract(values, count, step.operand, this->_minValue, this->_maxValue);
+            break;
+            case detail::Operation::MULTIPLY:
+              batch::multiply(values, count, step.operand, this->_minValue, this->_maxValue);
+            break;
+            default:
+              batch::divide(values, count, step.operand, this->_minValue, this->_maxValue);
+            break;
+          }
+        
+        this->countOutput(values, values + count);
+      }
+      
+      /**
+       * Processes the contiguous chunk of values between two pointers, as the
+       * chunked `process()` does.
+       * 
+       * \param first a pointer to the first value to modify
+       * \param last a pointer past the last value to modify
+       */
+      void process(NumT *first, NumT *last)
+      {
+        this->process(first, std::size_t(last - first));
+      }
+      
+      /**
+       * Clamps each value in the given range into this stage's bounds, then
+       * applies every operation in turn, in place. Ranges which need not be
+       * contiguous are processed one element at a time, with the same results
+       * as the chunked `process()`.
+       * 
+       * \param first an iterator to the first value to modify
+       * \param last an iterator past the last value to modify
+       */
+      template<typename IterT>
+      void process(IterT first, IterT last)
+      {
+        this->countInput(first, last);
+        for(IterT it = first; it != last; ++it) {
+          NumT &value = *it;
+          detail::assignClamped(value, NumT(value), this->_minValue, this->_maxValue);
+          for(const Step &step : this->_steps)
+            this->apply(step, value);
+        }
+        
+        this->countOutput(first, last);
+      }
+      
+      /**
+       * Returns the statistics gathered over every chunk processed since this
+       * stage was constructed or its statistics last reset.
+       * 
+       * \return Returns this stage's running statistics.
+       */
+      const Statistics & statistics() const
+      {
+        return this->_statistics;
+      }
+      
+      /**
+       * Discards the statistics gathered so far.
+       */
+      void resetStatistics()
+      {
+        this->_statistics = Statistics();
+      }
+      
+      private:
+      
+      void apply(const Step &step, NumT &value) const
+      {
+        switch(step.op) {
+          case detail::Operation::ADD:
+            Kernels::add(value, step.operand, this->_minValue, this->_maxValue);
+          break;
+          case detail::Operation::SUBTRACT:
+            Kernels::subtract(value, step.operand, this->_minValue, this->_maxValue);
+          break;
+          case detail::Operation::MULTIPLY:
+            Kernels::multiply(value, step.operand, this->_minValue, this->_maxValue);
+          break;
+          default:
+            Kernels::divide(value, step.operand, this->_minValue, this->_maxValue);
+          break;
+        }
+      }
+      
+      // Tallies how the raw values will clamp; free of branches per element,
+      // so that chunks of builtin numbers vectorize
+      template<typename IterT>
+      void countInput(IterT first, IterT last)
+      {
+        uint64_t count = 0, below = 0, above = 0;
+        for(IterT it = first; it != last; ++it, ++count) {
+          below += uint64_t(*it < this->_minValue);
+          above += uint64_t(*it > this->_maxValue);
+        }
+        
+        this->_statistics.chunks += 1;
+        this->_statistics.elements += count;
+        this->_statistics.input.minimum += below;
+        this->_statistics.input.maximum += above;
+        this->_statistics.input.none += count - below - above;
+      }
+      
+      // Tallies where the processed values rest
+      template<typename IterT>
+      void countOutput(IterT first, IterT last)
+      {
+        uint64_t count = 0, atMin = 0, atMax = 0;
+        for(IterT it = first; it != last; ++it, ++count) {
+          atMin += uint64_t(*it == this->_minValue);
+          atMax += uint64_t(*it == this->_maxValue && this->_minValue != this->_maxValue);
+        }
+        
+        this->_statistics.output.minimum += atMin;
+        this->_statistics.output.maximum += atMax;
+        this->_statistics.output.none += count - atMin - atMax;
+      }
+    };
+    
+    /**
+     * Streams chunks of numbers from a reader through a `Clamper` to a
+     * writer, double-buffered so that reading overlaps processing. Two chunk
+     * buffers are allocated up front: while the calling thread processes and
+     * writes one, a helper thread reads the next into the other.
+     * 
+     * The reader is called as `read(buffer, capacity)` on the helper thread,
+     * and returns the number of values it stored into `buffer`, at most
+     * `capacity`; returning zero ends the stream. The writer is called as
+     * `write(buffer, count)` on the calling thread with each processed chunk,
+     * in order, and must be done with the buffer when it returns. Neither may
+     * throw.
+     * 
+     * \param clamper the stage through which every chunk is processed
+     * \param chunkSize the capacity of each buffer, in values
+     * \param read the function which fills buffers with raw values
+     * \param write the function which consumes processed buffers
+     * \return Returns the number of values streamed.
+     */
+    template<typename NumT, typename ReadT, typename WriteT>
+    uint64_t pump(Clamper<NumT> &clamper, std::size_t chunkSize, ReadT read, WriteT write)
+    {
+      std::vector<NumT> buffers[2] = {std::vector<NumT>(chunkSize ? chunkSize : 1),
+          std::vector<NumT>(chunkSize ? chunkSize : 1)};
+      std::size_t counts[2] = {0, 0};
+      bool filled[2] = {false, false};
+      std::mutex mutex;
+      std::condition_variable changed;
+      
+      // The reader fills the buffers alternately, each once it is released
+      std::thread reader([&]() {
+        for(std::size_t slot = 0;; slot ^= 1) {
+          {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [&]() { return !filled[slot]; });
+          }
+          
+          const std::size_t count = read(buffers[slot].data(), buffers[slot].size());
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            counts[slot] = count;
+            filled[slot] = true;
+          }
+          
+          changed.notify_all();
+          if(count == 0)
+            return;
+        }
+      });
+      
+      uint64_t total = 0;
+      for(std::size_t slot = 0;; slot ^= 1) {
+        std::size_t count = 0;
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          changed.wait(lock, [&]() { return filled[slot]; });
+          count = counts[slot];
+        }
+        
+        if(count == 0)
+          break;
+        
+        clamper.process(buffers[slot].data(), count);
+        write(static_cast<const NumT *>(buffers[slot].data()), count);
+        total += count;
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          filled[slot] = false;
+        }
+        
+        changed.notify_all();
+      }
+      
+      reader.join();
+      return total;
+    }
+  }
+}
@@ -0,0 +1,737 @@
+/** \file
+ * Clamped fixed-point numbers, whose arithmetic runs on the integer units
+ * alone.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "clamp_kernels.hh"
+#include "clamped_batch.hh"
+#include "clamped_numbers.hh"
+
+namespace clamped
+{
+  namespace detail
+  {
+    // The raw Q-format value nearest decimal * 2^FracBits, rounding halves
+    // away from zero and saturating at IntT's limits; zero for NaN
+    template<typename IntT, unsigned FracBits, typename FloatT>
+    IntT fixedFromDecimal(const FloatT &decimal)
+    {
+      const long double scaled = std::round(std::ldexp(static_cast<long double>(decimal), int(FracBits)));
+      if(std::isnan(scaled))
+        return 0;
+      else if(scaled <= static_cast<long double>(std::numeric_limits<IntT>::min()))
+        return std::numeric_limits<IntT>::min();
+      else if(scaled >= static_cast<long double>(std::numeric_limits<IntT>::max()))
+        return std::numeric_limits<IntT>::max();
+      else
+        return IntT(scaled);
+    }
+    
+    // The decimal value of a raw Q-format value, which is exact wherever
+    // FloatT's significand holds every bit of IntT
+    template<typename FloatT, unsigned FracBits, typename IntT>
+    FloatT decimalFromFixed(const IntT &raw)
+    {
+      return std::ldexp(static_cast<FloatT>(raw), -int(FracBits));
+    }
+  }
+  
+  /**
+   * A fixed-point number with defined lower and upper bounds beyond which its
+   * value will never pass. A `ClampedFixed` holds a fractional value in the
+   * Q format: an integer `IntT` counting units of 2^-FracBits, so that a
+   * `ClampedFixed<int32_t, 16>` spans roughly [-32768, 32768) in steps of
+   * 1/65536. It is a `BasicClampedNumber<IntT>`, and its value and bounds
+   * behave exactly as that type's do, but are always given and returned in
+   * this raw form: `one` is the raw value of 1, and `toDecimal()` and the
+   * constructor from a `ClampedDecimal` convert between the two.
+   * 
+   * Its arithmetic is that of `detail::FixedKernels`. Sums, differences and
+   * remainders are those of the raw integers, while products and quotients
+   * are formed exactly in an integer twice `IntT`'s width, rescaled, rounding
+   * toward zero, and clamped once into the bounds. No operator touches the
+   * floating-point unit, so results are the same, bit for bit, on every
+   * processor, and cost what the integral ones do. Division by zero
+   * saturates at the bound toward the sign of the dividend, as for a
+   * `ClampedInteger`.
+   * 
+   * Comparisons, inherited from `BasicClampedNumber`, compare raw values, and
+   * so are meaningful only between numbers of the same `FracBits`.
+   * 
+   * \param IntT the builtin integral type holding the raw value, of at most
+   * 32 bits unless the compiler offers a 128-bit integer
+   * \param FracBits the number of fraction bits, no more than the value bits
+   * of `IntT`
+   * 
+   * \see ClampedInteger ClampedDecimal
+   */
+  template<typename IntT, unsigned FracBits>
+  class ClampedFixed: public BasicClampedNumber<IntT>
+  {
+    using Kernels = detail::FixedKernels<IntT, FracBits>;
+    
+    public:
+    
+    /**
+     * The raw value of one, or the maximum of `IntT` where one is beyond it,
+     * as for `ClampedFixed<int16_t, 15>`.
+     */
+    static constexpr IntT one = (FracBits < unsigned(std::numeric_limits<IntT>::digits))
+        ? IntT(Kernels::scale) : std::numeric_limits<IntT>::max();
+    
+    /**
+     * Constructs a new `ClampedFixed` with an initial value of zero and no
+     * bounds, but the limits of `IntT`.
+     */
+    ClampedFixed():
+        BasicClampedNumber<IntT>(0, std::numeric_limits<IntT>::min(), std::numeric_limits<IntT>::max())
+    {}
+    
+    /**
+     * Constructs a new `ClampedFixed` with the given raw initial value and no
+     * bounds, but the limits of `IntT`.
+     * 
+     * \param value the raw starting value of this number
+     */
+    ClampedFixed(const IntT &value):
+        BasicClampedNumber<IntT>(value, std::numeric_limits<IntT>::min(), std::numeric_limits<IntT>::max())
+    {}
+    
+    /**
+     * Constructs a new `ClampedFixed` with the specified raw current, minimum,
+     * and maximum values. As for every `BasicClampedNumber`, bounds which
+     * exclude the starting value are stretched to it.
+     * 
+     * \param value the raw starting value of this number
+     * \param min the raw minimum value for this number
+     * \param max the raw maximum value for this number
+     */
+    ClampedFixed(const IntT &value, const IntT &min, const IntT &max):
+        BasicClampedNumber<IntT>(value, min, max)
+    {}
+    
+    /**
+     * Constructs a new `ClampedFixed` from the value and bounds of a
+     * `ClampedDecimal`, each rounded to the nearest multiple of 2^-FracBits,
+     * halves away from zero, and saturated at the limits of `IntT`. A NaN
+     * converts to zero. This is the one member which uses the floating-point
+     * unit.
+     * 
+     * \param decimal the number to convert
+     */
+    template<typename FloatT>
+    explicit ClampedFixed(const ClampedDecimal<FloatT> &decimal):
+        BasicClampedNumber<IntT>(detail::fixedFromDecimal<IntT, FracBits>(decimal.value()),
+            detail::fixedFromDecimal<IntT, FracBits>(decimal.minValue()),
+            detail::fixedFromDecimal<IntT, FracBits>(decimal.maxValue()))
+    {}
+    
+    /**
+     * Provides a virtual destructor with the default dehavior.
+     */
+    virtual ~ClampedFixed() = default;
+    
+    /**
+     * Copies and moves are memberwise, as for a `BasicClampedNumber`.
+     */
+    ClampedFixed(const ClampedFixed<IntT, FracBits> &) = default;
+    
+    /** \copydoc ClampedFixed(const ClampedFixed<IntT, FracBits> &) */
+    ClampedFixed(ClampedFixed<IntT, FracBits> &&) = default;
+    
+    /** \copydoc ClampedFixed(const ClampedFixed<IntT, FracBits> &) */
+    ClampedFixed<IntT, FracBits> & operator=(const ClampedFixed<IntT, FracBits> &) = default;
+    
+    /** \copydoc ClampedFixed(const ClampedFixed<IntT, FracBits> &) */
+    ClampedFixed<IntT, FracBits> & operator=(ClampedFixed<IntT, FracBits> &&) = default;
+    
+    public:
+    
+    /**
+     * Returns the raw value nearest the given decimal, as the constructor from
+     * a `ClampedDecimal` rounds each of its values.
+     * 
+     * \param decimal the decimal value to convert
+     * \return Returns the raw value nearest `decimal`.
+     */
+    template<typename FloatT>
+    static IntT rawOf(const FloatT &decimal)
+    {
+      return detail::fixedFromDecimal<IntT, FracBits>(decimal);
+    }
+    
+    /**
+     * Returns the decimal value of the given raw value, which is exact wherever
+     * the significand of `FloatT` holds every bit of `IntT`.
+     * 
+     * \param raw the raw value to convert
+     * \return Returns `raw` divided by 2^FracBits.
+     */
+    template<typename FloatT>
+    static FloatT decimalOf(const IntT &raw)
+    {
+      return detail::decimalFromFixed<FloatT, FracBits>(raw);
+    }
+    
+    /**
+     * Returns a `ClampedDecimal` holding this number's value and bounds, each
+     * converted as `decimalOf()` converts a raw value.
+     * 
+     * \return Returns this number as a `ClampedDecimal<FloatT>`.
+     */
+    template<typename FloatT>
+    ClampedDecimal<FloatT> toDecimal() const
+    {
+      return {decimalOf<FloatT>(this->_value), decimalOf<FloatT>(this->_minValue),
+          decimalOf<FloatT>(this->_maxValue)};
+    }
+    
+    /**
+     * Adds the given raw number to this one, as constrained by this number's
+     * bounds.
+     * 
+     * \param other the right operand for addition
+     * \return Returns this number, allowing chaining of operations.
+     */
+    virtual ClampedFixed<IntT, FracBits> & operator+=(detail::ArgumentType<IntT> other)
+    {
+      detail::observe<IntT>(detail::Operation::ADD, Kernels::add(this->_value, other, this->_minValue, this->_maxValue));
+      return *this;
+    }
+    
+    /**
+     * Subtracts the given raw number from this one, as constrained by this
+     * number's bounds.
+     * 
+     * \param other the right operand for subtraction
+     * \return Returns this number, allowing chaining of operations.
+     */
+    virtual ClampedFixed<IntT, FracBits> & operator-=(detail::ArgumentType<IntT> other)
+    {
+      detail::observe<IntT>(detail::Operation::SUBTRACT,
+          Kernels::subtract(this->_value, other, this->_minValue, this->_maxValue));
+      return *this;
+    }
+    
+    /**
+     * Multiplies this number by the raw number given, as constrained by this
+     * number's bounds. The product is rounded toward zero.
+     * 
+     * \param other the right operand for multiplication
+     * \return Returns this number, allowing chaining of operations.
+     */
+    virtual ClampedFixed<IntT, FracBits> & operator*=(detail::ArgumentType<IntT> other)
+    {
+      detail::observe<IntT>(detail::Operation::MULTIPLY,
+          Kernels::multiply(this->_value, other, this->_minValue, this->_maxValue));
+      return *this;
+    }
+    
+    /**
+     * Divides this number by the raw number given, as constrained by this
+     * number's bounds. The quotient is rounded toward zero; division by zero
+     * yields this number's maximum or minimum, depending on its sign prior to
+     * division.
+     * 
+     * \param other the right operand for division
+     * \return Returns this number, allowing chaining of operations.
+     */
+    virtual ClampedFixed<IntT, FracBits> & operator/=(detail::ArgumentType<IntT> other)
+    {
+      detail::observe<IntT>(detail::Operation::DIVIDE,
+          Kernels::divide(this->_value, other, this->_minValue, this->_maxValue));
+      return *this;
+    }
+    
+    /**
+     * Sets this number's value to the remainder of division by the given raw
+     * number, within this number's bounds. Division by zero yields a
+     * remainder of zero.
+     * 
+     * \param other the value by which to divide this one
+     * \return Returns this number, allowing chain of operations.
+     */
+    virtual ClampedFixed<IntT, FracBits> & operator%=(detail::ArgumentType<IntT> other)
+    {
+      detail::observe<IntT>(detail::Operation::MODULO,
+          Kernels::modulo(this->_value, other, this->_minValue, this->_maxValue));
+      return *this;
+    }
+    
+    /**
+     * Adds the given raw number to this one, as constrained by this number's
+     * bounds, reporting whether the sum saturated at either bound.
+     * 
+     * \param other the right operand for addition
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<IntT> addChecked(detail::ArgumentType<IntT> other)
+    {
+      const ClampReaction reaction = detail::observe<IntT>(detail::Operation::ADD,
+          Kernels::add(this->_value, other, this->_minValue, this->_maxValue));
+      return {this->_value, reaction};
+    }
+    
+    /**
+     * Subtracts the given raw number from this one, as constrained by this
+     * number's bounds, reporting whether the difference saturated at either
+     * bound.
+     * 
+     * \param other the right operand for subtraction
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<IntT> subtractChecked(detail::ArgumentType<IntT> other)
+    {
+      const ClampReaction reaction = detail::observe<IntT>(detail::Operation::SUBTRACT,
+          Kernels::subtract(this->_value, other, this->_minValue, this->_maxValue));
+      return {this->_value, reaction};
+    }
+    
+    /**
+     * Multiplies this number by the raw number given, as constrained by this
+     * number's bounds, reporting whether the product saturated at either bound.
+     * 
+     * \param other the right operand for multiplication
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<IntT> multiplyChecked(detail::ArgumentType<IntT> other)
+    {
+      const ClampReaction reaction = detail::observe<IntT>(detail::Operation::MULTIPLY,
+          Kernels::multiply(this->_value, other, this->_minValue, this->_maxValue));
+      return {this->_value, reaction};
+    }
+    
+    /**
+     * Divides this number by the raw number given, as constrained by this
+     * number's bounds, reporting whether the quotient saturated at either
+     * bound.
+     * 
+     * \param other the right operand for division
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<IntT> divideChecked(detail::ArgumentType<IntT> other)
+    {
+      const ClampReaction reaction = detail::observe<IntT>(detail::Operation::DIVIDE,
+          Kernels::divide(this->_value, other, this->_minValue, this->_maxValue));
+      return {this->_value, reaction};
+    }
+    
+    /**
+     * Sets this number's value to the remainder of division by the raw number
+     * given, as constrained by this number's bounds, reporting whether the
+     * remainder saturated at either bound.
+     * 
+     * \param other the value by which to divide this one
+     * \return Returns this number's new value, and how it was clamped.
+     */
+    virtual ClampResult<IntT> moduloChecked(detail::ArgumentType<IntT> other)
+    {
+      const ClampReaction reaction = detail::observe<IntT>(detail::Operation::MODULO,
+          Kernels::modulo(this->_value, other, this->_minValue, this->_maxValue));
+      return {this->_value, reaction};
+    }
+    
+    /**
+     * Increments this number by `one`, within its bounds.
+     * 
+     * \return Returns this number post-incrementation.
+     */
+    virtual ClampedFixed<IntT, FracBits> & operator++()
+    {
+      return (*this += one);
+    }
+    
+    /**
+     * Decrements this number by `one`, within its bounds.
+     * 
+     * \return Returns this number post-decrementation.
+     */
+    virtual ClampedFixed<IntT, FracBits> & operator--()
+    {
+      return (*this -= one);
+    }
+    
+    /**
+     * Increments this number by `one`, within its bounds.
+     * 
+     * \return Returns a copy of this number, reflecting its state prior
+     * to incrementation.
+     */
+    virtual ClampedFixed<IntT, FracBits> operator++(int)
+    {
+      ClampedFixed<IntT, FracBits> preIncr(*this);
+      ++(*this);
+      return preIncr;
+    }
+    
+    /**
+     * Decrements this number by `one`, within its bounds.
+     * 
+     * \return Returns a copy of this number, reflecting its state prior
+     * to decrementation.
+     */
+    virtual ClampedFixed<IntT, FracBits> operator--(int)
+    {
+      ClampedFixed<IntT, FracBits> preDecr(*this);
+      --(*this);
+      return preDecr;
+    }
+  };
+  
+  /**
+   * Returns a new `ClampedFixed` with a value equal to that of the original,
+   * plus the given raw number, within the clamped number's bounds.
+   * 
+   * \param lhs the original number which is added to
+   * \param rhs the raw number added onto this one
+   * \return Returns the sum of this and the other number.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator+(const ClampedFixed<IntT, FracBits> &lhs, const IntT &rhs)
+  {
+    ClampedFixed<IntT, FracBits> sum(lhs);
+    sum += rhs;
+    return sum;
+  }
+  
+  /**
+   * Returns the sum of a temporary `ClampedFixed` and the given raw number, as
+   * the other overload does, but reusing the temporary in place of a copy.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the sum, moved out of `lhs`.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator+(ClampedFixed<IntT, FracBits> &&lhs, const IntT &rhs)
+  {
+    lhs += rhs;
+    return std::move(lhs);
+  }
+  
+  /**
+   * Returns a new `ClampedFixed` with a value equal to that of the original,
+   * minus the given raw number, within the clamped number's bounds.
+   * 
+   * \param lhs the original number which is subtracted from
+   * \param rhs the raw number subtracted from this one
+   * \return Returns the difference of this and the other number.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator-(const ClampedFixed<IntT, FracBits> &lhs, const IntT &rhs)
+  {
+    ClampedFixed<IntT, FracBits> difference(lhs);
+    difference -= rhs;
+    return difference;
+  }
+  
+  /**
+   * Returns the difference of a temporary `ClampedFixed` and the given raw
+   * number, as the other overload does, but reusing the temporary in place of
+   * a copy.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the difference, moved out of `lhs`.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator-(ClampedFixed<IntT, FracBits> &&lhs, const IntT &rhs)
+  {
+    lhs -= rhs;
+    return std::move(lhs);
+  }
+  
+  /**
+   * Returns a new `ClampedFixed` with a value equal to that of the original,
+   * multiplied by the given raw number, rounded toward zero and within the
+   * clamped number's bounds.
+   * 
+   * \param lhs the original number which is multiplied
+   * \param rhs the raw number by which this one is multiplied
+   * \return Returns the product of this and the other number.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator*(const ClampedFixed<IntT, FracBits> &lhs, const IntT &rhs)
+  {
+    ClampedFixed<IntT, FracBits> product(lhs);
+    product *= rhs;
+    return product;
+  }
+  
+  /**
+   * Returns the product of a temporary `ClampedFixed` and the given raw number,
+   * as the other overload does, but reusing the temporary in place of a copy.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the product, moved out of `lhs`.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator*(ClampedFixed<IntT, FracBits> &&lhs, const IntT &rhs)
+  {
+    lhs *= rhs;
+    return std::move(lhs);
+  }
+  
+  /**
+   * Returns a new `ClampedFixed` with a value equal to that of the original,
+   * divided by the given raw number, rounded toward zero and within the
+   * clamped number's bounds.
+   * 
+   * \param lhs the original number which is divided
+   * \param rhs the raw number by which this one is divided
+   * \return Returns the quotient of this and the other number.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator/(const ClampedFixed<IntT, FracBits> &lhs, const IntT &rhs)
+  {
+    ClampedFixed<IntT, FracBits> quotient(lhs);
+    quotient /= rhs;
+    return quotient;
+  }
+  
+  /**
+   * Returns the quotient of a temporary `ClampedFixed` and the given raw
+   * number, as the other overload does, but reusing the temporary in place of
+   * a copy.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the quotient, moved out of `lhs`.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator/(ClampedFixed<IntT, FracBits> &&lhs, const IntT &rhs)
+  {
+    lhs /= rhs;
+    return std::move(lhs);
+  }
+  
+  /**
+   * Returns a new `ClampedFixed` with a value equal to the remainder of the
+   * original's division by the given raw number, within the clamped number's
+   * bounds.
+   * 
+   * \param lhs the original number which is divided
+   * \param rhs the raw number by which this one is divided
+   * \return Returns the remainder of this number divided by the other.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator%(const ClampedFixed<IntT, FracBits> &lhs, const IntT &rhs)
+  {
+    ClampedFixed<IntT, FracBits> remainder(lhs);
+    remainder %= rhs;
+    return remainder;
+  }
+  
+  /**
+   * Returns the remainder of a temporary `ClampedFixed` divided by the given
+   * raw number, as the other overload does, but reusing the temporary in
+   * place of a copy.
+   * 
+   * \param lhs the temporary number, which is left moved-from
+   * \param rhs the right operand
+   * \return Returns the remainder, moved out of `lhs`.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator%(ClampedFixed<IntT, FracBits> &&lhs, const IntT &rhs)
+  {
+    lhs %= rhs;
+    return std::move(lhs);
+  }
+  
+  /**
+   * Returns a new `ClampedFixed` of the same bounds as `lhs`, with a value
+   * equal to the sum of the values of `lhs` and `rhs`. The bounds of `rhs`
+   * play no part.
+   * 
+   * \param lhs the number which is added to
+   * \param rhs the number whose value is the right operand
+   * \return Returns the sum of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator+(const ClampedFixed<IntT, FracBits> &lhs,
+      const ClampedFixed<IntT, FracBits> &rhs)
+  {
+    return lhs + rhs.value();
+  }
+  
+  /**
+   * Returns a new `ClampedFixed` of the same bounds as `lhs`, with a value
+   * equal to the difference of the values of `lhs` and `rhs`.
+   * 
+   * \param lhs the number which is subtracted from
+   * \param rhs the number whose value is the right operand
+   * \return Returns the difference of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator-(const ClampedFixed<IntT, FracBits> &lhs,
+      const ClampedFixed<IntT, FracBits> &rhs)
+  {
+    return lhs - rhs.value();
+  }
+  
+  /**
+   * Returns a new `ClampedFixed` of the same bounds as `lhs`, with a value
+   * equal to the product of the values of `lhs` and `rhs`, rounded toward
+   * zero.
+   * 
+   * \param lhs the number which is multiplied
+   * \param rhs the number whose value is the right operand
+   * \return Returns the product of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator*(const ClampedFixed<IntT, FracBits> &lhs,
+      const ClampedFixed<IntT, FracBits> &rhs)
+  {
+    return lhs * rhs.value();
+  }
+  
+  /**
+   * Returns a new `ClampedFixed` of the same bounds as `lhs`, with a value
+   * equal to the quotient of the values of `lhs` and `rhs`, rounded toward
+   * zero.
+   * 
+   * \param lhs the number which is divided
+   * \param rhs the number whose value is the right operand
+   * \return Returns the quotient of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator/(const ClampedFixed<IntT, FracBits> &lhs,
+      const ClampedFixed<IntT, FracBits> &rhs)
+  {
+    return lhs / rhs.value();
+  }
+  
+  /**
+   * Returns a new `ClampedFixed` of the same bounds as `lhs`, with a value
+   * equal to the remainder of the division of the values of `lhs` and `rhs`.
+   * 
+   * \param lhs the number which is divided
+   * \param rhs the number whose value is the right operand
+   * \return Returns the remainder of the two, clamped into `lhs`'s bounds.
+   * 
+   * \related ClampedFixed
+   */
+  template<typename IntT, unsigned FracBits>
+  ClampedFixed<IntT, FracBits> operator%(const ClampedFixed<IntT, FracBits> &lhs,
+      const ClampedFixed<IntT, FracBits> &rhs)
+  {
+    return lhs % rhs.value();
+  }
+  
+  namespace batch
+  {
+    /**
+     * Multiplies each of `count` raw Q-format values by the given raw number,
+     * as `ClampedFixed<IntT, FracBits>::operator*=()` does, each product
+     * rounded toward zero and constrained by the given bounds. Raw sums and
+     * differences need no counterpart: `add()` and `subtract()` already
+     * compute them, through the vector kernels.
+     * 
+     * \param values the buffer of raw values to modify in place
+     * \param count the number of values in the buffer
+     * \param other the raw right operand for multiplication
+     * \param min the raw minimum value shared by every element
+     * \param max the raw maximum value shared by every element
+     */
+    template<unsigned FracBits, typename IntT>
+    void multiplyFixed(IntT *values, std::size_t count, const typename detail::BatchOperand<IntT>::type &other,
+        const typename detail::BatchOperand<IntT>::type &min, const typename detail::BatchOperand<IntT>::type &max)
+    {
+      // The kernel clamps with selects alone, so that this loop vectorizes
+      for(std::size_t i = 0; i < count; ++i)
+        detail::FixedKernels<IntT, FracBits>::multiply(values[i], other, min, max);
+    }
+    
+    /**
+     * Divides each of `count` raw Q-format values by the given raw number, as
+     * `ClampedFixed<IntT, FracBits>::operator/=()` does, each quotient rounded
+     * toward zero and constrained by the given bounds. Division by zero
+     * yields `max` or `min` for each element, depending on its sign prior to
+     * division.
+     * 
+     * \param values the buffer of raw values to modify in place
+     * \param count the number of values in the buffer
+     * \param other the raw right operand for division
+     * \param min the raw minimum value shared by every element
+     * \param max the raw maximum value shared by every element
+     */
+    template<unsigned FracBits, typename IntT>
+    void divideFixed(IntT *values, std::size_t count, const typename detail::BatchOperand<IntT>::type &other,
+        const typename detail::BatchOperand<IntT>::type &min, const typename detail::BatchOperand<IntT>::type &max)
+    {
+      for(std::size_t i = 0; i < count; ++i)
+        detail::FixedKernels<IntT, FracBits>::divide(values[i], other, min, max);
+    }
+  }
+  
+# ifdef CLAMPED_INT16
+  
+  /**
+   * A fixed-point number of 16 bits, 8 of them fractional, spanning [-128,
+   * 128) in steps of 1/256.
+   */
+  using ClampedQ8_8 = ClampedFixed<int16_t, 8>;
+  
+  /**
+   * A fixed-point number of 16 bits, 15 of them fractional, spanning [-1, 1)
+   * in steps of 2^-15.
+   */
+  using ClampedQ15 = ClampedFixed<int16_t, 15>;
+  
+# endif
+
+# ifdef CLAMPED_INT32
+  
+  /**
+   * A fixed-point number of 32 bits, 16 of them fractional, spanning [-32768,
+   * 32768) in steps of 1/65536.
+   */
+  using ClampedQ16_16 = ClampedFixed<int32_t, 16>;
+  
+  /**
+   * A fixed-point number of 32 bits, 31 of them fractional, spanning [-1, 1)
+   * in steps of 2^-31.
+   */
+  using ClampedQ31 = ClampedFixed<int32_t, 31>;
+  
+# endif
+}
@@ -0,0 +1,1542 @@
+/** \file
+ * The non-polymorphic clamped number hierarchy.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <limits>
+#include <type_traits>
+
+#if __cplusplus > 201703L && defined(__has_include)
+# if __has_include(<compare>)
+#include <compare>
+# endif
+# if __has_include(<span>)
+#include <span>
+# endif
+#endif
+
+#include "clamp_kernels.hh"
+
+namespace clamped
+{
+  /**
+   * Non-polymorphic counterparts of the clamped number types. Every type in
+   * this namespace shares its bounds semantics with the like-named type in
+   * `clamped`, but declares no virtual functions: a `flat` number holds
+   * exactly its value, minimum, and maximum, is trivially copyable (and so may
+   * be `memcpy`'d in bulk), and lets the compiler inline every operator.
+   * Every constructor and operator is also `constexpr`, so `flat` numbers may
+   * be computed during compilation, as in lookup tables and `static_assert`s.
+   * 
+   * The price is that `flat` numbers cannot be held or destroyed through a
+   * pointer to their base. Code which needs that should use the polymorphic
+   * hierarchy instead.
+   */
+  namespace flat
+  {
+    /**
+     * A generic number with defined lower and upper bounds beyond which its
+     * value will never pass. This is the non-polymorphic equivalent of
+     * `clamped::BasicClampedNumber`, with which it shares its construction,
+     * accessor, and comparison semantics.
+     * 
+     * \param NumT the numeric type being bounded
+     * 
+     * \see ClampedNaturalNumber ClampedInteger ClampedDecimal
+     */
+    template<typename NumT>
+    class BasicClampedNumber
+    {
+      protected:
+      
+      NumT _value;
+      NumT _minValue;
+      NumT _maxValue;
+      
+      public:
+      
+      /**
+       * The default constructor is disabled. A `BasicClampedNumber` is
+       * sufficiently general that no reasonable default values can be
+       * generated.
+       */
+      BasicClampedNumber() = delete;
+      
+      /**
+       * Constructs a new `BasicClampedNumber` with the specified current,
+       * minimum, and maximum values. The minimum value must be less than or
+       * equal to the starting value: if it is not, it is itself clamped to the
+       * starting value. The maximum value is similarly constrained, and must be
+       * greater than or equal to the starting value.
+       * 
+       * \param value the starting value of this number
+       * \param min the minimum value for this number
+       * \param max the maximum value for this number
+       */
+      constexpr BasicClampedNumber(const NumT &value, const NumT &min, const NumT &max):
+          _value(value), _minValue((min <= value) ? min : value), _maxValue((max >= value) ? max : value)
+      {}
+      
+      public:
+      
+      /**
+       * Returns this number's current value by const reference.
+       * 
+       * \return Returns this number's current value.
+       */
+      constexpr const NumT & value() const
+      {
+        return this->_value;
+      }
+      
+      /**
+       * Returns this number's current maximum value by const reference.
+       * 
+       * \return Returns this number's current maximum value.
+       */
+      constexpr const NumT & maxValue() const
+      {
+        return this->_maxValue;
+      }
+      
+      /**
+       * Returns this number's current minimum value by const reference.
+       * 
+       * \return Returns this number's current minimum value.
+       */
+      constexpr const NumT & minValue() const
+      {
+        return this->_minValue;
+      }
+      
+      /**
+       * Sets this number's current value, as constrained by its bounds.
+       * 
+       * \param newVal the new new value for this number
+       * \return Returns this number's current value after reassignment.
+       */
+      constexpr const NumT & value(const NumT &newVal)
+      {
+        detail::observe<NumT>(detail::Operation::ASSIGN,
+            detail::assignClamped(this->_value, newVal, this->_minValue, this->_maxValue));
+        return this->_value;
+      }
+      
+      /**
+       * Sets this number's maximum value to that specified. The new maximum
+       * must still be greater than or equal to the current stored value: if it
+       * is not, it is constrained to the current value.
+       * 
+       * \param newMax the new maximum for this number
+       * \return Returns this number's maximum value after reassignment.
+       */
+      constexpr const NumT & maxValue(const NumT &newMax)
+      {
+        return detail::stretchMaximum(this->_value, this->_maxValue, newMax);
+      }
+      
+      /**
+       * Sets this number's minimum value to that specified. The minimum must
+       * still be less than or equal to the current stored value: if it is not,
+       * it is constrained to the current value.
+       * 
+       * \param newMin the new minimum for this number
+       * \return Returns this number's minimum value after reassignment.
+       */
+      constexpr const NumT & minValue(const NumT &newMin)
+      {
+        return detail::stretchMinimum(this->_value, this->_minValue, newMin);
+      }
+      
+      /**
+       * Sets both of this number's bounds at once. Under the default
+       * `ReboundPolicy::STRETCH` this is the same as `minValue(newMin)`
+       * followed by `maxValue(newMax)`; under `ReboundPolicy::CLAMP` the
+       * bounds are taken as given and the current value is instead clamped
+       * into them.
+       * 
+       * \param newMin the new minimum for this number
+       * \param newMax the new maximum for this number
+       * 
+       * \see flat::rebound()
+       */
+      template<ReboundPolicy Policy = ReboundPolicy::STRETCH> constexpr
+      void rebound(const NumT &newMin, const NumT &newMax)
+      {
+        detail::reboundClamped<Policy>(this->_value, this->_minValue, this->_maxValue, newMin, newMax);
+      }
+      
+      /**
+       * Sets this number's current value to its minimum.
+       * 
+       * \return Returns this number's current value after modification.
+       */
+      constexpr const NumT & minimize()
+      {
+        return (this->_value = this->_minValue);
+      }
+      
+      /**
+       * Sets this number's current value to its maximum.
+       * 
+       * \return Returns this number's current value after modification.
+       */
+      constexpr const NumT & maximize()
+      {
+        return (this->_value = this->_maxValue);
+      }
+      
+      /**
+       * Returns whether this number equals the other. Only the primary stored
+       * value is considered.
+       * 
+       * \param other the right operand compared against
+       * \return Returns true if this number equals the other, else false
+       */
+      constexpr bool operator==(const BasicClampedNumber<NumT> &other) const
+      {
+        return this->_value == other._value;
+      }
+      
+      /**
+       * Returns whether this number is not equal to the other. Only the
+       * primary stored value is considered.
+       * 
+       * \param other the right operand compared against
+       * \return Returns true if this number does not equal the other, else
+       * false
+       */
+      constexpr bool operator!=(const BasicClampedNumber<NumT> &other) const
+      {
+        return !(this->_value == other._value);
+      }
+      
+      /**
+       * Returns whether this number is less than the other. Only the primary
+       * stored value is considered.
+       * 
+       * \param other the right operand compared against
+       * \return Returns true if this number is less than the other, else false
+       */
+      constexpr bool operator<(const BasicClampedNumber<NumT> &other) const
+      {
+        return this->_value < other._value;
+      }
+      
+      /**
+       * Returns whether this number is less than or equal to the other. Only
+       * the primary stored value is considered.
+       * 
+       * \param other the right operand compared against
+       * \return Returns true if this number is less than or equal to the
+       * other, else false
+       */
+      constexpr bool operator<=(const BasicClampedNumber<NumT> &other) const
+      {
+        return this->_value <= other._value;
+      }
+      
+      /**
+       * Returns whether this number is greater than the other. Only the
+       * primary stored value is considered.
+       * 
+       * \param other the right operand compared against
+       * \return Returns true if this number is greater than the other, else
+       * false
+       */
+      constexpr bool operator>(const BasicClampedNumber<NumT> &other) const
+      {
+        return this->_value > other._value;
+      }
+      
+      /**
+       * Returns whether this number is greater than or equal to the other.
+       * Only the primary stored value is considered.
+       * 
+       * \param other the right operand compared against
+       * \return Returns true if this number is greater than or equal to the
+       * other, else false
+       */
+      constexpr bool operator>=(const BasicClampedNumber<NumT> &other) const
+      {
+        return this->_value >= other._value;
+      }
+      
+# ifdef __cpp_lib_three_way_comparison
+      /**
+       * Returns how this number orders against the other, as `<=>` orders
+       * their values: `std::strong_ordering` for integers, and
+       * `std::partial_ordering` for decimals, under which NaN is unordered.
+       * Only the primary stored value is considered. A `std::sort` or
+       * `std::ranges::sort` by it reads each value once per comparison.
+       * 
+       * \param other the right operand compared against
+       * \return Returns the ordering of this number's value against the
+       * other's.
+       */
+      constexpr auto operator<=>(const BasicClampedNumber<NumT> &other) const
+      {
+        return this->_value <=> other._value;
+      }
+# endif
+      
+      /**
+       * Allows the explicit conversion of this number to an instance of
+       * `NumT`, the numerical type it wraps.
+       * 
+       * \return Returns a copy of this number's internal value.
+       */
+      explicit constexpr operator NumT() const
+      {
+        return this->_value;
+      }
+      
+      /**
+       * Allows the explicit conversion of this number to a boolean value. This
+       * is equivalent to asking whether `NumT(*this) == 0`, in line with
+       * `clamped::BasicClampedNumber`.
+       * 
+       * \return Returns true if this number equals zero, else false.
+       */
+      explicit constexpr operator bool() const
+      {
+        return this->_value == 0;
+      }
+    };
+    
+    /**
+     * A natural number with defined lower and upper bounds beyond which its
+     * value will never pass. This is the non-polymorphic equivalent of
+     * `clamped::ClampedNaturalNumber`. Where `std::numeric_limits` is
+     * specialized for `NatT`, the bounds may be omitted, in which case they
+     * default to the limits of `NatT` itself.
+     * 
+     * \param NatT the unsigned integral type being wrapped
+     * 
+     * \see ClampedInteger
+     */
+    template<typename NatT>
+    class ClampedNaturalNumber: public BasicClampedNumber<NatT>
+    {
+      public:
+      
+      /**
+       * Constructs a new `ClampedNaturalNumber` with an initial value of zero
+       * and bounds equal to the limits of `NatT`.
+       */
+      constexpr ClampedNaturalNumber():
+          BasicClampedNumber<NatT>(0, std::numeric_limits<NatT>::min(), std::numeric_limits<NatT>::max())
+      {}
+      
+      /**
+       * Constructs a new `ClampedNaturalNumber` with the given initial value
+       * and bounds equal to the limits of `NatT`.
+       * 
+       * \param value the starting value of this number
+       */
+      constexpr ClampedNaturalNumber(const NatT &value):
+          BasicClampedNumber<NatT>(value, std::numeric_limits<NatT>::min(), std::numeric_limits<NatT>::max())
+      {}
+      
+      /**
+       * Constructs a new `ClampedNaturalNumber` with the specified current,
+       * minimum, and maximum values, stretching the bounds to fit the starting
+       * value where necessary.
+       * 
+       * \param value the starting value of this number
+       * \param min the minimum value for this number
+       * \param max the maximum value for this number
+       */
+      constexpr ClampedNaturalNumber(const NatT &value, const NatT &min, const NatT &max):
+          BasicClampedNumber<NatT>(value, min, max)
+      {}
+      
+      public:
+      
+      /**
+       * Adds the given number to this one, as constrained by this
+       * number's bounds.
+       * 
+       * \param other the right operand for addition
+       * \return Returns this number, allowing chaining of operations.
+       */
+      constexpr ClampedNaturalNumber<NatT> & operator+=(const NatT &other)
+      {
+        detail::observe<NatT>(detail::Operation::ADD,
+            detail::NaturalKernels<NatT>::add(this->_value, other, this->_minValue, this->_maxValue));
+        return *this;
+      }
+      
+      /**
+       * Subtracts the given number from this one, as constrained by this
+       * number's bounds.
+       * 
+       * \param other the right operand for subtraction
+       * \return Returns this number, allowing chaining of operations.
+       */
+      constexpr ClampedNaturalNumber<NatT> & operator-=(const NatT &other)
+      {
+        detail::observe<NatT>(detail::Operation::SUBTRACT,
+            detail::NaturalKernels<NatT>::subtract(this->_value, other, this->_minValue, this->_maxValue));
+        return *this;
+      }
+      
+      /**
+       * Multiplies this number by the one given, as constrained by this
+       * number's bounds.
+       * 
+       * \param other the right operand for multiplication
+       * \return Returns this number, allowing chaining of operations.
+       */
+      constexpr ClampedNaturalNumber<NatT> & operator*=(const NatT &other)
+      {
+        detail::observe<NatT>(detail::Operation::MULTIPLY,
+            detail::NaturalKernels<NatT>::multiply(this->_value, other, this->_minValue, this->_maxValue));
+        return *this;
+      }
+      
+      /**
+       * Divides this number by the one given, as constrained by this number's
+       * bounds. Division by zero yields this number's maximum.
+       * 
+       * \param other the right operand for division
+       * \return Returns this number, allowing chaining of operations.
+       */
+      constexpr ClampedNaturalNumber<NatT> & operator/=(const NatT &other)
+      {
+        detail::observe<NatT>(detail::Operation::DIVIDE,
+            detail::NaturalKernels<NatT>::divide(this->_value, other, this->_minValue, this->_maxValue));
+        return *this;
+      }
+      
+      /**
+       * Sets this number's value to the remainder of division by the given
+       * number, within this number's bounds.
+       * 
+       * \param other the value by which to divide this one
+       * \return Returns this number, allowing chain of operations.
+       */
+      constexpr ClampedNaturalNumber<NatT> & operator%=(const NatT &other)
+      {
+        detail::observe<NatT>(detail::Operation::MODULO,
+            detail::NaturalKernels<NatT>::modulo(this->_value, other, this->_minValue, this->_maxValue));
+        return *this;
+      }
+      
+      /**
+       * Adds the given number to this one, as constrained by this number's
+       * bounds, reporting whether the sum saturated at either bound.
+       * 
+       * \param other the right operand for addition
+       * \return Returns this number's new value, and how it was clamped.
+       */
+      constexpr ClampResult<NatT> addChecked(const NatT &other)
+      {
+        const ClampReaction reaction = detail::observe<NatT>(detail::Operation::ADD,
+            detail::NaturalKernels<NatT>::add(this->_value, other, this->_minValue, this->_maxValue));
+        return {this->_value, reaction};
+      }
+      
+      /**
+       * Subtracts the given number from this one, as constrained by this
+       * number's bounds, reporting whether the difference saturated at either
+       * bound.
+       * 
+       * \param other the right operand for subtraction
+       * \return Returns this number's new value, and how it was clamped.
+       */
+      constexpr ClampResult<NatT> subtractChecked(const NatT &other)
+      {
+        const ClampReaction reaction = detail::observe<NatT>(detail::Operation::SUBTRACT,
+            detail::NaturalKernels<NatT>::subtract(this->_value, other, this->_minValue, this->_maxValue));
+        return {this->_value, reaction};
+      }
+      
+      /**
+       * Multiplies this number by the one given, as constrained by this
+       * number's bounds, reporting whether the product saturated at either
+       * bound.
+       * 
+       * \param other the right operand for multiplication
+       * \return Returns this number's new value, and how it was clamped.
+       */
+      constexpr ClampResult<NatT> multiplyChecked(const NatT &other)
+      {
+        const ClampReaction reaction = detail::observe<NatT>(detail::Operation::MULTIPLY,
+            detail::NaturalKernels<NatT>::multiply(this->_value, other, this->_minValue, this->_maxValue));
+        return {this->_value, reaction};
+      }
+      
+      /**
+       * Divides this number by the one given, as constrained by this number's
+       * bounds, reporting whether the quotient saturated at either bound.
+       * 
+       * \param other the right operand for division
+       * \return Returns this number's new value, and how it was clamped.
+       */
+      constexpr ClampResult<NatT> divideChecked(const NatT &other)
+      {
+        const ClampReaction reaction = detail::observe<NatT>(detail::Operation::DIVIDE,
+            detail::NaturalKernels<NatT>::divide(this->_value, other, this->_minValue, this->_maxValue));
+        return {this->_value, reaction};
+      }
+      
+      /**
+       * Sets this number's value to the remainder of division by the one given,
+       * as constrained by this number's bounds, reporting whether the remainder
+       * saturated at either bound.
+       * 
+       * \param other the value by which to divide this one
+       * \return Returns this number's new value, and how it was clamped.
+       */
+      constexpr ClampResult<NatT> moduloChecked(const NatT &other)
+      {
+        const ClampReaction reaction = detail::observe<NatT>(detail::Operation::MODULO,
+            detail::NaturalKernels<NatT>::modulo(this->_value, other, this->_minValue, this->_maxValue));
+        return {this->_value, reaction};
+      }
+      
+      /**
+       * Increments this number by one, within its bounds.
+       * 
+       * \return Returns this number post-incrementation.
+       */
+      constexpr ClampedNaturalNumber<NatT> & operator++()
+      {
+        return (*this += 1);
+      }
+      
+      /**
+       * Decrements this number by one, within its bounds.
+       * 
+       * \return Returns this number post-decrementation.
+       */
+      constexpr ClampedNaturalNumber<NatT> & operator--()
+      {
+        return (*this -= 1);
+      }
+      
+      /**
+       * Increments this number by one, within its bounds.
+       * 
+       * \return Returns a copy of this number, reflecting its state prior
+       * to incrementation.
+       */
+      constexpr ClampedNaturalNumber<NatT> operator++(int)
+      {
+        ClampedNaturalNumber<NatT> preIncr(*this);
+        ++(*this);
+        return preIncr;
+      }
+      
+      /**
+       * Decrements this number by one, within its bounds.
+       * 
+       * \return Returns a copy of this number, reflecting its state prior
+       * to decrementation.
+       */
+      constexpr ClampedNaturalNumber<NatT> operator--(int)
+      {
+        ClampedNaturalNumber<NatT> preDecr(*this);
+        --(*this);
+        return preDecr;
+      }
+    };
+    
+    /**
+     * Returns the sum of the given number and a `NatT`, within the clamped
+     * number's bounds.
+     * 
+     * \related ClampedNaturalNumber
+     */
+    template<typename NatT> constexpr
+    ClampedNaturalNumber<NatT> operator+(ClampedNaturalNumber<NatT> lhs, const NatT &rhs)
+    {
+      return (lhs += rhs);
+    }
+    
+    /**
+     * Returns the difference of the given number and a `NatT`, within the
+     * clamped number's bounds.
+     * 
+     * \related ClampedNaturalNumber
+     */
+    template<typename NatT> constexpr
+    ClampedNaturalNumber<NatT> operator-(ClampedNaturalNumber<NatT> lhs, const NatT &rhs)
+    {
+      return (lhs -= rhs);
+    }
+    
+    /**
+     * Returns the product of the given number and a `NatT`, within the
+     * clamped number's bounds.
+     * 
+     * \related ClampedNaturalNumber
+     */
+    template<typename NatT> constexpr
+    ClampedNaturalNumber<NatT> operator*(ClampedNaturalNumber<NatT> lhs, const NatT &rhs)
+    {
+      return (lhs *= rhs);
+    }
+    
+    /**
+     * Returns the quotient of the given number and a `NatT`, within the
+     * clamped number's bounds.
+     * 
+     * \related ClampedNaturalNumber
+     */
+    template<typename NatT> constexpr
+    ClampedNaturalNumber<NatT> operator/(ClampedNaturalNumber<NatT> lhs, const NatT &rhs)
+    {
+      return (lhs /= rhs);
+    }
+    
+    /**
+     * Returns the remainder of dividing the given number by a `NatT`, within
+     * the clamped number's bounds.
+     * 
+     * \related ClampedNaturalNumber
+     */
+    template<typename NatT> constexpr
+    ClampedNaturalNumber<NatT> operator%(ClampedNaturalNumber<NatT> lhs, const NatT &rhs)
+    {
+      return (lhs %= rhs);
+    }
+    
+    /**
+     * Returns the product of the given number and `a`, plus `b`, within the
+     * clamped number's bounds. Under the default `ClampPolicy::AT_END`, this
+     * is evaluated in a wider type and clamped once, rather than after both
+     * steps as `num * a + b` would.
+     * 
+     * \related ClampedNaturalNumber
+     */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename NatT> constexpr
+    ClampedNaturalNumber<NatT> multiplyAdd(const ClampedNaturalNumber<NatT> &x, const NatT &a, const NatT &b)
+    {
+      NatT value = x.value();
+      detail::multiplyAdd<Policy, detail::NaturalKernels<NatT>>(value, a, b, x.minValue(), x.maxValue());
+      return {value, x.minValue(), x.maxValue()};
+    }
+    
+    /**
+     * Returns the product of the given number and `a`, plus `b`, all divided
+     * by `c`, within the clamped number's bounds. Under the default
+     * `ClampPolicy::AT_END`, this is evaluated in a wider type and clamped
+     * once, rather than after every step as `(num * a + b) / c` would.
+     * 
+     * \related ClampedNaturalNumber
+     */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename NatT> constexpr
+    ClampedNaturalNumber<NatT> multiplyAddDivide(const ClampedNaturalNumber<NatT> &x,
+        const NatT &a, const NatT &b, const NatT &c)
+    {
+      NatT value = x.value();
+      detail::multiplyAddDivide<Policy, detail::NaturalKernels<NatT>>(value, a, b, c,
+          x.minValue(), x.maxValue());
+      return {value, x.minValue(), x.maxValue()};
+    }
+    
+    /**
+     * An integer with defined lower and upper bounds beyond which its value
+     * will never pass. This is the non-polymorphic equivalent of
+     * `clamped::ClampedInteger`. Where `std::numeric_limits` is specialized
+     * for `IntT`, the bounds may be omitted, in which case they default to the
+     * limits of `IntT` itself.
+     * 
+     * \param IntT the signed integral type being wrapped
+     * 
+     * \see ClampedNaturalNumber ClampedDecimal
+     */
+    template<typename IntT>
+    class ClampedInteger: public BasicClampedNumber<IntT>
+    {
+      public:
+      
+      /**
+       * Constructs a new `ClampedInteger` with an initial value of zero and
+       * bounds equal to the limits of `IntT`.
+       */
+      constexpr ClampedInteger():
+          BasicClampedNumber<IntT>(0, std::numeric_limits<IntT>::min(), std::numeric_limits<IntT>::max())
+      {}
+      
+      /**
+       * Constructs a new `ClampedInteger` with the given initial value and
+       * bounds equal to the limits of `IntT`.
+       * 
+       * \param value the starting value of this number
+       */
+      constexpr ClampedInteger(const IntT &value):
+          BasicClampedNumber<IntT>(value, std::numeric_limits<IntT>::min(), std::numeric_limits<IntT>::max())
+      {}
+      
+      /**
+       * Constructs a new `ClampedInteger` with the specified current, minimum,
+       * and maximum values, stretching the bounds to fit the starting value
+       * where necessary.
+       * 
+       * \param value the starting value of this number
+       * \param min the minimum value for this number
+       * \param max the maximum value for this number
+       */
+      constexpr ClampedInteger(const IntT &value, const IntT &min, const IntT &max):
+          BasicClampedNumber<IntT>(value, min, max)
+      {}
+      
+      public:
+      
+      /**
+       * Adds the given number to this one, as constrained by this
+       * number's bounds.
+       * 
+       * \param other the right operand for addition
+       * \return Returns this number, allowing chaining of operations.
+       */
+      constexpr ClampedInteger<IntT> & operator+=(const IntT &other)
+      {
+        detail::observe<IntT>(detail::Operation::ADD,
+            detail::IntegerKernels<IntT>::add(this->_value, other, this->_minValue, this->_maxValue));
+        return *this;
+      }
+      
+      /**
+       * Subtracts the given number from this one, as constrained by this
+       * number's bounds.
+       * 
+       * \param other the right operand for subtraction
+       * \return Returns this number, allowing chaining of operations.
+       */
+      constexpr ClampedInteger<IntT> & operator-=(const IntT &other)
+      {
+        detail::observe<IntT>(detail::Operation::SUBTRACT,
+            detail::IntegerKernels<IntT>::subtract(this->_value, other, this->_minValue, this->_maxValue));
+        return *this;
+      }
+      
+      /**
+       * Multiplies this number by the one given, as constrained by this
+       * number's bounds.
+       * 
+       * \param other the right operand for multiplication
+       * \return Returns this number, allowing chaining of operations.
+       */
+      constexpr ClampedInteger<IntT> & operator*=(const IntT &other)
+      {
+        detail::observe<IntT>(detail::Operation::MULTIPLY,
+            detail::IntegerKernels<IntT>::multiply(this->_value, other, this->_minValue, this->_maxValue));
+        return *this;
+      }
+      
+      /**
+       * Divides this number by the one given, as constrained by this number's
+       * bounds. Division by zero yields this number's maximum or minimum,
+       * depending on its sign prior to division.
+       * 
+       * \param other the right operand for division
+       * \return Returns this number, allowing chaining of operations.
+       */
+      constexpr ClampedInteger<IntT> & operator/=(const IntT &other)
+      {
+        detail::observe<IntT>(detail::Operation::DIVIDE,
+            detail::IntegerKernels<IntT>::divide(this->_value, other, this->_minValue, this->_maxValue));
+        return *this;
+      }
+      
+      /**
+       * Sets this number's value to the remainder of division by the given
+       * number, within this number's bounds.
+       * 
+       * \param other the value by which to divide this one
+       * \return Returns this number, allowing chain of operations.
+       */
+      constexpr ClampedInteger<IntT> & operator%=(const IntT &other)
+      {
+        detail::observe<IntT>(detail::Operation::MODULO,
+            detail::IntegerKernels<IntT>::modulo(this->_value, other, this->_minValue, this->_maxValue));
+        return *this;
+      }
+      
+      /**
+       * Adds the given number to this one, as constrained by this number's
+       * bounds, reporting whether the sum saturated at either bound.
+       * 
+       * \param other the right operand for addition
+       * \return Returns this number's new value, and how it was clamped.
+       */
+      constexpr ClampResult<IntT> addChecked(const IntT &other)
+      {
+        const ClampReaction reaction = detail::observe<IntT>(detail::Operation::ADD,
+            detail::IntegerKernels<IntT>::add(this->_value, other, this->_minValue, this->_maxValue));
+        return {this->_value, reaction};
+      }
+      
+      /**
+       * Subtracts the given number from this one, as constrained by this
+       * number's bounds, reporting whether the difference saturated at either
+       * bound.
+       * 
+       * \param other the right operand for subtraction
+       * \return Returns this number's new value, and how it was clamped.
+       */
+      constexpr ClampResult<IntT> subtractChecked(const IntT &other)
+      {
+        const ClampReaction reaction = detail::observe<IntT>(detail::Operation::SUBTRACT,
+            detail::IntegerKernels<IntT>::subtract(this->_value, other, this->_minValue, this->_maxValue));
+        return {this->_value, reaction};
+      }
+      
+      /**
+       * Multiplies this number by the one given, as constrained by this
+       * number's bounds, reporting whether the product saturated at either
+       * bound.
+       * 
+       * \param other the right operand for multiplication
+       * \return Returns this number's new value, and how it was clamped.
+       */
+      constexpr ClampResult<IntT> multiplyChecked(const IntT &other)
+      {
+        const ClampReaction reaction = detail::observe<IntT>(detail::Operation::MULTIPLY,
+            detail::IntegerKernels<IntT>::multiply(this->_value, other, this->_minValue, this->_maxValue));
+        return {this->_value, reaction};
+      }
+      
+      /**
+       * Divides this number by the one given, as constrained by this number's
+       * bounds, reporting whether the quotient saturated at either bound.
+       * 
+       * \param other the right operand for division
+       * \return Returns this number's new value, and how it was clamped.
+       */
+      constexpr ClampResult<IntT> divideChecked(const IntT &other)
+      {
+        const ClampReaction reaction = detail::observe<IntT>(detail::Operation::DIVIDE,
+            detail::IntegerKernels<IntT>::divide(this->_value, other, this->_minValue, this->_maxValue));
+        return {this->_value, reaction};
+      }
+      
+      /**
+       * Sets this number's value to the remainder of division by the one given,
+       * as constrained by this number's bounds, reporting whether the remainder
+       * saturated at either bound.
+       * 
+       * \param other the value by which to divide this one
+       * \return Returns this number's new value, and how it was clamped.
+       */
+      constexpr ClampResult<IntT> moduloChecked(const IntT &other)
+      {
+        const ClampReaction reaction = detail::observe<IntT>(detail::Operation::MODULO,
+            detail::IntegerKernels<IntT>::modulo(this->_value, other, this->_minValue, this->_maxValue));
+        return {this->_value, reaction};
+      }
+      
+      /**
+       * Increments this number by one, within its bounds.
+       * 
+       * \return Returns this number post-incrementation.
+       */
+      constexpr ClampedInteger<IntT> & operator++()
+      {
+        return (*this += 1);
+      }
+      
+      /**
+       * Decrements this number by one, within its bounds.
+       * 
+       * \return Returns this number post-decrementation.
+       */
+      constexpr ClampedInteger<IntT> & operator--()
+      {
+        return (*this -= 1);
+      }
+      
+      /**
+       * Increments this number by one, within its bounds.
+       * 
+       * \return Returns a copy of this number, reflecting its state prior
+       * to incrementation.
+       */
+      constexpr ClampedInteger<IntT> operator++(int)
+      {
+        ClampedInteger<IntT> preIncr(*this);
+        ++(*this);
+        return preIncr;
+      }
+      
+      /**
+       * Decrements this number by one, within its bounds.
+       * 
+       * \return Returns a copy of this number, reflecting its state prior
+       * to decrementation.
+       */
+      constexpr ClampedInteger<IntT> operator--(int)
+      {
+        ClampedInteger<IntT> preDecr(*this);
+        --(*this);
+        return preDecr;
+      }
+    };
+    
+    /**
+     * Returns the sum of the given number and an `IntT`, within the clamped
+     * number's bounds.
+     * 
+     * \related ClampedInteger
+     */
+    template<typename IntT> constexpr
+    ClampedInteger<IntT> operator+(ClampedInteger<IntT> lhs, const IntT &rhs)
+    {
+      return (lhs += rhs);
+    }
+    
+    /**
+     * Returns the difference of the given number and an `IntT`, within the
+     * clamped number's bounds.
+     * 
+     * \related ClampedInteger
+     */
+    template<typename IntT> constexpr
+    ClampedInteger<IntT> operator-(ClampedInteger<IntT> lhs, const IntT &rhs)
+    {
+      return (lhs -= rhs);
+    }
+    
+    /**
+     * Returns the product of the given number and an `IntT`, within the
+     * clamped number's bounds.
+     * 
+     * \related ClampedInteger
+     */
+    template<typename IntT> constexpr
+    ClampedInteger<IntT> operator*(ClampedInteger<IntT> lhs, const IntT &rhs)
+    {
+      return (lhs *= rhs);
+    }
+    
+    /**
+     * Returns the quotient of the given number and an `IntT`, within the
+     * clamped number's bounds.
+     * 
+     * \related ClampedInteger
+     */
+    template<typename IntT> constexpr
+    ClampedInteger<IntT> operator/(ClampedInteger<IntT> lhs, const IntT &rhs)
+    {
+      return (lhs /= rhs);
+    }
+    
+    /**
+     * Returns the remainder of dividing the given number by an `IntT`, within
+     * the clamped number's bounds.
+     * 
+     * \related ClampedInteger
+     */
+    template<typename IntT> constexpr
+    ClampedInteger<IntT> operator%(ClampedInteger<IntT> lhs, const IntT &rhs)
+    {
+      return (lhs %= rhs);
+    }
+    
+    /**
+     * Returns the product of the given number and `a`, plus `b`, within the
+     * clamped number's bounds. Under the default `ClampPolicy::AT_END`, this
+     * is evaluated in a wider type and clamped once, rather than after both
+     * steps as `num * a + b` would.
+     * 
+     * \related ClampedInteger
+     */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename IntT> constexpr
+    ClampedInteger<IntT> multiplyAdd(const ClampedInteger<IntT> &x, const IntT &a, const IntT &b)
+    {
+      IntT value = x.value();
+      detail::multiplyAdd<Policy, detail::IntegerKernels<IntT>>(value, a, b, x.minValue(), x.maxValue());
+      return {value, x.minValue(), x.maxValue()};
+    }
+    
+    /**
+     * Returns the product of the given number and `a`, plus `b`, all divided
+     * by `c`, within the clamped number's bounds. Under the default
+     * `ClampPolicy::AT_END`, this is evaluated in a wider type and clamped
+     * once, rather than after every step as `(num * a + b) / c` would.
+     * 
+     * \related ClampedInteger
+     */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename IntT> constexpr
+    ClampedInteger<IntT> multiplyAddDivide(const ClampedInteger<IntT> &x,
+        const IntT &a, const IntT &b, const IntT &c)
+    {
+      IntT value = x.value();
+      detail::multiplyAddDivide<Policy, detail::IntegerKernels<IntT>>(value, a, b, c,
+          x.minValue(), x.maxValue());
+      return {value, x.minValue(), x.maxValue()};
+    }
+    
+    /**
+     * Returns the negative of the given clamped number. The held value is
+     * negated, and the bounds are stretched to fit the new value where
+     * necessary.
+     * 
+     * \related ClampedInteger
+     */
+    template<typename IntT> constexpr
+    ClampedInteger<IntT> operator-(const ClampedInteger<IntT> &orig)
+    {
+      return {IntT(-orig.value()), orig.minValue(), orig.maxValue()};
+    }
+    
+    /**
+     * A real number with defined lower and upper bounds beyond which its
+     * value will never pass. This is the non-polymorphic equivalent of
+     * `clamped::ClampedDecimal`.
+     * 
+     * \param FloatT the floating-point type being wrapped
+     * 
+     * \see ClampedInteger
+     */
+    template<typename FloatT>
+    class ClampedDecimal: public BasicClampedNumber<FloatT>
+    {
+      public:
+      
+      /**
+       * Constructs a new `ClampedDecimal` with an initial value of zero and
+       * bounds [-1, 1].
+       */
+      constexpr ClampedDecimal():
+          BasicClampedNumber<FloatT>(0, -1, 1)
+      {}
+      
+      /**
+       * Constructs a new `ClampedDecimal` with the specified current, minimum,
+       * and maximum values, stretching the bounds to fit the starting value
+       * where necessary.
+       * 
+       * \param value the starting value of this number
+       * \param min the minimum value for this number
+       * \param max the maximum value for this number
+       */
+      constexpr ClampedDecimal(const FloatT &value, const FloatT &min, const FloatT &max):
+          BasicClampedNumber<FloatT>(value, min, max)
+      {}
+      
+      public:
+      
+      /**
+       * Adds the given number to this one, as constrained by this
+       * number's bounds.
+       * 
+       * \param other the right operand for addition
+       * \return Returns this number, allowing chaining of operations.
+       */
+      constexpr ClampedDecimal<FloatT> & operator+=(const FloatT &other)
+      {
+        detail::observe<FloatT>(detail::Operation::ADD,
+            detail::DecimalKernels<FloatT>::add(this->_value, other, this->_minValue, this->_maxValue));
+        return *this;
+      }
+      
+      /**
+       * Subtracts the given number from this one, as constrained by this
+       * number's bounds.
+       * 
+       * \param other the right operand for subtraction
+       * \return Returns this number, allowing chaining of operations.
+       */
+      constexpr ClampedDecimal<FloatT> & operator-=(const FloatT &other)
+      {
+        detail::observe<FloatT>(detail::Operation::SUBTRACT,
+            detail::DecimalKernels<FloatT>::subtract(this->_value, other, this->_minValue, this->_maxValue));
+        return *this;
+      }
+      
+      /**
+       * Multiplies this number by the one given, as constrained by this
+       * number's bounds.
+       * 
+       * \param other the right operand for multiplication
+       * \return Returns this number, allowing chaining of operations.
+       */
+      constexpr ClampedDecimal<FloatT> & operator*=(const FloatT &other)
+      {
+        detail::observe<FloatT>(detail::Operation::MULTIPLY,
+            detail::DecimalKernels<FloatT>::multiply(this->_value, other, this->_minValue, this->_maxValue));
+        return *this;
+      }
+      
+      /**
+       * Divides this number by the one given, as constrained by this number's
+       * bounds. Division by zero yields this number's maximum or minimum,
+       * depending on its sign prior to division.
+       * 
+       * \param other the right operand for division
+       * \return Returns this number, allowing chaining of operations.
+       */
+      constexpr ClampedDecimal<FloatT> & operator/=(const FloatT &other)
+      {
+        detail::observe<FloatT>(detail::Operation::DIVIDE,
+            detail::DecimalKernels<FloatT>::divide(this->_value, other, this->_minValue, this->_maxValue));
+        return *this;
+      }
+      
+      /**
+       * Adds the given number to this one, as constrained by this number's
+       * bounds, reporting whether the sum saturated at either bound.
+       * 
+       * \param other the right operand for addition
+       * \return Returns this number's new value, and how it was clamped.
+       */
+      constexpr ClampResult<FloatT> addChecked(const FloatT &other)
+      {
+        const ClampReaction reaction = detail::observe<FloatT>(detail::Operation::ADD,
+            detail::DecimalKernels<FloatT>::add(this->_value, other, this->_minValue, this->_maxValue));
+        return {this->_value, reaction};
+      }
+      
+      /**
+       * Subtracts the given number from this one, as constrained by this
+       * number's bounds, reporting whether the difference saturated at either
+       * bound.
+       * 
+       * \param other the right operand for subtraction
+       * \return Returns this number's new value, and how it was clamped.
+       */
+      constexpr ClampResult<FloatT> subtractChecked(const FloatT &other)
+      {
+        const ClampReaction reaction = detail::observe<FloatT>(detail::Operation::SUBTRACT,
+            detail::DecimalKernels<FloatT>::subtract(this->_value, other, this->_minValue, this->_maxValue));
+        return {this->_value, reaction};
+      }
+      
+      /**
+       * Multiplies this number by the one given, as constrained by this
+       * number's bounds, reporting whether the product saturated at either
+       * bound.
+       * 
+       * \param other the right operand for multiplication
+       * \return Returns this number's new value, and how it was clamped.
+       */
+      constexpr ClampResult<FloatT> multiplyChecked(const FloatT &other)
+      {
+        const ClampReaction reaction = detail::observe<FloatT>(detail::Operation::MULTIPLY,
+            detail::DecimalKernels<FloatT>::multiply(this->_value, other, this->_minValue, this->_maxValue));
+        return {this->_value, reaction};
+      }
+      
+      /**
+       * Divides this number by the one given, as constrained by this number's
+       * bounds, reporting whether the quotient saturated at either bound.
+       * 
+       * \param other the right operand for division
+       * \return Returns this number's new value, and how it was clamped.
+       */
+      constexpr ClampResult<FloatT> divideChecked(const FloatT &other)
+      {
+        const ClampReaction reaction = detail::observe<FloatT>(detail::Operation::DIVIDE,
+            detail::DecimalKernels<FloatT>::divide(this->_value, other, this->_minValue, this->_maxValue));
+        return {this->_value, reaction};
+      }
+      
+      /**
+       * Increments this number by one, within its bounds.
+       * 
+       * \return Returns this number post-incrementation.
+       */
+      constexpr ClampedDecimal<FloatT> & operator++()
+      {
+        return (*this += 1);
+      }
+      
+      /**
+       * Decrements this number by one, within its bounds.
+       * 
+       * \return Returns this number post-decrementation.
+       */
+      constexpr ClampedDecimal<FloatT> & operator--()
+      {
+        return (*this -= 1);
+      }
+      
+      /**
+       * Increments this number by one, within its bounds.
+       * 
+       * \return Returns a copy of this number, reflecting its state prior
+       * to incrementation.
+       */
+      constexpr ClampedDecimal<FloatT> operator++(int)
+      {
+        ClampedDecimal<FloatT> preIncr(*this);
+        ++(*this);
+        return preIncr;
+      }
+      
+      /**
+       * Decrements this number by one, within its bounds.
+       * 
+       * \return Returns a copy of this number, reflecting its state prior
+       * to decrementation.
+       */
+      constexpr ClampedDecimal<FloatT> operator--(int)
+      {
+        ClampedDecimal<FloatT> preDecr(*this);
+        --(*this);
+        return preDecr;
+      }
+    };
+    
+    /**
+     * Returns the sum of the given number and a `FloatT`, within the clamped
+     * number's bounds.
+     * 
+     * \related ClampedDecimal
+     */
+    template<typename FloatT> constexpr
+    ClampedDecimal<FloatT> operator+(ClampedDecimal<FloatT> lhs, const FloatT &rhs)
+    {
+      return (lhs += rhs);
+    }
+    
+    /**
+     * Returns the difference of the given number and a `FloatT`, within the
+     * clamped number's bounds.
+     * 
+     * \related ClampedDecimal
+     */
+    template<typename FloatT> constexpr
+    ClampedDecimal<FloatT> operator-(ClampedDecimal<FloatT> lhs, const FloatT &rhs)
+    {
+      return (lhs -= rhs);
+    }
+    
+    /**
+     * Returns the product of the given number and a `FloatT`, within the
+     * clamped number's bounds.
+     * 
+     * \related ClampedDecimal
+     */
+    template<typename FloatT> constexpr
+    ClampedDecimal<FloatT> operator*(ClampedDecimal<FloatT> lhs, const FloatT &rhs)
+    {
+      return (lhs *= rhs);
+    }
+    
+    /**
+     * Returns the quotient of the given number and a `FloatT`, within the
+     * clamped number's bounds.
+     * 
+     * \related ClampedDecimal
+     */
+    template<typename FloatT> constexpr
+    ClampedDecimal<FloatT> operator/(ClampedDecimal<FloatT> lhs, const FloatT &rhs)
+    {
+      return (lhs /= rhs);
+    }
+    
+    /**
+     * Returns the product of the given number and `a`, plus `b`, within the
+     * clamped number's bounds. Under the default `ClampPolicy::AT_END`, this
+     * is evaluated in a wider type and clamped once, rather than after both
+     * steps as `num * a + b` would.
+     * 
+     * \related ClampedDecimal
+     */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename FloatT> constexpr
+    ClampedDecimal<FloatT> multiplyAdd(const ClampedDecimal<FloatT> &x, const FloatT &a, const FloatT &b)
+    {
+      FloatT value = x.value();
+      detail::multiplyAdd<Policy, detail::DecimalKernels<FloatT>>(value, a, b, x.minValue(), x.maxValue());
+      return {value, x.minValue(), x.maxValue()};
+    }
+    
+    /**
+     * Returns the product of the given number and `a`, plus `b`, all divided
+     * by `c`, within the clamped number's bounds. Under the default
+     * `ClampPolicy::AT_END`, this is evaluated in a wider type and clamped
+     * once, rather than after every step as `(num * a + b) / c` would.
+     * 
+     * \related ClampedDecimal
+     */
+    template<ClampPolicy Policy = ClampPolicy::AT_END, typename FloatT> constexpr
+    ClampedDecimal<FloatT> multiplyAddDivide(const ClampedDecimal<FloatT> &x,
+        const FloatT &a, const FloatT &b, const FloatT &c)
+    {
+      FloatT value = x.value();
+      detail::multiplyAddDivide<Policy, detail::DecimalKernels<FloatT>>(value, a, b, c,
+          x.minValue(), x.maxValue());
+      return {value, x.minValue(), x.maxValue()};
+    }
+    
+    /**
+     * Returns the negative of the given clamped number. The held value is
+     * negated, and the bounds are stretched to fit the new value where
+     * necessary.
+     * 
+     * \related ClampedDecimal
+     */
+    template<typename FloatT> constexpr
+    ClampedDecimal<FloatT> operator-(const ClampedDecimal<FloatT> &orig)
+    {
+      return {FloatT(-orig.value()), orig.minValue(), orig.maxValue()};
+    }
+    
+    /**
+     * Returns the sum of the given number and an arithmetic operand of another
+     * type, formed without narrowing the operand and clamped once into the
+     * number's bounds, as by the like-named operator on polymorphic numbers.
+     * 
+     * \related BasicClampedNumber
+     */
+    template<template<typename> class ClampedT, typename NumT, typename OtherT> constexpr
+    typename std::enable_if<detail::MixesWith<BasicClampedNumber, ClampedT<NumT>, NumT, OtherT>::value,
+        ClampedT<NumT>>::type
+    operator+(const ClampedT<NumT> &lhs, const OtherT &rhs)
+    {
+      return detail::combineMixed<detail::Operation::ADD>(lhs, lhs.value(), rhs);
+    }
+    
+    /**
+     * Returns the difference of the given number and an arithmetic operand of
+     * another type, formed without narrowing the operand and clamped once into
+     * the number's bounds, as by the like-named operator on polymorphic
+     * numbers.
+     * 
+     * \related BasicClampedNumber
+     */
+    template<template<typename> class ClampedT, typename NumT, typename OtherT> constexpr
+    typename std::enable_if<detail::MixesWith<BasicClampedNumber, ClampedT<NumT>, NumT, OtherT>::value,
+        ClampedT<NumT>>::type
+    operator-(const ClampedT<NumT> &lhs, const OtherT &rhs)
+    {
+      return detail::combineMixed<detail::Operation::SUBTRACT>(lhs, lhs.value(), rhs);
+    }
+    
+    /**
+     * Returns the product of the given number and an arithmetic operand of
+     * another type, formed without narrowing the operand and clamped once into
+     * the number's bounds, as by the like-named operator on polymorphic
+     * numbers.
+     * 
+     * \related BasicClampedNumber
+     */
+    template<template<typename> class ClampedT, typename NumT, typename OtherT> constexpr
+    typename std::enable_if<detail::MixesWith<BasicClampedNumber, ClampedT<NumT>, NumT, OtherT>::value,
+        ClampedT<NumT>>::type
+    operator*(const ClampedT<NumT> &lhs, const OtherT &rhs)
+    {
+      return detail::combineMixed<detail::Operation::MULTIPLY>(lhs, lhs.value(), rhs);
+    }
+    
+    /**
+     * Returns the quotient of the given number and an arithmetic operand of
+     * another type, formed without narrowing the operand and clamped once into
+     * the number's bounds, as by the like-named operator on polymorphic
+     * numbers.
+     * 
+     * \related BasicClampedNumber
+     */
+    template<template<typename> class ClampedT, typename NumT, typename OtherT> constexpr
+    typename std::enable_if<detail::MixesWith<BasicClampedNumber, ClampedT<NumT>, NumT, OtherT>::value,
+        ClampedT<NumT>>::type
+    operator/(const ClampedT<NumT> &lhs, const OtherT &rhs)
+    {
+      return detail::combineMixed<detail::Operation::DIVIDE>(lhs, lhs.value(), rhs);
+    }
+    
+    /**
+     * Returns the remainder of the given number and an integral operand of
+     * another type, formed without narrowing the operand and clamped once into
+     * the number's bounds, as by the like-named operator on polymorphic
+     * numbers.
+     * 
+     * \related BasicClampedNumber
+     */
+    template<template<typename> class ClampedT, typename NumT, typename OtherT> constexpr
+    typename std::enable_if<detail::MixesIntegrally<BasicClampedNumber, ClampedT<NumT>, NumT, OtherT>::value,
+        ClampedT<NumT>>::type
+    operator%(const ClampedT<NumT> &lhs, const OtherT &rhs)
+    {
+      return detail::combineMixed<detail::Operation::MODULO>(lhs, lhs.value(), rhs);
+    }
+    
+    /**
+     * Returns the sum of the values of two flat numbers, within the bounds
+     * of the first; the second may wrap a different type.
+     * 
+     * \related BasicClampedNumber
+     */
+    template<template<typename> class ClampedT, typename NumT,
+        template<typename> class OtherClampedT, typename OtherT> constexpr
+    typename std::enable_if<
+        detail::ClampedPair<BasicClampedNumber, ClampedT<NumT>, NumT, OtherClampedT<OtherT>, OtherT>::value,
+        ClampedT<NumT>>::type
+    operator+(const ClampedT<NumT> &lhs, const OtherClampedT<OtherT> &rhs)
+    {
+      return lhs + rhs.value();
+    }
+    
+    /**
+     * Returns the difference of the values of two flat numbers, within the
+     * bounds of the first; the second may wrap a different type.
+     * 
+     * \related BasicClampedNumber
+     */
+    template<template<typename> class ClampedT, typename NumT,
+        template<typename> class OtherClampedT, typename OtherT> constexpr
+    typename std::enable_if<
+        detail::ClampedPair<BasicClampedNumber, ClampedT<NumT>, NumT, OtherClampedT<OtherT>, OtherT>::value,
+        ClampedT<NumT>>::type
+    operator-(const ClampedT<NumT> &lhs, const OtherClampedT<OtherT> &rhs)
+    {
+      return lhs - rhs.value();
+    }
+    
+    /**
+     * Returns the product of the values of two flat numbers, within the bounds
+     * of the first; the second may wrap a different type.
+     * 
+     * \related BasicClampedNumber
+     */
+    template<template<typename> class ClampedT, typename NumT,
+        template<typename> class OtherClampedT, typename OtherT> constexpr
+    typename std::enable_if<
+        detail::ClampedPair<BasicClampedNumber, ClampedT<NumT>, NumT, OtherClampedT<OtherT>, OtherT>::value,
+        ClampedT<NumT>>::type
+    operator*(const ClampedT<NumT> &lhs, const OtherClampedT<OtherT> &rhs)
+    {
+      return lhs * rhs.value();
+    }
+    
+    /**
+     * Returns the quotient of the values of two flat numbers, within the bounds
+     * of the first; the second may wrap a different type.
+     * 
+     * \related BasicClampedNumber
+     */
+    template<template<typename> class ClampedT, typename NumT,
+        template<typename> class OtherClampedT, typename OtherT> constexpr
+    typename std::enable_if<
+        detail::ClampedPair<BasicClampedNumber, ClampedT<NumT>, NumT, OtherClampedT<OtherT>, OtherT>::value,
+        ClampedT<NumT>>::type
+    operator/(const ClampedT<NumT> &lhs, const OtherClampedT<OtherT> &rhs)
+    {
+      return lhs / rhs.value();
+    }
+    
+    /**
+     * Returns the remainder of the values of two flat numbers, within the
+     * bounds of the first; the second may wrap a different type.
+     * 
+     * \related BasicClampedNumber
+     */
+    template<template<typename> class ClampedT, typename NumT,
+        template<typename> class OtherClampedT, typename OtherT> constexpr
+    typename std::enable_if<
+        detail::ClampedPair<BasicClampedNumber, ClampedT<NumT>, NumT, OtherClampedT<OtherT>, OtherT>::value,
+        ClampedT<NumT>>::type
+    operator%(const ClampedT<NumT> &lhs, const OtherClampedT<OtherT> &rhs)
+    {
+      return lhs % rhs.value();
+    }
+    
+    /**
+     * Rebounds each of `count` contiguous `flat` numbers, as though by
+     * calling `rebound<Policy>(newMin, newMax)` on each in turn. As `flat`
+     * numbers hold nothing but their value and bounds, the pass is free of
+     * branches and calls, and vectorizes into packed minimums and maximums.
+     * 
+     * \param numbers the first of the numbers to rebound
+     * \param count the number of numbers to rebound
+     * \param newMin the new minimum for every number
+     * \param newMax the new maximum for every number
+     */
+    template<ReboundPolicy Policy = ReboundPolicy::STRETCH, typename ClampedT> constexpr
+    void rebound(ClampedT *numbers, std::size_t count, const detail::WrappedType<ClampedT> &newMin,
+        const detail::WrappedType<ClampedT> &newMax)
+    {
+      static_assert(std::is_base_of<BasicClampedNumber<detail::WrappedType<ClampedT>>, ClampedT>::value,
+          "flat::rebound() requires an array of flat clamped numbers");
+      
+      for(std::size_t i = 0; i < count; ++i)
+        numbers[i].template rebound<Policy>(newMin, newMax);
+    }
+    
+# ifdef __cpp_lib_span
+    /** \overload */
+    template<ReboundPolicy Policy = ReboundPolicy::STRETCH, typename ClampedT> constexpr
+    void rebound(std::span<ClampedT> numbers, const detail::WrappedType<ClampedT> &newMin,
+        const detail::WrappedType<ClampedT> &newMax)
+    {
+      flat::rebound<Policy>(numbers.data(), numbers.size(), newMin, newMax);
+    }
+# endif
+    
+# ifdef INT8_MAX
+    /** flat::ClampedInteger<int8_t> is aliased as flat::ClampedInt8. */
+    using ClampedInt8 = ClampedInteger<int8_t>;
+# endif
+
+# ifdef INT16_MAX
+    /** flat::ClampedInteger<int16_t> is aliased as flat::ClampedInt16. */
+    using ClampedInt16 = ClampedInteger<int16_t>;
+# endif
+
+# ifdef INT32_MAX
+    /** flat::ClampedInteger<int32_t> is aliased as flat::ClampedInt32. */
+    using ClampedInt32 = ClampedInteger<int32_t>;
+# endif
+
+# ifdef INT64_MAX
+    /** flat::ClampedInteger<int64_t> is aliased as flat::ClampedInt64. */
+    using ClampedInt64 = ClampedInteger<int64_t>;
+# endif
+
+# ifdef UINT8_MAX
+    /** flat::ClampedNaturalNumber<uint8_t> is aliased as flat::ClampedUInt8. */
+    using ClampedUInt8 = ClampedNaturalNumber<uint8_t>;
+# endif
+
+# ifdef UINT16_MAX
+    /** flat::ClampedNaturalNumber<uint16_t> is aliased as flat::ClampedUInt16. */
+    using ClampedUInt16 = ClampedNaturalNumber<uint16_t>;
+# endif
+
+# ifdef UINT32_MAX
+    /** flat::ClampedNaturalNumber<uint32_t> is aliased as flat::ClampedUInt32. */
+    using ClampedUInt32 = ClampedNaturalNumber<uint32_t>;
+# endif
+
+# ifdef UINT64_MAX
+    /** flat::ClampedNaturalNumber<uint64_t> is aliased as flat::ClampedUInt64. */
+    using ClampedUInt64 = ClampedNaturalNumber<uint64_t>;
+# endif
+    
+    /** flat::ClampedInteger<int> is aliased as flat::ClampedStdInt. */
+    using ClampedStdInt = ClampedInteger<int>;
+    
+    /** flat::ClampedNaturalNumber<unsigned int> is aliased as flat::ClampedStdUInt. */
+    using ClampedStdUInt = ClampedNaturalNumber<unsigned int>;
+    
+    /** flat::ClampedDecimal<float> is aliased as flat::ClampedFloat. */
+    using ClampedFloat = ClampedDecimal<float>;
+    
+    /** flat::ClampedDecimal<double> is aliased as flat::ClampedDouble. */
+    using ClampedDouble = ClampedDecimal<double>;
+    
+    // The whole point of this namespace: no hidden members, bitwise copyable
+    static_assert(sizeof(ClampedInteger<int>) == 3 * sizeof(int),
+        "flat::ClampedInteger must hold nothing beyond its value and bounds");
+    static_assert(sizeof(ClampedNaturalNumber<unsigned int>) == 3 * sizeof(unsigned int),
+        "flat::ClampedNaturalNumber must hold nothing beyond its value and bounds");
+    static_assert(sizeof(ClampedDecimal<double>) == 3 * sizeof(double),
+        "flat::ClampedDecimal must hold nothing beyond its value and bounds");
+    static_assert(std::is_trivially_copyable<ClampedInteger<int>>::value,
+        "flat::ClampedInteger must be trivially copyable");
+    static_assert(std::is_trivially_copyable<ClampedNaturalNumber<unsigned int>>::value,
+        "flat::ClampedNaturalNumber must be trivially copyable");
+    static_assert(std::is_trivially_copyable<ClampedDecimal<double>>::value,
+        "flat::ClampedDecimal must be trivially copyable");
+  }
+}
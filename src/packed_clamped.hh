@@ -0,0 +1,777 @@
+/** \file
+ * Clamped integers stored as offsets from their minimum, in as few bits as
+ * their bounds allow.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <limits>
+#include <type_traits>
+
+#include "clamp_kernels.hh"
+#include "clamped_array.hh"
+#include "clamped_batch.hh"
+
+namespace clamped
+{
+  namespace detail
+  {
+    // The number of bits needed to hold every value up to range
+    template<typename UIntT> constexpr
+    unsigned bitWidth(UIntT range)
+    {
+      unsigned bits = 0;
+      for(; range; range >>= 1)
+        ++bits;
+      
+      return bits;
+    }
+    
+    // The narrowest unsigned type of at least the given number of bits
+    template<unsigned Bits>
+    struct PackedStorage
+    {
+      using type = typename std::conditional<(Bits <= 8), uint8_t,
+          typename std::conditional<(Bits <= 16), uint16_t,
+          typename std::conditional<(Bits <= 32), uint32_t, uint64_t>::type>::type>::type;
+    };
+    
+    // The offset of value above min, which must not exceed it
+    template<typename NumT> constexpr
+    typename std::make_unsigned<NumT>::type offsetOf(const NumT &value, const NumT &min)
+    {
+      using UIntT = typename std::make_unsigned<NumT>::type;
+      return UIntT(UIntT(value) - UIntT(min));
+    }
+    
+    // The value lying the given offset above min
+    template<typename NumT> constexpr
+    NumT valueAt(typename std::make_unsigned<NumT>::type offset, const NumT &min)
+    {
+      using UIntT = typename std::make_unsigned<NumT>::type;
+      return NumT(UIntT(UIntT(min) + offset));
+    }
+  }
+  
+  /**
+   * An integral number whose bounds are template parameters, as for
+   * `StaticClamped`, but which stores only its offset above `Min`, in the
+   * narrowest unsigned type holding `Max - Min`. A `ClampedInteger<int64_t>`
+   * within [1000, 1255] thus takes one byte rather than three 64-bit fields
+   * and a table pointer.
+   * 
+   * Arithmetic follows the same saturation rules as `StaticClamped`, sharing
+   * its kernels: each operation decodes the value, applies the kernel within
+   * [Min, Max], and encodes the result. As for `StaticClamped`, a starting
+   * or assigned value outside the bounds is clamped into them, and every
+   * member is `constexpr`.
+   * 
+   * \param NumT the integral type being bounded
+   * \param Min the minimum value for numbers of this type
+   * \param Max the maximum value for numbers of this type
+   * 
+   * \see StaticClamped PackedClampedArray
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  class ClampedSmall
+  {
+    static_assert(std::is_integral<NumT>::value, "ClampedSmall requires an integral NumT");
+    static_assert(Min <= Max, "ClampedSmall requires Min <= Max");
+    
+    using Kernels = detail::ClampKernels<NumT>;
+    
+    public:
+    
+    /** The number of bits needed to hold the offset of any value above `Min`. */
+    static constexpr unsigned bits = detail::bitWidth(detail::offsetOf(Max, Min));
+    
+    /** The unsigned type in which the offset is stored. */
+    using Storage = typename detail::PackedStorage<bits>::type;
+    
+    private:
+    
+    Storage _offset;
+    
+    public:
+    
+    /**
+     * Constructs a new `ClampedSmall` holding zero, or whichever of the
+     * bounds lies nearest to zero if zero is not within them.
+     */
+    constexpr ClampedSmall():
+        _offset(encode(0))
+    {}
+    
+    /**
+     * Constructs a new `ClampedSmall` with the given starting value, clamped
+     * into [Min, Max].
+     * 
+     * \param value the starting value of this number
+     */
+    constexpr ClampedSmall(const NumT &value):
+        _offset(encode(value))
+    {}
+    
+    public:
+    
+    /**
+     * Returns this number's current value, decoded from its offset.
+     * 
+     * \return Returns this number's current value.
+     */
+    constexpr NumT value() const
+    {
+      return detail::valueAt(typename std::make_unsigned<NumT>::type(this->_offset), Min);
+    }
+    
+    /**
+     * Returns the offset of this number's value above `Min`, as stored.
+     * 
+     * \return Returns this number's stored offset.
+     */
+    constexpr Storage offset() const
+    {
+      return this->_offset;
+    }
+    
+    /**
+     * Returns the maximum value of this type.
+     * 
+     * \return Returns `Max`.
+     */
+    static constexpr NumT maxValue()
+    {
+      return Max;
+    }
+    
+    /**
+     * Returns the minimum value of this type.
+     * 
+     * \return Returns `Min`.
+     */
+    static constexpr NumT minValue()
+    {
+      return Min;
+    }
+    
+    /**
+     * Sets this number's current value, as constrained by its bounds.
+     * 
+     * \param newVal the new value for this number
+     * \return Returns this number's current value after reassignment.
+     */
+    constexpr NumT value(const NumT &newVal)
+    {
+      NumT current = this->value();
+      detail::observe<NumT>(detail::Operation::ASSIGN, detail::assignClamped(current, newVal, Min, Max));
+      return this->store(current);
+    }
+    
+    /**
+     * Sets this number's current value to `Min`.
+     * 
+     * \return Returns this number's current value after modification.
+     */
+    constexpr NumT minimize()
+    {
+      return this->store(Min);
+    }
+    
+    /**
+     * Sets this number's current value to `Max`.
+     * 
+     * \return Returns this number's current value after modification.
+     */
+    constexpr NumT maximize()
+    {
+      return this->store(Max);
+    }
+    
+    /**
+     * Adds the given number to this one, as constrained by this number's
+     * bounds.
+     * 
+     * \param other the right operand for addition
+     * \return Returns this number, allowing chaining of operations.
+     */
+    constexpr ClampedSmall & operator+=(const NumT &other)
+    {
+      NumT current = this->value();
+      detail::observe<NumT>(detail::Operation::ADD, Kernels::add(current, other, Min, Max));
+      this->store(current);
+      return *this;
+    }
+    
+    /**
+     * Subtracts the given number from this one, as constrained by this
+     * number's bounds.
+     * 
+     * \param other the right operand for subtraction
+     * \return Returns this number, allowing chaining of operations.
+     */
+    constexpr ClampedSmall & operator-=(const NumT &other)
+    {
+      NumT current = this->value();
+      detail::observe<NumT>(detail::Operation::SUBTRACT, Kernels::subtract(current, other, Min, Max));
+      this->store(current);
+      return *this;
+    }
+    
+    /**
+     * Multiplies this number by the one given, as constrained by this
+     * number's bounds.
+     * 
+     * \param other the right operand for multiplication
+     * \return Returns this number, allowing chaining of operations.
+     */
+    constexpr ClampedSmall & operator*=(const NumT &other)
+    {
+      NumT current = this->value();
+      detail::observe<NumT>(detail::Operation::MULTIPLY, Kernels::multiply(current, other, Min, Max));
+      this->store(current);
+      return *this;
+    }
+    
+    /**
+     * Divides this number by the one given, as constrained by this number's
+     * bounds. Division by zero yields `Max` or `Min`, depending on the sign of
+     * this number prior to division.
+     * 
+     * \param other the right operand for division
+     * \return Returns this number, allowing chaining of operations.
+     */
+    constexpr ClampedSmall & operator/=(const NumT &other)
+    {
+      NumT current = this->value();
+      detail::observe<NumT>(detail::Operation::DIVIDE, Kernels::divide(current, other, Min, Max));
+      this->store(current);
+      return *this;
+    }
+    
+    /**
+     * Sets this number's value to the remainder of division by the given
+     * number, within this number's bounds.
+     * 
+     * \param other the value by which to divide this one
+     * \return Returns this number, allowing chaining of operations.
+     */
+    constexpr ClampedSmall & operator%=(const NumT &other)
+    {
+      NumT current = this->value();
+      detail::observe<NumT>(detail::Operation::MODULO, Kernels::modulo(current, other, Min, Max));
+      this->store(current);
+      return *this;
+    }
+    
+    /**
+     * Increments this number by one, within its bounds.
+     * 
+     * \return Returns this number post-incrementation.
+     */
+    constexpr ClampedSmall & operator++()
+    {
+      return (*this += 1);
+    }
+    
+    /**
+     * Decrements this number by one, within its bounds.
+     * 
+     * \return Returns this number post-decrementation.
+     */
+    constexpr ClampedSmall & operator--()
+    {
+      return (*this -= 1);
+    }
+    
+    /**
+     * Increments this number by one, within its bounds.
+     * 
+     * \return Returns a copy of this number, reflecting its state prior
+     * to incrementation.
+     */
+    constexpr ClampedSmall operator++(int)
+    {
+      ClampedSmall preIncr(*this);
+      ++(*this);
+      return preIncr;
+    }
+    
+    /**
+     * Decrements this number by one, within its bounds.
+     * 
+     * \return Returns a copy of this number, reflecting its state prior
+     * to decrementation.
+     */
+    constexpr ClampedSmall operator--(int)
+    {
+      ClampedSmall preDecr(*this);
+      --(*this);
+      return preDecr;
+    }
+    
+    /**
+     * Allows the explicit conversion of this number to an instance of `NumT`.
+     * 
+     * \return Returns a copy of this number's decoded value.
+     */
+    constexpr explicit operator NumT() const
+    {
+      return this->value();
+    }
+    
+    private:
+    
+    static constexpr Storage encode(const NumT &value)
+    {
+      return Storage(detail::offsetOf((value < Min) ? Min : (value > Max) ? Max : value, Min));
+    }
+    
+    // Stores a value known to lie within the bounds
+    constexpr NumT store(const NumT &value)
+    {
+      this->_offset = Storage(detail::offsetOf(value, Min));
+      return value;
+    }
+  };
+  
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr unsigned ClampedSmall<NumT, Min, Max>::bits;
+  
+  /**
+   * Returns whether two numbers of the same `ClampedSmall` type hold equal
+   * values.
+   * 
+   * \related ClampedSmall
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr bool operator==(const ClampedSmall<NumT, Min, Max> &lhs, const ClampedSmall<NumT, Min, Max> &rhs)
+  {
+    return lhs.offset() == rhs.offset();
+  }
+  
+  /**
+   * Returns whether two numbers of the same `ClampedSmall` type hold
+   * different values.
+   * 
+   * \related ClampedSmall
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr bool operator!=(const ClampedSmall<NumT, Min, Max> &lhs, const ClampedSmall<NumT, Min, Max> &rhs)
+  {
+    return lhs.offset() != rhs.offset();
+  }
+  
+  /**
+   * Returns whether the left number's value is less than the right's. As
+   * offsets rise with the values they encode, this compares them directly.
+   * 
+   * \related ClampedSmall
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr bool operator<(const ClampedSmall<NumT, Min, Max> &lhs, const ClampedSmall<NumT, Min, Max> &rhs)
+  {
+    return lhs.offset() < rhs.offset();
+  }
+  
+  /**
+   * Returns whether the left number's value is less than or equal to the
+   * right's.
+   * 
+   * \related ClampedSmall
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr bool operator<=(const ClampedSmall<NumT, Min, Max> &lhs, const ClampedSmall<NumT, Min, Max> &rhs)
+  {
+    return lhs.offset() <= rhs.offset();
+  }
+  
+  /**
+   * Returns whether the left number's value is greater than the right's.
+   * 
+   * \related ClampedSmall
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr bool operator>(const ClampedSmall<NumT, Min, Max> &lhs, const ClampedSmall<NumT, Min, Max> &rhs)
+  {
+    return lhs.offset() > rhs.offset();
+  }
+  
+  /**
+   * Returns whether the left number's value is greater than or equal to the
+   * right's.
+   * 
+   * \related ClampedSmall
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr bool operator>=(const ClampedSmall<NumT, Min, Max> &lhs, const ClampedSmall<NumT, Min, Max> &rhs)
+  {
+    return lhs.offset() >= rhs.offset();
+  }
+  
+  /**
+   * Returns the sum of the given number and a `NumT`, within [Min, Max].
+   * 
+   * \related ClampedSmall
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr ClampedSmall<NumT, Min, Max> operator+(ClampedSmall<NumT, Min, Max> lhs, const NumT &rhs)
+  {
+    return (lhs += rhs);
+  }
+  
+  /**
+   * Returns the difference of the given number and a `NumT`, within
+   * [Min, Max].
+   * 
+   * \related ClampedSmall
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr ClampedSmall<NumT, Min, Max> operator-(ClampedSmall<NumT, Min, Max> lhs, const NumT &rhs)
+  {
+    return (lhs -= rhs);
+  }
+  
+  /**
+   * Returns the product of the given number and a `NumT`, within [Min, Max].
+   * 
+   * \related ClampedSmall
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr ClampedSmall<NumT, Min, Max> operator*(ClampedSmall<NumT, Min, Max> lhs, const NumT &rhs)
+  {
+    return (lhs *= rhs);
+  }
+  
+  /**
+   * Returns the quotient of the given number and a `NumT`, within [Min, Max].
+   * 
+   * \related ClampedSmall
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr ClampedSmall<NumT, Min, Max> operator/(ClampedSmall<NumT, Min, Max> lhs, const NumT &rhs)
+  {
+    return (lhs /= rhs);
+  }
+  
+  /**
+   * Returns the remainder of dividing the given number by a `NumT`, within
+   * [Min, Max].
+   * 
+   * \related ClampedSmall
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr ClampedSmall<NumT, Min, Max> operator%(ClampedSmall<NumT, Min, Max> lhs, const NumT &rhs)
+  {
+    return (lhs %= rhs);
+  }
+  
+  /**
+   * A fixed-size array of integers sharing one pair of bounds, fixed at
+   * construction, which stores each value as its offset above the minimum
+   * in only as many bits as `max - min` needs. Offsets are packed into
+   * 64-bit words, as many whole offsets to a word as fit, so that none
+   * straddles two words: ten 6-bit offsets to a word, say, or seven 9-bit
+   * ones. An array of values within [1000, 1255] thus takes one byte per
+   * element, where a `ClampedArray<int64_t>` takes eight.
+   * 
+   * Whole-array operators work through blocks of a few hundred elements:
+   * each block is unpacked into a buffer of `NumT`, run through the
+   * vectorized kernels of `clamped::batch`, and repacked. Unpacking and
+   * packing shift and mask each lane without branching, and the block
+   * buffer lives on the stack, so no operator allocates. Every element
+   * saturates exactly as a `StaticClamped` with the same bounds would.
+   * 
+   * \param NumT the integral type being bounded
+   * 
+   * \see ClampedSmall ClampedArray
+   */
+  template<typename NumT>
+  class PackedClampedArray
+  {
+    static_assert(std::is_integral<NumT>::value, "PackedClampedArray requires an integral NumT");
+    
+    using UIntT = typename std::make_unsigned<NumT>::type;
+    
+    // The number of elements unpacked at once by the whole-array operators
+    static constexpr std::size_t blockSize = 256;
+    
+    std::size_t _size;
+    NumT _minValue;
+    NumT _maxValue;
+    unsigned _bits;
+    unsigned _lanes;
+    uint64_t _mask;
+    detail::AlignedBuffer<uint64_t> _words;
+    
+    public:
+    
+    /**
+     * Constructs a new `PackedClampedArray` of `count` elements, each
+     * starting at the given value clamped into the given bounds. Bounds
+     * given in the wrong order are swapped.
+     * 
+     * \param count the number of elements
+     * \param value the starting value of every element
+     * \param min the minimum value of every element
+     * \param max the maximum value of every element
+     */
+    PackedClampedArray(std::size_t count, const NumT &value, const NumT &min, const NumT &max):
+        _size(count),
+        _minValue((min <= max) ? min : max),
+        _maxValue((min <= max) ? max : min),
+        _bits(packedBits(_minValue, _maxValue)),
+        _lanes(64 / _bits),
+        _mask((_bits < 64) ? (uint64_t(1) << _bits) - 1 : ~uint64_t(0)),
+        _words((count + _lanes - 1) / _lanes)
+    {
+      NumT start = value;
+      detail::assignClamped(start, value, this->_minValue, this->_maxValue);
+      
+      uint64_t word = 0;
+      for(unsigned lane = 0; lane < this->_lanes; ++lane)
+        word |= uint64_t(detail::offsetOf(start, this->_minValue)) << (lane * this->_bits);
+      for(std::size_t i = 0; i < this->_words.size(); ++i)
+        this->_words.data()[i] = word;
+    }
+    
+    public:
+    
+    /**
+     * Returns the number of elements in this array.
+     * 
+     * \return Returns the number of elements in this array.
+     */
+    std::size_t size() const
+    {
+      return this->_size;
+    }
+    
+    /**
+     * Returns the minimum value of every element.
+     * 
+     * \return Returns this array's minimum value.
+     */
+    const NumT & minValue() const
+    {
+      return this->_minValue;
+    }
+    
+    /**
+     * Returns the maximum value of every element.
+     * 
+     * \return Returns this array's maximum value.
+     */
+    const NumT & maxValue() const
+    {
+      return this->_maxValue;
+    }
+    
+    /**
+     * Returns the number of bits in which each element's offset is stored.
+     * 
+     * \return Returns the width of each packed element.
+     */
+    unsigned bitsPerValue() const
+    {
+      return this->_bits;
+    }
+    
+    /**
+     * Returns the packed words holding every element, which are aligned to
+     * a cache line.
+     * 
+     * \return Returns a pointer to the first of `wordCount()` words.
+     */
+    const uint64_t * words() const
+    {
+      return this->_words.data();
+    }
+    
+    /**
+     * Returns the number of 64-bit words holding this array's elements.
+     * 
+     * \return Returns the length of `words()`.
+     */
+    std::size_t wordCount() const
+    {
+      return this->_words.size();
+    }
+    
+    /**
+     * Returns the value of the element at the given index, which must be
+     * less than `size()`.
+     * 
+     * \param index the index of the element
+     * \return Returns the element's current value.
+     */
+    NumT value(std::size_t index) const
+    {
+      const uint64_t word = this->_words.data()[index / this->_lanes];
+      return detail::valueAt(UIntT((word >> (index % this->_lanes * this->_bits)) & this->_mask), this->_minValue);
+    }
+    
+    /**
+     * Sets the value of the element at the given index, as constrained by
+     * the bounds of this array.
+     * 
+     * \param index the index of the element
+     * \param newVal the new value for the element
+     * \return Returns the element's value after reassignment.
+     */
+    NumT value(std::size_t index, const NumT &newVal)
+    {
+      NumT clampedVal = newVal;
+      detail::observe<NumT>(detail::Operation::ASSIGN,
+          detail::assignClamped(clampedVal, newVal, this->_minValue, this->_maxValue));
+      
+      const unsigned shift = unsigned(index % this->_lanes) * this->_bits;
+      uint64_t &word = this->_words.data()[index / this->_lanes];
+      word = (word & ~(this->_mask << shift)) | (uint64_t(detail::offsetOf(clampedVal, this->_minValue)) << shift);
+      return clampedVal;
+    }
+    
+    /**
+     * Copies every element's value into the given array of `size()` values.
+     * 
+     * \param out the array to receive the unpacked values
+     */
+    void unpack(NumT *out) const
+    {
+      this->unpackRange(0, this->_size, out);
+    }
+    
+    /**
+     * Sets the value of every element from the given array of `size()`
+     * values, each clamped into this array's bounds.
+     * 
+     * \param newValues the new values
+     */
+    void assign(const NumT *newValues)
+    {
+      NumT block[blockSize];
+      for(std::size_t first = 0; first < this->_size; first += this->blockLength()) {
+        const std::size_t count = this->blockCount(first);
+        batch::set(block, newValues + first, count, this->_minValue, this->_maxValue);
+        this->packRange(first, count, block);
+      }
+    }
+    
+    /**
+     * Adds the given number to every element, as constrained by this
+     * array's bounds.
+     * 
+     * \param other the right operand for addition
+     * \return Returns this array, allowing chaining of operations.
+     */
+    PackedClampedArray & operator+=(const NumT &other)
+    {
+      return this->apply(other, detail::activeBatchTable<NumT>().add);
+    }
+    
+    /**
+     * Subtracts the given number from every element, as constrained by this
+     * array's bounds.
+     * 
+     * \param other the right operand for subtraction
+     * \return Returns this array, allowing chaining of operations.
+     */
+    PackedClampedArray & operator-=(const NumT &other)
+    {
+      return this->apply(other, detail::activeBatchTable<NumT>().subtract);
+    }
+    
+    /**
+     * Multiplies every element by the number given, as constrained by this
+     * array's bounds.
+     * 
+     * \param other the right operand for multiplication
+     * \return Returns this array, allowing chaining of operations.
+     */
+    PackedClampedArray & operator*=(const NumT &other)
+    {
+      return this->apply(other, detail::activeBatchTable<NumT>().multiply);
+    }
+    
+    /**
+     * Divides every element by the number given, as constrained by this
+     * array's bounds. Division by zero yields the maximum or minimum,
+     * depending on the sign of each element prior to division.
+     * 
+     * \param other the right operand for division
+     * \return Returns this array, allowing chaining of operations.
+     */
+    PackedClampedArray & operator/=(const NumT &other)
+    {
+      return this->apply(other, detail::activeBatchTable<NumT>().divide);
+    }
+    
+    private:
+    
+    // The width of each packed offset, at least one bit even where the
+    // bounds admit a single value
+    static unsigned packedBits(const NumT &min, const NumT &max)
+    {
+      const unsigned bits = detail::bitWidth(detail::offsetOf(max, min));
+      return bits ? bits : 1;
+    }
+    
+    // The number of elements in each block: a whole number of words
+    std::size_t blockLength() const
+    {
+      return blockSize / this->_lanes * this->_lanes;
+    }
+    
+    // The number of elements in the block starting at first
+    std::size_t blockCount(std::size_t first) const
+    {
+      return (this->_size - first < this->blockLength()) ? this->_size - first : this->blockLength();
+    }
+    
+    // Unpacks count elements from first, which begins a word, into out
+    void unpackRange(std::size_t first, std::size_t count, NumT *out) const
+    {
+      const uint64_t *words = this->_words.data() + first / this->_lanes;
+      const std::size_t whole = count / this->_lanes;
+      for(std::size_t w = 0; w < whole; ++w)
+        for(unsigned lane = 0; lane < this->_lanes; ++lane)
+          out[w * this->_lanes + lane] = detail::valueAt(UIntT((words[w] >> (lane * this->_bits)) & this->_mask),
+              this->_minValue);
+      for(std::size_t i = whole * this->_lanes; i < count; ++i)
+        out[i] = detail::valueAt(UIntT((words[whole] >> ((i - whole * this->_lanes) * this->_bits)) & this->_mask),
+            this->_minValue);
+    }
+    
+    // Packs count elements within the bounds into place from first, which
+    // begins a word; lanes past the last element of the array are left zero
+    void packRange(std::size_t first, std::size_t count, const NumT *in)
+    {
+      uint64_t *words = this->_words.data() + first / this->_lanes;
+      const std::size_t used = (count + this->_lanes - 1) / this->_lanes;
+      for(std::size_t w = 0; w < used; ++w) {
+        uint64_t word = 0;
+        const std::size_t end = (count - w * this->_lanes < this->_lanes) ? count - w * this->_lanes : this->_lanes;
+        for(unsigned lane = 0; lane < end; ++lane)
+          word |= uint64_t(detail::offsetOf(in[w * this->_lanes + lane], this->_minValue)) << (lane * this->_bits);
+        
+        words[w] = word;
+      }
+    }
+    
+    // Applies one batch operation to every element, a block at a time
+    PackedClampedArray & apply(const NumT &other, void (*operation)(NumT *, std::size_t, NumT, NumT, NumT))
+    {
+      NumT block[blockSize];
+      for(std::size_t first = 0; first < this->_size; first += this->blockLength()) {
+        const std::size_t count = this->blockCount(first);
+        this->unpackRange(first, count, block);
+        operation(block, count, other, this->_minValue, this->_maxValue);
+        this->packRange(first, count, block);
+      }
+      
+      return *this;
+    }
+  };
+}
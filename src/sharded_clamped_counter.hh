@@ -0,0 +1,299 @@
+/** \file
+ * Clamped counters which spread concurrent updates across per-thread shards.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+#include "clamp_kernels.hh"
+#include "clamped_numbers.hh"
+
+namespace clamped
+{
+  /**
+   * A signed integer counter with defined lower and upper bounds, built for
+   * many threads updating it at once. Rather than have every thread contend
+   * for one atomic value, each thread adds its updates to a delta in its own
+   * shard, padded so that no two shards share a cache line. The deltas are
+   * periodically reconciled into a global `ClampedInteger`, which alone is
+   * constrained to the counter's bounds.
+   * 
+   * Reconciliation applies the sum of every delta accumulated since the last
+   * flush in one saturating step. This is exact whenever the counter stays
+   * within its bounds, but differs from applying each update in turn once it
+   * saturates: a counter at its maximum which receives +5 and then -5 ends at
+   * the maximum if both are reconciled together, where a `ClampedInteger`
+   * would end 5 below it. Updates made since the last flush are said to be
+   * pending, and only reach the global value when next reconciled.
+   * 
+   * Of the reads, `value()` is exact: it flushes every shard before reading,
+   * so it reflects every update which completed beforehand. `estimate()` never
+   * waits on a lock, adding the pending deltas to the last reconciled value
+   * without consuming them, and so may miss updates which happen during it.
+   * Flushes occur on each exact read, on any call to `flush()`, and whenever
+   * one shard's pending delta grows past the counter's flush threshold.
+   * 
+   * \param IntT the signed integral type being counted, at most 64 bits wide
+   * 
+   * \see AtomicClampedInteger ClampedInteger
+   */
+  template<typename IntT>
+  class ShardedClampedCounter
+  {
+    static_assert(std::is_integral<IntT>::value && std::is_signed<IntT>::value,
+        "ShardedClampedCounter requires a signed integral IntT");
+    static_assert(sizeof(IntT) <= sizeof(int64_t), "ShardedClampedCounter requires at most a 64-bit IntT");
+    
+    using DeltaKernels = detail::BuiltinKernels<int64_t>;
+    
+    // One thread's pending delta, padded to two cache lines so that neither
+    // it nor the adjacent line prefetched alongside it holds another shard's
+    struct Shard
+    {
+      std::atomic<int64_t> delta;
+      char padding[128 - sizeof(std::atomic<int64_t>)];
+      
+      Shard():
+          delta(0)
+      {}
+    };
+    
+    std::unique_ptr<Shard[]> _shards;
+    const std::size_t _shardCount;
+    const int64_t _flushThreshold;
+    
+    ClampedInteger<IntT> _global;
+    std::atomic<IntT> _reconciled;
+    std::mutex _flushMutex;
+    
+    public:
+    
+    /**
+     * Constructs a new `ShardedClampedCounter` with the specified current,
+     * minimum, and maximum values, stretching the bounds to fit the starting
+     * value where necessary.
+     * 
+     * \param value the starting value of this counter
+     * \param min the minimum value for this counter
+     * \param max the maximum value for this counter
+     * \param shardCount the number of shards, by default one per hardware
+     * thread
+     * \param flushThreshold the magnitude of the pending delta in one shard
+     * past which the updating thread flushes every shard, or zero to flush
+     * only on demand
+     */
+    ShardedClampedCounter(const IntT &value, const IntT &min, const IntT &max,
+        std::size_t shardCount = defaultShardCount(), int64_t flushThreshold = 0):
+        _shards(new Shard[shardCount ? shardCount : 1]),
+        _shardCount(shardCount ? shardCount : 1),
+        _flushThreshold(flushThreshold),
+        _global(value, min, max),
+        _reconciled(_global.value())
+    {}
+    
+    /**
+     * Counters are neither copyable nor movable, as their shards may be
+     * changing underneath any copy.
+     */
+    ShardedClampedCounter(const ShardedClampedCounter &) = delete;
+    
+    /**
+     * Counters are neither copyable nor movable, as their shards may be
+     * changing underneath any copy.
+     */
+    ShardedClampedCounter & operator=(const ShardedClampedCounter &) = delete;
+    
+    /**
+     * Returns the number of shards used when none is given: one per hardware
+     * thread, as reported by the standard library.
+     * 
+     * \return Returns the default number of shards.
+     */
+    static std::size_t defaultShardCount()
+    {
+      const unsigned int threads = std::thread::hardware_concurrency();
+      return threads ? threads : 1;
+    }
+    
+    /**
+     * Returns the number of shards held by this counter.
+     * 
+     * \return Returns the number of shards.
+     */
+    std::size_t shardCount() const
+    {
+      return this->_shardCount;
+    }
+    
+    /**
+     * Returns this counter's minimum value.
+     * 
+     * \return Returns this counter's minimum value.
+     */
+    const IntT & minValue() const
+    {
+      return this->_global.minValue();
+    }
+    
+    /**
+     * Returns this counter's maximum value.
+     * 
+     * \return Returns this counter's maximum value.
+     */
+    const IntT & maxValue() const
+    {
+      return this->_global.maxValue();
+    }
+    
+    /**
+     * Adds the given number to the calling thread's shard of this counter.
+     * The addition reaches the counter's value, and is clamped into its
+     * bounds, when the shard is next flushed.
+     * 
+     * \param other the number to add
+     */
+    void add(const IntT &other)
+    {
+      this->accumulate(int64_t(other), &DeltaKernels::add);
+    }
+    
+    /**
+     * Subtracts the given number from the calling thread's shard of this
+     * counter. The subtraction reaches the counter's value, and is clamped
+     * into its bounds, when the shard is next flushed.
+     * 
+     * \param other the number to subtract
+     */
+    void subtract(const IntT &other)
+    {
+      this->accumulate(int64_t(other), &DeltaKernels::subtract);
+    }
+    
+    /**
+     * Adds the given number to the calling thread's shard of this counter.
+     * 
+     * \param other the number to add
+     * \return Returns this counter, allowing chaining of operations.
+     */
+    ShardedClampedCounter<IntT> & operator+=(const IntT &other)
+    {
+      this->add(other);
+      return *this;
+    }
+    
+    /**
+     * Subtracts the given number from the calling thread's shard of this
+     * counter.
+     * 
+     * \param other the number to subtract
+     * \return Returns this counter, allowing chaining of operations.
+     */
+    ShardedClampedCounter<IntT> & operator-=(const IntT &other)
+    {
+      this->subtract(other);
+      return *this;
+    }
+    
+    /**
+     * Reconciles the pending delta of every shard into this counter's value,
+     * clamping their sum into its bounds. Only one thread flushes at a time:
+     * others calling `flush()` meanwhile wait for it to finish.
+     * 
+     * \return Returns this counter's value after reconciliation.
+     */
+    IntT flush()
+    {
+      std::lock_guard<std::mutex> lock(this->_flushMutex);
+      return this->reconcile();
+    }
+    
+    /**
+     * Returns this counter's exact value, first flushing every shard so as to
+     * include every update completed beforehand.
+     * 
+     * \return Returns this counter's value after reconciliation.
+     */
+    IntT value()
+    {
+      return this->flush();
+    }
+    
+    /**
+     * Returns an estimate of this counter's value, adding the pending deltas
+     * to the last reconciled value, clamped into the bounds, without flushing
+     * them. This never waits on a lock, but may miss updates which happen
+     * concurrently, and treats every pending delta as one step as a flush
+     * would.
+     * 
+     * \return Returns the estimated value of this counter.
+     */
+    IntT estimate() const
+    {
+      int64_t pending = 0;
+      for(std::size_t i = 0; i < this->_shardCount; ++i)
+        DeltaKernels::add(pending, this->_shards[i].delta.load(std::memory_order_relaxed),
+            std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max());
+      
+      int64_t wide = this->_reconciled.load(std::memory_order_acquire);
+      DeltaKernels::add(wide, pending, int64_t(this->minValue()), int64_t(this->maxValue()));
+      return IntT(wide);
+    }
+    
+    private:
+    
+    // The shard for the calling thread: threads are assigned shards in turn
+    // as they first touch any counter, so that they spread evenly
+    Shard & localShard()
+    {
+      static std::atomic<std::size_t> nextSlot(0);
+      thread_local const std::size_t slot = nextSlot.fetch_add(1, std::memory_order_relaxed);
+      return this->_shards[slot % this->_shardCount];
+    }
+    
+    // Saturates a shard's delta within int64_t rather than wrapping it; the
+    // shard is rarely contended, so the exchange nearly always succeeds first
+    void accumulate(int64_t other, detail::ClampReaction (*kernel)(int64_t &, const int64_t &, const int64_t &,
+        const int64_t &))
+    {
+      Shard &shard = this->localShard();
+      int64_t previous = shard.delta.load(std::memory_order_relaxed), next;
+      do {
+        next = previous;
+        kernel(next, other, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max());
+      } while(!shard.delta.compare_exchange_weak(previous, next, std::memory_order_release,
+          std::memory_order_relaxed));
+      
+      // Flush periodically, unless another thread is already doing so
+      if(this->_flushThreshold > 0 && (next >= this->_flushThreshold || next <= -this->_flushThreshold)) {
+        std::unique_lock<std::mutex> lock(this->_flushMutex, std::try_to_lock);
+        if(lock.owns_lock())
+          this->reconcile();
+      }
+    }
+    
+    // Consumes every shard's pending delta into the global value; the caller
+    // must hold the flush mutex
+    IntT reconcile()
+    {
+      int64_t total = 0;
+      for(std::size_t i = 0; i < this->_shardCount; ++i)
+        DeltaKernels::add(total, this->_shards[i].delta.exchange(0, std::memory_order_acquire),
+            std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max());
+      
+      int64_t wide = this->_global.value();
+      DeltaKernels::add(wide, total, int64_t(this->minValue()), int64_t(this->maxValue()));
+      this->_global.value(IntT(wide));
+      this->_reconciled.store(IntT(wide), std::memory_order_release);
+      return IntT(wide);
+    }
+  };
+}
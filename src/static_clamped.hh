@@ -0,0 +1,416 @@
+/** \file
+ * Clamped integers whose bounds are fixed at compile time.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <type_traits>
+
+#include "clamp_kernels.hh"
+
+namespace clamped
+{
+  /**
+   * An integral number whose lower and upper bounds are template parameters
+   * rather than stored state. A `StaticClamped` holds nothing but its current
+   * value, so it is exactly the size of `NumT`, and every bound check is
+   * against a compile-time constant the optimizer can fold away.
+   * 
+   * Arithmetic follows the same saturation rules as `ClampedInteger` (for
+   * signed `NumT`) or `ClampedNaturalNumber` (for unsigned `NumT`), sharing
+   * their kernels. Because the bounds cannot move, the bound-stretching
+   * behavior of those types has no equivalent here: a starting or assigned
+   * value outside [Min, Max] is instead clamped into them.
+   * 
+   * Every member is `constexpr`, so a `StaticClamped` may be used in constant
+   * expressions and lookup tables.
+   * 
+   * \param NumT the integral type being bounded
+   * \param Min the minimum value for numbers of this type
+   * \param Max the maximum value for numbers of this type
+   * 
+   * \see ClampedInteger ClampedNaturalNumber
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  class StaticClamped
+  {
+    static_assert(std::is_integral<NumT>::value, "StaticClamped requires an integral NumT");
+    static_assert(Min <= Max, "StaticClamped requires Min <= Max");
+    
+    using Kernels = detail::ClampKernels<NumT>;
+    
+    NumT _value;
+    
+    public:
+    
+    /** The minimum value of every number of this type. */
+    static constexpr NumT minimum = Min;
+    
+    /** The maximum value of every number of this type. */
+    static constexpr NumT maximum = Max;
+    
+    /**
+     * Constructs a new `StaticClamped` holding zero, or whichever of the bounds
+     * lies nearest to zero if zero is not within them.
+     */
+    constexpr StaticClamped():
+        _value(clamp(0))
+    {}
+    
+    /**
+     * Constructs a new `StaticClamped` with the given starting value, clamped
+     * into [Min, Max].
+     * 
+     * \param value the starting value of this number
+     */
+    constexpr StaticClamped(const NumT &value):
+        _value(clamp(value))
+    {}
+    
+    public:
+    
+    /**
+     * Returns this number's current value by const reference.
+     * 
+     * \return Returns this number's current value.
+     */
+    constexpr const NumT & value() const
+    {
+      return this->_value;
+    }
+    
+    /**
+     * Returns the maximum value of this type.
+     * 
+     * \return Returns `Max`.
+     */
+    static constexpr NumT maxValue()
+    {
+      return Max;
+    }
+    
+    /**
+     * Returns the minimum value of this type.
+     * 
+     * \return Returns `Min`.
+     */
+    static constexpr NumT minValue()
+    {
+      return Min;
+    }
+    
+    /**
+     * Sets this number's current value, as constrained by its bounds.
+     * 
+     * \param newVal the new new value for this number
+     * \return Returns this number's current value after reassignment.
+     */
+    constexpr const NumT & value(const NumT &newVal)
+    {
+      detail::observe<NumT>(detail::Operation::ASSIGN, detail::assignClamped(this->_value, newVal, Min, Max));
+      return this->_value;
+    }
+    
+    /**
+     * Sets this number's current value to `Min`.
+     * 
+     * \return Returns this number's current value after modification.
+     */
+    constexpr const NumT & minimize()
+    {
+      return (this->_value = Min);
+    }
+    
+    /**
+     * Sets this number's current value to `Max`.
+     * 
+     * \return Returns this number's current value after modification.
+     */
+    constexpr const NumT & maximize()
+    {
+      return (this->_value = Max);
+    }
+    
+    /**
+     * Adds the given number to this one, as constrained by this
+     * number's bounds.
+     * 
+     * \param other the right operand for addition
+     * \return Returns this number, allowing chaining of operations.
+     */
+    constexpr StaticClamped & operator+=(const NumT &other)
+    {
+      detail::observe<NumT>(detail::Operation::ADD,
+          Kernels::add(this->_value, other, Min, Max));
+      return *this;
+    }
+    
+    /**
+     * Subtracts the given number from this one, as constrained by this
+     * number's bounds.
+     * 
+     * \param other the right operand for subtraction
+     * \return Returns this number, allowing chaining of operations.
+     */
+    constexpr StaticClamped & operator-=(const NumT &other)
+    {
+      detail::observe<NumT>(detail::Operation::SUBTRACT,
+          Kernels::subtract(this->_value, other, Min, Max));
+      return *this;
+    }
+    
+    /**
+     * Multiplies this number by the one given, as constrained by this
+     * number's bounds.
+     * 
+     * \param other the right operand for multiplication
+     * \return Returns this number, allowing chaining of operations.
+     */
+    constexpr StaticClamped & operator*=(const NumT &other)
+    {
+      detail::observe<NumT>(detail::Operation::MULTIPLY,
+          Kernels::multiply(this->_value, other, Min, Max));
+      return *this;
+    }
+    
+    /**
+     * Divides this number by the one given, as constrained by this number's
+     * bounds. Division by zero yields `Max` or `Min`, depending on the sign of
+     * this number prior to division.
+     * 
+     * \param other the right operand for division
+     * \return Returns this number, allowing chaining of operations.
+     */
+    constexpr StaticClamped & operator/=(const NumT &other)
+    {
+      detail::observe<NumT>(detail::Operation::DIVIDE,
+          Kernels::divide(this->_value, other, Min, Max));
+      return *this;
+    }
+    
+    /**
+     * Sets this number's value to the remainder of division by the given
+     * number, within this number's bounds.
+     * 
+     * \param other the value by which to divide this one
+     * \return Returns this number, allowing chain of operations.
+     */
+    constexpr StaticClamped & operator%=(const NumT &other)
+    {
+      detail::observe<NumT>(detail::Operation::MODULO,
+          Kernels::modulo(this->_value, other, Min, Max));
+      return *this;
+    }
+    
+    /**
+     * Increments this number by one, within its bounds.
+     * 
+     * \return Returns this number post-incrementation.
+     */
+    constexpr StaticClamped & operator++()
+    {
+      return (*this += 1);
+    }
+    
+    /**
+     * Decrements this number by one, within its bounds.
+     * 
+     * \return Returns this number post-decrementation.
+     */
+    constexpr StaticClamped & operator--()
+    {
+      return (*this -= 1);
+    }
+    
+    /**
+     * Increments this number by one, within its bounds.
+     * 
+     * \return Returns a copy of this number, reflecting its state prior
+     * to incrementation.
+     */
+    constexpr StaticClamped operator++(int)
+    {
+      StaticClamped preIncr(*this);
+      ++(*this);
+      return preIncr;
+    }
+    
+    /**
+     * Decrements this number by one, within its bounds.
+     * 
+     * \return Returns a copy of this number, reflecting its state prior
+     * to decrementation.
+     */
+    constexpr StaticClamped operator--(int)
+    {
+      StaticClamped preDecr(*this);
+      --(*this);
+      return preDecr;
+    }
+    
+    /**
+     * Allows the explicit conversion of this number to an instance of `NumT`.
+     * 
+     * \return Returns a copy of this number's internal value.
+     */
+    constexpr explicit operator NumT() const
+    {
+      return this->_value;
+    }
+    
+    private:
+    
+    static constexpr NumT clamp(const NumT &value)
+    {
+      return (value < Min) ? Min : (value > Max) ? Max : value;
+    }
+  };
+  
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr NumT StaticClamped<NumT, Min, Max>::minimum;
+  
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr NumT StaticClamped<NumT, Min, Max>::maximum;
+  
+  /**
+   * Returns whether two numbers of the same `StaticClamped` type hold equal
+   * values.
+   * 
+   * \related StaticClamped
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr bool operator==(const StaticClamped<NumT, Min, Max> &lhs, const StaticClamped<NumT, Min, Max> &rhs)
+  {
+    return lhs.value() == rhs.value();
+  }
+  
+  /**
+   * Returns whether two numbers of the same `StaticClamped` type hold
+   * different values.
+   * 
+   * \related StaticClamped
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr bool operator!=(const StaticClamped<NumT, Min, Max> &lhs, const StaticClamped<NumT, Min, Max> &rhs)
+  {
+    return lhs.value() != rhs.value();
+  }
+  
+  /**
+   * Returns whether the left number's value is less than the right's.
+   * 
+   * \related StaticClamped
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr bool operator<(const StaticClamped<NumT, Min, Max> &lhs, const StaticClamped<NumT, Min, Max> &rhs)
+  {
+    return lhs.value() < rhs.value();
+  }
+  
+  /**
+   * Returns whether the left number's value is less than or equal to the
+   * right's.
+   * 
+   * \related StaticClamped
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr bool operator<=(const StaticClamped<NumT, Min, Max> &lhs, const StaticClamped<NumT, Min, Max> &rhs)
+  {
+    return lhs.value() <= rhs.value();
+  }
+  
+  /**
+   * Returns whether the left number's value is greater than the right's.
+   * 
+   * \related StaticClamped
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr bool operator>(const StaticClamped<NumT, Min, Max> &lhs, const StaticClamped<NumT, Min, Max> &rhs)
+  {
+    return lhs.value() > rhs.value();
+  }
+  
+  /**
+   * Returns whether the left number's value is greater than or equal to the
+   * right's.
+   * 
+   * \related StaticClamped
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr bool operator>=(const StaticClamped<NumT, Min, Max> &lhs, const StaticClamped<NumT, Min, Max> &rhs)
+  {
+    return lhs.value() >= rhs.value();
+  }
+  
+  /**
+   * Returns the sum of the given number and a `NumT`, within [Min, Max]. As
+   * with each operator taking a `NumT`, the operand may be any value which
+   * converts to one, such as the `int` in `port + 1` for a `ClampedPort`.
+   * 
+   * \related StaticClamped
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr StaticClamped<NumT, Min, Max> operator+(StaticClamped<NumT, Min, Max> lhs,
+      const typename detail::NonDeduced<NumT>::type &rhs)
+  {
+    return (lhs += rhs);
+  }
+  
+  /**
+   * Returns the difference of the given number and a `NumT`, within
+   * [Min, Max].
+   * 
+   * \related StaticClamped
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr StaticClamped<NumT, Min, Max> operator-(StaticClamped<NumT, Min, Max> lhs,
+      const typename detail::NonDeduced<NumT>::type &rhs)
+  {
+    return (lhs -= rhs);
+  }
+  
+  /**
+   * Returns the product of the given number and a `NumT`, within [Min, Max].
+   * 
+   * \related StaticClamped
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr StaticClamped<NumT, Min, Max> operator*(StaticClamped<NumT, Min, Max> lhs,
+      const typename detail::NonDeduced<NumT>::type &rhs)
+  {
+    return (lhs *= rhs);
+  }
+  
+  /**
+   * Returns the quotient of the given number and a `NumT`, within [Min, Max].
+   * 
+   * \related StaticClamped
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr StaticClamped<NumT, Min, Max> operator/(StaticClamped<NumT, Min, Max> lhs,
+      const typename detail::NonDeduced<NumT>::type &rhs)
+  {
+    return (lhs /= rhs);
+  }
+  
+  /**
+   * Returns the remainder of dividing the given number by a `NumT`, within
+   * [Min, Max].
+   * 
+   * \related StaticClamped
+   */
+  template<typename NumT, NumT Min, NumT Max>
+  constexpr StaticClamped<NumT, Min, Max> operator%(StaticClamped<NumT, Min, Max> lhs,
+      const typename detail::NonDeduced<NumT>::type &rhs)
+  {
+    return (lhs %= rhs);
+  }
+  
+  /** A percentage, held as an integer within [0, 100]. */
+  using ClampedPercent = StaticClamped<int32_t, 0, 100>;
+  
+  /** A network port number, within [0, 65535]. */
+  using ClampedPort = StaticClamped<uint16_t, 0, UINT16_MAX>;
+}
@@ -1,5 +1,21 @@
 #include "gtest/gtest.h"
 #include "clamped_numbers_test.cc"
+#include "clamp_kernels_test.cc"
+#include "flat_clamped_numbers_test.cc"
+#include "static_clamped_test.cc"
+#include "clamped_batch_test.cc"
+#include "clamped_array_test.cc"
+#include "atomic_clamped_test.cc"
+#include "sharded_clamped_counter_test.cc"
+#include "clamped_stats_test.cc"
+#include "clamped_serialization_test.cc"
+#include "clamped_stream_test.cc"
+#include "clamped_parallel_test.cc"
+#include "packed_clamped_test.cc"
+#include "clamped_pool_test.cc"
+#include "clamped_reduce_test.cc"
+#include "clamped_differential_test.cc"
+#include "fixed_clamped_test.cc"
 
 int main(int argc, char **argv)
 {
@@ -0,0 +1,99 @@
+#include <cstdint>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "atomic_clamped.hh"
+
+namespace
+{
+  using namespace clamped;
+  using detail::ClampReaction;
+  
+  TEST(AtomicClampedTests, ConstructorStretchedBounds)
+  {
+    AtomicClampedInteger<int32_t> num(0, 1, -1);
+    EXPECT_EQ(num.load(), 0) << "AtomicClampedInteger::load() does not report correct starting value.";
+    EXPECT_EQ(num.minValue(), 0) << "Number minimum should stretch to fit starting value.";
+    EXPECT_EQ(num.maxValue(), 0) << "Number maximum should stretch to fit starting value.";
+    
+    AtomicClampedNaturalNumber<uint16_t> natural;
+    EXPECT_EQ(natural.load(), 0) << "Default value should be zero.";
+    EXPECT_EQ(natural.maxValue(), UINT16_MAX) << "Default maximum is not the type maximum.";
+  }
+  
+  TEST(AtomicClampedTests, Reactions)
+  {
+    AtomicClampedInteger<int8_t> num(100);
+    EXPECT_EQ(num.add(20), ClampReaction::NONE) << "Addition within bounds should not clamp.";
+    EXPECT_EQ(num.add(20), ClampReaction::MAXIMUM) << "Addition past the type maximum should saturate.";
+    EXPECT_EQ(num.load(), 127) << "Addition past the type maximum should leave the maximum.";
+    EXPECT_EQ(num.add(1), ClampReaction::MAXIMUM) << "Addition at the maximum should still report saturation.";
+    EXPECT_EQ(num.subtract(-1), ClampReaction::MAXIMUM) << "Subtraction of a negative should saturate.";
+    
+    AtomicClampedInteger<int16_t> bounded(0, -50, 50);
+    EXPECT_EQ(bounded.store(-80), ClampReaction::MINIMUM) << "Storing below the minimum should clamp.";
+    EXPECT_EQ(bounded.load(), -50) << "Storing below the minimum should leave the minimum.";
+    
+    AtomicClampedNaturalNumber<uint32_t> natural(5, 0, 10);
+    EXPECT_EQ(natural.subtract(6), ClampReaction::MINIMUM) << "Subtraction past zero should saturate.";
+    EXPECT_EQ(natural.load(), 0u) << "Subtraction past zero should leave the minimum.";
+  }
+  
+  TEST(AtomicClampedTests, Operators)
+  {
+    AtomicClampedInteger<int64_t> num(5, -10, 10);
+    EXPECT_EQ(num += 4, 9) << "Compound addition should return the new value.";
+    EXPECT_EQ(num.fetchAdd(4), 9) << "fetchAdd should return the prior value.";
+    EXPECT_EQ(num.load(), 10) << "fetchAdd past the maximum should saturate.";
+    EXPECT_EQ(num--, 10) << "Postfix decrement should return the prior value.";
+    EXPECT_EQ(--num, 8) << "Prefix decrement should return the new value.";
+    EXPECT_EQ(num -= 30, -10) << "Compound subtraction past the minimum should saturate.";
+    EXPECT_EQ(num.fetchSubtract(1), -10) << "fetchSubtract should return the prior value.";
+    EXPECT_EQ(int64_t(++num), -9) << "Prefix increment should return the new value.";
+  }
+  
+  TEST(AtomicClampedTests, ConcurrentSaturation)
+  {
+    const int threads = 8, increments = 20000, limit = 100000;
+    AtomicClampedNaturalNumber<uint32_t> counter(0, 0, limit);
+    std::atomic<int> saturated(0);
+    std::atomic<bool> escaped(false);
+    
+    std::vector<std::thread> workers;
+    for(int t = 0; t < threads; ++t)
+      workers.emplace_back([&]() {
+        for(int i = 0; i < increments; ++i) {
+          if(counter.add(1) == ClampReaction::MAXIMUM)
+            ++saturated;
+          if(counter.load(std::memory_order_relaxed) > uint32_t(limit))
+            escaped = true;
+        }
+      });
+    for(std::thread &worker : workers)
+      worker.join();
+    
+    EXPECT_FALSE(escaped) << "No thread should ever observe a value beyond the bounds.";
+    EXPECT_EQ(counter.load(), uint32_t(limit)) << "Concurrent additions should saturate at the maximum.";
+    EXPECT_EQ(saturated.load(), threads * increments - limit) << "Every addition past the maximum should saturate.";
+  }
+  
+  TEST(AtomicClampedTests, ConcurrentBalance)
+  {
+    const int threads = 8, steps = 20000;
+    AtomicClampedInteger<int32_t> gauge(0, -1000000, 1000000);
+    
+    std::vector<std::thread> workers;
+    for(int t = 0; t < threads; ++t)
+      workers.emplace_back([&, t]() {
+        for(int i = 0; i < steps; ++i)
+          (t % 2 == 0) ? gauge += 3 : gauge -= 3;
+      });
+    for(std::thread &worker : workers)
+      worker.join();
+    
+    EXPECT_EQ(gauge.load(), 0) << "Balanced concurrent updates within bounds should cancel exactly.";
+  }
+}
@@ -0,0 +1,338 @@
+#include <cmath>
+#include <cstdint>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "clamp_kernels.hh"
+
+namespace
+{
+  using namespace clamped;
+  using detail::ClampReaction;
+  
+  enum class KernelOp { ADD, SUBTRACT, MULTIPLY, DIVIDE, MODULO };
+  
+  // The exact result of an operation, clamped; computed in a wider type
+  template<typename NumT>
+  ClampReaction oracle(KernelOp op, NumT &current, NumT other, NumT min, NumT max)
+  {
+    long long exact = current;
+    switch(op) {
+      case KernelOp::ADD:      exact = (long long) current + other; break;
+      case KernelOp::SUBTRACT: exact = (long long) current - other; break;
+      case KernelOp::MULTIPLY: exact = (long long) current * other; break;
+      case KernelOp::DIVIDE:
+        if(other == 0 && current != 0) {
+          const bool negative = current < 0;
+          current = negative ? min : max;
+          return negative ? ClampReaction::MINIMUM : ClampReaction::MAXIMUM;
+        }
+        exact = (other == 0) ? current : (long long) current / other;
+      break;
+      case KernelOp::MODULO:   exact = (other == 0) ? 0 : (long long) current % other; break;
+    }
+    
+    if(exact < min) {
+      current = min;
+      return ClampReaction::MINIMUM;
+    }
+    else if(exact > max) {
+      current = max;
+      return ClampReaction::MAXIMUM;
+    }
+    else {
+      current = NumT(exact);
+      return ClampReaction::NONE;
+    }
+  }
+  
+  template<typename KernelsT, typename NumT>
+  ClampReaction apply(KernelOp op, NumT &current, NumT other, NumT min, NumT max)
+  {
+    switch(op) {
+      case KernelOp::ADD:      return KernelsT::add(current, other, min, max);
+      case KernelOp::SUBTRACT: return KernelsT::subtract(current, other, min, max);
+      case KernelOp::MULTIPLY: return KernelsT::multiply(current, other, min, max);
+      case KernelOp::DIVIDE:   return KernelsT::divide(current, other, min, max);
+      default:                 return KernelsT::modulo(current, other, min, max);
+    }
+  }
+  
+  // The portable kernels, bypassing the builtin specializations
+  template<typename IntT>
+  struct PortableIntegerKernels
+  {
+    static ClampReaction add(IntT &c, IntT o, IntT lo, IntT hi) { return detail::addInteger(c, o, lo, hi); }
+    static ClampReaction subtract(IntT &c, IntT o, IntT lo, IntT hi) { return detail::subtractInteger(c, o, lo, hi); }
+    static ClampReaction multiply(IntT &c, IntT o, IntT lo, IntT hi) { return detail::multiplyInteger(c, o, lo, hi); }
+    static ClampReaction divide(IntT &c, IntT o, IntT lo, IntT hi) { return detail::divideInteger(c, o, lo, hi); }
+    static ClampReaction modulo(IntT &c, IntT o, IntT lo, IntT hi) { return detail::moduloInteger(c, o, lo, hi); }
+  };
+  
+  template<typename NatT>
+  struct PortableNaturalKernels
+  {
+    static ClampReaction add(NatT &c, NatT o, NatT lo, NatT hi) { return detail::addNatural(c, o, lo, hi); }
+    static ClampReaction subtract(NatT &c, NatT o, NatT lo, NatT hi) { return detail::subtractNatural(c, o, lo, hi); }
+    static ClampReaction multiply(NatT &c, NatT o, NatT lo, NatT hi) { return detail::multiplyNatural(c, o, lo, hi); }
+    static ClampReaction divide(NatT &c, NatT o, NatT lo, NatT hi) { return detail::divideNatural(c, o, lo, hi); }
+    static ClampReaction modulo(NatT &c, NatT o, NatT lo, NatT hi) { return detail::moduloNatural(c, o, lo, hi); }
+  };
+  
+  // The portable kernels bounding products by division, as for types with
+  // no wider counterpart
+  template<typename IntT>
+  struct DividingIntegerKernels: PortableIntegerKernels<IntT>
+  {
+    static ClampReaction multiply(IntT &c, IntT o, IntT lo, IntT hi)
+    { return detail::multiplyInteger<IntT, void>(c, o, lo, hi); }
+  };
+  
+  template<typename NatT>
+  struct DividingNaturalKernels: PortableNaturalKernels<NatT>
+  {
+    static ClampReaction multiply(NatT &c, NatT o, NatT lo, NatT hi)
+    { return detail::multiplyNatural<NatT, void>(c, o, lo, hi); }
+  };
+  
+  // Compares a kernel family against the oracle for every current value
+  // within each pair of bounds and every possible right operand
+  template<typename KernelsT, typename NumT>
+  void checkExhaustive(const std::vector<std::pair<NumT, NumT>> &boundsList)
+  {
+    const KernelOp ops[] = {KernelOp::ADD, KernelOp::SUBTRACT, KernelOp::MULTIPLY, KernelOp::DIVIDE, KernelOp::MODULO};
+    for(const auto &bounds : boundsList)
+      for(KernelOp op : ops)
+        for(int cur = bounds.first; cur <= bounds.second; ++cur)
+          for(int other = std::numeric_limits<NumT>::min(); other <= std::numeric_limits<NumT>::max(); ++other) {
+            NumT expected = NumT(cur), actual = NumT(cur);
+            const ClampReaction expectedReaction = oracle(op, expected, NumT(other), bounds.first, bounds.second);
+            const ClampReaction actualReaction = apply<KernelsT>(op, actual, NumT(other), bounds.first, bounds.second);
+            ASSERT_EQ(actual, expected) << "Wrong value for op " << int(op) << " on " << cur << " and " << other
+                << " in [" << int(bounds.first) << ", " << int(bounds.second) << "].";
+            ASSERT_EQ(actualReaction, expectedReaction) << "Wrong reaction for op " << int(op) << " on " << cur
+                << " and " << other << " in [" << int(bounds.first) << ", " << int(bounds.second) << "].";
+          }
+  }
+  
+  const std::vector<std::pair<int8_t, int8_t>> signedBounds = {
+    {-128, 127}, {-10, 10}, {0, 100}, {5, 20}, {-100, -3}, {-128, -128}, {127, 127}, {-1, 0}
+  };
+  
+  const std::vector<std::pair<uint8_t, uint8_t>> unsignedBounds = {
+    {0, 255}, {0, 10}, {5, 20}, {200, 255}, {0, 0}, {255, 255}, {1, 1}
+  };
+  
+  TEST(ClampKernelTests, PortableIntegerExhaustive)
+  {
+    checkExhaustive<PortableIntegerKernels<int8_t>>(signedBounds);
+  }
+  
+  TEST(ClampKernelTests, PortableNaturalExhaustive)
+  {
+    checkExhaustive<PortableNaturalKernels<uint8_t>>(unsignedBounds);
+  }
+  
+  TEST(ClampKernelTests, DividingIntegerExhaustive)
+  {
+    checkExhaustive<DividingIntegerKernels<int8_t>>(signedBounds);
+  }
+  
+  TEST(ClampKernelTests, DividingNaturalExhaustive)
+  {
+    checkExhaustive<DividingNaturalKernels<uint8_t>>(unsignedBounds);
+  }
+  
+  TEST(ClampKernelTests, BuiltinIntegerExhaustive)
+  {
+    checkExhaustive<detail::BuiltinKernels<int8_t>>(signedBounds);
+  }
+  
+  TEST(ClampKernelTests, BuiltinNaturalExhaustive)
+  {
+    checkExhaustive<detail::BuiltinKernels<uint8_t>>(unsignedBounds);
+  }
+  
+  TEST(ClampKernelTests, BuiltinWideExtremes)
+  {
+    const int64_t lo = std::numeric_limits<int64_t>::min(), hi = std::numeric_limits<int64_t>::max();
+    int64_t num = hi - 1;
+    EXPECT_EQ(detail::BuiltinKernels<int64_t>::add(num, int64_t(5), lo, hi), ClampReaction::MAXIMUM);
+    EXPECT_EQ(num, hi) << "64-bit addition should saturate at the type maximum.";
+    
+    num = lo;
+    EXPECT_EQ(detail::BuiltinKernels<int64_t>::divide(num, int64_t(-1), lo, hi), ClampReaction::MAXIMUM);
+    EXPECT_EQ(num, hi) << "Negating the 64-bit minimum should saturate at the type maximum.";
+    
+    num = int64_t(1) << 40;
+    EXPECT_EQ(detail::BuiltinKernels<int64_t>::multiply(num, -(int64_t(1) << 40), lo, hi), ClampReaction::MINIMUM);
+    EXPECT_EQ(num, lo) << "64-bit multiplication should saturate at the type minimum.";
+  }
+  
+  TEST(ClampKernelTests, PromotedWideProducts)
+  {
+    const int64_t lo = std::numeric_limits<int64_t>::min(), hi = std::numeric_limits<int64_t>::max();
+    const int64_t factors[] = {0, 1, -1, 3, -7, int64_t(1) << 31, -(int64_t(1) << 32), lo, hi, lo + 1, hi / 2 + 1};
+    for(int64_t a : factors)
+      for(int64_t b : factors)
+        for(int64_t bound : {int64_t(1000), int64_t(1) << 40, hi}) {
+          if(a < -bound || a > bound)
+            continue;
+          
+          int64_t expected = a, actual = a;
+          const ClampReaction expectedReaction = detail::multiplyInteger<int64_t, void>(expected, b, -bound, bound);
+          ASSERT_EQ(detail::multiplyInteger(actual, b, -bound, bound), expectedReaction)
+              << "Promoted reaction differs for " << a << " * " << b << " in +-" << bound << ".";
+          ASSERT_EQ(actual, expected) << "Promoted product differs for " << a << " * " << b << " in +-" << bound << ".";
+          
+          const uint64_t natMax = uint64_t(bound) * 2 + 1;
+          uint64_t expectedNat = uint64_t(a), actualNat = uint64_t(a);
+          if(actualNat > natMax)
+            continue;
+          
+          const ClampReaction expectedNatReaction = detail::multiplyNatural<uint64_t, void>(expectedNat, uint64_t(b),
+              uint64_t(0), natMax);
+          ASSERT_EQ(detail::multiplyNatural(actualNat, uint64_t(b), uint64_t(0), natMax), expectedNatReaction)
+              << "Promoted natural reaction differs for " << a << " * " << b << ".";
+          ASSERT_EQ(actualNat, expectedNat) << "Promoted natural product differs for " << a << " * " << b << ".";
+        }
+  }
+  
+  // The correctly rounded result of an operation on floats, clamped; float
+  // arithmetic carried out in double and rounded back is correctly rounded
+  ClampReaction fastOracle(KernelOp op, float &current, float other, float min, float max)
+  {
+    double exact = current;
+    switch(op) {
+      case KernelOp::ADD:      exact = double(current) + other; break;
+      case KernelOp::SUBTRACT: exact = double(current) - other; break;
+      case KernelOp::MULTIPLY: exact = double(current) * other; break;
+      default:
+        exact = (other != 0) ? double(current) / other : (current > 0) ? HUGE_VAL : (current < 0) ? -HUGE_VAL
+            : current;
+      break;
+    }
+    
+    const float rounded = float(exact);
+    if(rounded < min) {
+      current = min;
+      return ClampReaction::MINIMUM;
+    }
+    else if(rounded > max) {
+      current = max;
+      return ClampReaction::MAXIMUM;
+    }
+    else {
+      current = rounded;
+      return ClampReaction::NONE;
+    }
+  }
+  
+  template<typename KernelsT, typename FloatT>
+  ClampReaction applyDecimal(KernelOp op, FloatT &current, FloatT other, FloatT min, FloatT max)
+  {
+    switch(op) {
+      case KernelOp::ADD:      return KernelsT::add(current, other, min, max);
+      case KernelOp::SUBTRACT: return KernelsT::subtract(current, other, min, max);
+      case KernelOp::MULTIPLY: return KernelsT::multiply(current, other, min, max);
+      default:                 return KernelsT::divide(current, other, min, max);
+    }
+  }
+  
+  TEST(ClampKernelTests, FastDecimalMatchesOracle)
+  {
+    using Fast = detail::FastDecimalKernels<float, NanPolicy::KEEP>;
+    const KernelOp ops[] = {KernelOp::ADD, KernelOp::SUBTRACT, KernelOp::MULTIPLY, KernelOp::DIVIDE};
+    const std::pair<float, float> boundsList[] = {{-100.0f, 100.0f}, {0.0f, 1.0f}, {-1e30f, 1e30f}, {2.5f, 2.5f}};
+    const float specials[] = {0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 1e-30f, 3e38f, -HUGE_VALF, HUGE_VALF};
+    
+    std::mt19937 rng(2020);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_real_distribution<float> operands(-1000.0f, 1000.0f);
+    for(const auto &bounds : boundsList)
+      for(KernelOp op : ops)
+        for(int trial = 0; trial < 2000; ++trial) {
+          const float cur = bounds.first + (bounds.second - bounds.first) * unit(rng);
+          const float other = (trial < 9) ? specials[trial] : operands(rng);
+          float expected = cur, actual = cur;
+          const ClampReaction expectedReaction = fastOracle(op, expected, other, bounds.first, bounds.second);
+          const ClampReaction actualReaction = applyDecimal<Fast>(op, actual, other, bounds.first, bounds.second);
+          ASSERT_EQ(actual, expected) << "Wrong value for op " << int(op) << " on " << cur << " and " << other << ".";
+          ASSERT_EQ(actualReaction, expectedReaction) << "Wrong reaction for op " << int(op) << " on " << cur
+              << " and " << other << ".";
+        }
+  }
+  
+  TEST(ClampKernelTests, FastDecimalNanPolicy)
+  {
+    const double inf = HUGE_VAL, nan = std::numeric_limits<double>::quiet_NaN();
+    double keep = inf, low = inf, high = -inf;
+    EXPECT_EQ((detail::FastDecimalKernels<double, NanPolicy::KEEP>::add(keep, -inf, -inf, inf)), ClampReaction::NONE);
+    EXPECT_EQ(keep, inf) << "KEEP should leave the value as it was.";
+    EXPECT_EQ((detail::FastDecimalKernels<double, NanPolicy::MINIMUM>::subtract(low, inf, -10.0, inf)),
+        ClampReaction::MINIMUM);
+    EXPECT_EQ(low, -10.0) << "MINIMUM should saturate a NaN result at the minimum.";
+    EXPECT_EQ((detail::FastDecimalKernels<double, NanPolicy::MAXIMUM>::multiply(high, nan, -inf, 10.0)),
+        ClampReaction::MAXIMUM);
+    EXPECT_EQ(high, 10.0) << "MAXIMUM should saturate a NaN result at the maximum.";
+    
+    using Fast = detail::FastDecimalKernels<double, NanPolicy::MINIMUM>;
+    double positive = 5.0, negative = -5.0, zero = 0.0;
+    EXPECT_EQ(Fast::divide(positive, -0.0, -100.0, 100.0), ClampReaction::MAXIMUM);
+    EXPECT_EQ(positive, 100.0) << "Division by negative zero should still saturate toward the dividend's sign.";
+    EXPECT_EQ(Fast::divide(negative, 0.0, -100.0, 100.0), ClampReaction::MINIMUM);
+    EXPECT_EQ(negative, -100.0);
+    EXPECT_EQ(Fast::divide(zero, 0.0, -100.0, 100.0), ClampReaction::NONE) << "Zero divided by zero is no NaN here.";
+    EXPECT_EQ(zero, 0.0);
+  }
+  
+# ifdef CLAMPED_HAS_OVERFLOW_BUILTINS
+  // Checks the portable overflow test for a product of a and b against the
+  // compiler's own, in both the flag and the wrapped product
+  template<typename IntT>
+  void checkPortableProduct(IntT a, IntT b)
+  {
+    IntT expected = 0, actual = 0;
+    const bool expectedOverflow = __builtin_mul_overflow(a, b, &expected);
+    ASSERT_EQ(detail::multiplyOverflowsPortably(a, b, actual), expectedOverflow)
+        << "Portable overflow check differs for " << (long long) a << " * " << (long long) b << ".";
+    ASSERT_EQ(actual, expected) << "Portable product differs for " << (long long) a << " * " << (long long) b << ".";
+    ASSERT_EQ((detail::multiplyOverflowsPortably<IntT, void>(a, b, actual)), expectedOverflow)
+        << "Dividing overflow check differs for " << (long long) a << " * " << (long long) b << ".";
+    ASSERT_EQ(actual, expected) << "Dividing product differs for " << (long long) a << " * " << (long long) b << ".";
+  }
+  
+  template<typename IntT>
+  void checkPortableProducts(int trials)
+  {
+    using Limits = std::numeric_limits<IntT>;
+    std::mt19937_64 rng(54321);
+    std::uniform_int_distribution<IntT> dist(Limits::min(), Limits::max());
+    const IntT specials[] = {0, 1, IntT(-1), Limits::min(), Limits::max(), IntT(Limits::max() / 2 + 1)};
+    for(IntT a : specials)
+      for(IntT b : specials)
+        checkPortableProduct(a, b);
+    for(int trial = 0; trial < trials; ++trial)
+      checkPortableProduct(dist(rng), IntT(dist(rng) >> (trial % (8 * sizeof(IntT)))));
+  }
+  
+  TEST(ClampKernelTests, PortableProductsMatchBuiltins)
+  {
+    for(int a = -128; a < 128; ++a)
+      for(int b = -128; b < 128; ++b) {
+        checkPortableProduct(int8_t(a), int8_t(b));
+        checkPortableProduct(uint8_t(a), uint8_t(b));
+      }
+    
+    checkPortableProducts<int16_t>(100000);
+    checkPortableProducts<uint16_t>(100000);
+    checkPortableProducts<int32_t>(100000);
+    checkPortableProducts<uint32_t>(100000);
+    checkPortableProducts<int64_t>(100000);
+    checkPortableProducts<uint64_t>(100000);
+  }
+# endif
+}
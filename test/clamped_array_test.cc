@@ -0,0 +1,177 @@
+#include <cstdint>
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "clamped_array.hh"
+#include "flat_clamped_numbers.hh"
+
+namespace
+{
+  using namespace clamped;
+  
+  TEST(ClampedArrayTests, Layout)
+  {
+    ClampedArray<int32_t> shared(100, 0, -10, 10);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(shared.values()) % 64, 0u) << "Values should be cache-line aligned.";
+    EXPECT_EQ(shared.minValues(), nullptr) << "Shared bounds should not be held per element.";
+    
+    ClampedArray<int32_t> perLane(100, 0, -10, 10, BoundsLayout::PER_LANE);
+    ASSERT_NE(perLane.minValues(), nullptr) << "Per-element bounds should be held in their own array.";
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(perLane.maxValues()) % 64, 0u) << "Bounds should be cache-line aligned.";
+    EXPECT_EQ(perLane.minValue(99), -10) << "Every element should start with the given minimum.";
+  }
+  
+  TEST(ClampedArrayTests, ConstructorStretchedBounds)
+  {
+    ClampedArray<int> arr(3, 0, 1, -1);
+    EXPECT_EQ(arr.minValue(0), 0) << "Array minimum should stretch to fit starting value.";
+    EXPECT_EQ(arr.maxValue(2), 0) << "Array maximum should stretch to fit starting value.";
+  }
+  
+  TEST(ClampedArrayTests, ElementProxies)
+  {
+    ClampedArray<int16_t> arr(10, 5, 0, 100, BoundsLayout::PER_LANE);
+    arr[3] += 200;
+    EXPECT_EQ(arr[3].value(), 100) << "Element addition past its maximum should saturate.";
+    EXPECT_EQ(arr.value(4), 5) << "Modifying one element should leave its neighbours alone.";
+    
+    arr[4].maxValue(2);
+    EXPECT_EQ(arr[4].maxValue(), 5) << "Element maximum should stretch to fit its value.";
+    arr[4].minValue(-50);
+    arr[4] -= 70;
+    EXPECT_EQ(arr[4].value(), -50) << "Element subtraction past its own minimum should saturate.";
+    EXPECT_EQ(arr[4]++, -50) << "Postfix increment should yield the prior value.";
+    EXPECT_TRUE(arr[4] < arr[5]);
+    EXPECT_EQ(int16_t(arr[5]), 5);
+    
+    ClampedArray<int16_t> shared(10, 5, 0, 100);
+    shared[1].value(40);
+    shared[0].maxValue(20);
+    EXPECT_EQ(shared.maxValue(7), 40) << "Shared maximum should stretch to fit every element.";
+  }
+  
+  TEST(ClampedArrayTests, BulkMatchesClampedNumbers)
+  {
+    std::mt19937 rng(99);
+    std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+    const std::size_t count = 1003;
+    
+    ClampedArray<int32_t> shared(count, 0, -500, 500), perLane(count, 0, -500, 500, BoundsLayout::PER_LANE);
+    std::vector<flat::ClampedInteger<int32_t>> sharedRef, perLaneRef;
+    for(std::size_t i = 0; i < count; ++i) {
+      const int32_t value = dist(rng) / 2, lo = -int32_t(i % 400), hi = int32_t(i % 300);
+      shared[i].value(value);
+      perLane[i].minValue(lo);
+      perLane[i].maxValue(hi);
+      perLane[i].value(value);
+      sharedRef.emplace_back(value, -500, 500);
+      perLaneRef.emplace_back(0, lo, hi);
+      perLaneRef.back().value(value);
+    }
+    
+    const int32_t operands[] = {7, -300, 3, -2, 0, 250, 5};
+    for(int32_t operand : operands) {
+      shared += operand;
+      perLane *= operand;
+      perLane -= operand;
+      for(std::size_t i = 0; i < count; ++i) {
+        sharedRef[i] += operand;
+        perLaneRef[i] *= operand;
+        perLaneRef[i] -= operand;
+        ASSERT_EQ(shared.value(i), sharedRef[i].value()) << "Shared bulk op differs at index " << i << ".";
+        ASSERT_EQ(perLane.value(i), perLaneRef[i].value()) << "Per-element bulk op differs at index " << i << ".";
+      }
+    }
+    
+    shared /= 0;
+    perLane %= 7;
+    for(std::size_t i = 0; i < count; ++i) {
+      sharedRef[i] /= 0;
+      perLaneRef[i] %= 7;
+      ASSERT_EQ(shared.value(i), sharedRef[i].value()) << "Shared bulk division differs at index " << i << ".";
+      ASSERT_EQ(perLane.value(i), perLaneRef[i].value()) << "Per-element bulk modulo differs at index " << i << ".";
+    }
+  }
+  
+  TEST(ClampedArrayTests, AssignAndDecimals)
+  {
+    ClampedArray<uint8_t> bytes(40, 10, 10, 200);
+    std::vector<uint8_t> newValues(40, 255);
+    newValues[0] = 3;
+    bytes.assign(newValues.data());
+    EXPECT_EQ(bytes.value(0), 10) << "Assigned value below the minimum should clamp.";
+    EXPECT_EQ(bytes.value(39), 200) << "Assigned value above the maximum should clamp.";
+    
+    ClampedArray<double> reals(5, 1.5, 0.0, 2.0);
+    reals *= 2.0;
+    EXPECT_EQ(reals[2].value(), 2.0) << "Decimal bulk multiplication should saturate.";
+  }
+  
+  TEST(ClampedArrayTests, ReboundMatchesClampedNumbers)
+  {
+    std::mt19937 rng(23);
+    std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+    const std::size_t count = 517;
+    std::vector<int32_t> raw(count);
+    for(int32_t &value : raw)
+      value = dist(rng);
+    
+    for(BoundsLayout layout : {BoundsLayout::SHARED, BoundsLayout::PER_LANE}) {
+      ClampedArray<int32_t> stretched(count, 0, -1000, 1000, layout), clamped(count, 0, -1000, 1000, layout);
+      stretched.assign(raw.data());
+      clamped.assign(raw.data());
+      stretched.rebound(-200, 300);
+      clamped.rebound<ReboundPolicy::CLAMP>(300, -200);
+      
+      int32_t lowest = -200, highest = 300;
+      for(std::size_t i = 0; i < count; ++i) {
+        flat::ClampedInteger<int32_t> ref(raw[i], -1000, 1000);
+        ref.minValue(-200);
+        ref.maxValue(300);
+        lowest = (raw[i] < lowest) ? raw[i] : lowest;
+        highest = (raw[i] > highest) ? raw[i] : highest;
+        ASSERT_EQ(stretched.value(i), raw[i]) << "Stretching should leave every value alone, at index " << i;
+        if(layout == BoundsLayout::PER_LANE) {
+          ASSERT_EQ(stretched.minValue(i), ref.minValue()) << "Per-lane minimum should stretch as one number's would, "
+              << "at index " << i;
+          ASSERT_EQ(stretched.maxValue(i), ref.maxValue()) << "Per-lane maximum should stretch as one number's would, "
+              << "at index " << i;
+        }
+        
+        ASSERT_EQ(clamped.minValue(i), -200) << "Bounds given out of order should be swapped, at index " << i;
+        ASSERT_EQ(clamped.maxValue(i), 300) << "Bounds given out of order should be swapped, at index " << i;
+        ASSERT_EQ(clamped.value(i), (raw[i] < -200) ? -200 : (raw[i] > 300) ? 300 : raw[i])
+            << "Values should be clamped into the new bounds, at index " << i;
+      }
+      
+      if(layout == BoundsLayout::SHARED) {
+        EXPECT_EQ(stretched.minValue(0), lowest) << "The shared minimum should stretch to admit every value.";
+        EXPECT_EQ(stretched.maxValue(0), highest) << "The shared maximum should stretch to admit every value.";
+      }
+    }
+  }
+  
+  TEST(ClampedArrayTests, ComparisonsAndSearch)
+  {
+    ClampedArray<int16_t> leaderboard(130, 0, 0, 1000, BoundsLayout::PER_LANE);
+    std::vector<int16_t> scores(130);
+    for(std::size_t i = 0; i < scores.size(); ++i)
+      scores[i] = int16_t(i * 7);
+    leaderboard.assign(scores.data());
+    
+    EXPECT_EQ(leaderboard.countInRange(100, 200), 14u) << "Scores 105 to 196 should be counted.";
+    EXPECT_EQ(leaderboard.lowerBound(700), 100u);
+    EXPECT_EQ(leaderboard.lowerBound(701), 101u);
+    EXPECT_EQ(leaderboard.lowerBound(2000), 130u);
+    
+    uint64_t mask[3];
+    leaderboard.compare(batch::Comparison::GREATER_EQUAL, 889, mask);
+    EXPECT_EQ(mask[0], 0u);
+    EXPECT_EQ(mask[1], ~uint64_t(0) << 63) << "Only element 127 of the second word should reach 889.";
+    EXPECT_EQ(mask[2], uint64_t(3));
+    leaderboard.maskInRange(0, 6, mask);
+    EXPECT_EQ(mask[0], uint64_t(1));
+  }
+}
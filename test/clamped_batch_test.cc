@@ -0,0 +1,266 @@
+#include <cstdint>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "clamped_batch.hh"
+
+namespace
+{
+  using namespace clamped;
+  
+  const batch::Isa allIsas[] = {
+    batch::Isa::SCALAR, batch::Isa::SSE41, batch::Isa::AVX2, batch::Isa::AVX512BW, batch::Isa::NEON
+  };
+  
+  enum class BatchOp { ADD, SUBTRACT, MULTIPLY, DIVIDE, SET };
+  
+  template<typename NumT>
+  void applyScalar(BatchOp op, NumT &value, NumT other, NumT min, NumT max)
+  {
+    switch(op) {
+      case BatchOp::ADD:      detail::ClampKernels<NumT>::add(value, other, min, max); break;
+      case BatchOp::SUBTRACT: detail::ClampKernels<NumT>::subtract(value, other, min, max); break;
+      case BatchOp::MULTIPLY: detail::ClampKernels<NumT>::multiply(value, other, min, max); break;
+      case BatchOp::DIVIDE:   detail::ClampKernels<NumT>::divide(value, other, min, max); break;
+      case BatchOp::SET:      detail::assignClamped(value, other, min, max); break;
+    }
+  }
+  
+  template<typename NumT>
+  void applyBatch(const detail::BatchTable<NumT> &table, BatchOp op, std::vector<NumT> &values, NumT other,
+      NumT min, NumT max)
+  {
+    const std::vector<NumT> newValues(values.size(), other);
+    switch(op) {
+      case BatchOp::ADD:      table.add(values.data(), values.size(), other, min, max); break;
+      case BatchOp::SUBTRACT: table.subtract(values.data(), values.size(), other, min, max); break;
+      case BatchOp::MULTIPLY: table.multiply(values.data(), values.size(), other, min, max); break;
+      case BatchOp::DIVIDE:   table.divide(values.data(), values.size(), other, min, max); break;
+      case BatchOp::SET:      table.set(values.data(), newValues.data(), values.size(), min, max); break;
+    }
+  }
+  
+  template<typename NumT>
+  void applyBatchLanes(const detail::BatchTable<NumT> &table, BatchOp op, std::vector<NumT> &values, NumT other,
+      const std::vector<NumT> &mins, const std::vector<NumT> &maxs)
+  {
+    const std::vector<NumT> newValues(values.size(), other);
+    NumT *data = values.data();
+    const std::size_t count = values.size();
+    switch(op) {
+      case BatchOp::ADD:      table.addLanes(data, count, other, mins.data(), maxs.data()); break;
+      case BatchOp::SUBTRACT: table.subtractLanes(data, count, other, mins.data(), maxs.data()); break;
+      case BatchOp::MULTIPLY: table.multiplyLanes(data, count, other, mins.data(), maxs.data()); break;
+      case BatchOp::DIVIDE:   table.divideLanes(data, count, other, mins.data(), maxs.data()); break;
+      case BatchOp::SET:      table.setLanes(data, newValues.data(), count, mins.data(), maxs.data()); break;
+    }
+  }
+  
+  // Compares every supported instruction set against the scalar kernels, over
+  // random buffers whose lengths leave tails of every size, with bounds both
+  // shared and held per element
+  template<typename NumT>
+  void checkAgainstKernels()
+  {
+    using Limits = std::numeric_limits<NumT>;
+    std::mt19937_64 rng(12345);
+    std::uniform_int_distribution<long long> dist(Limits::min(), Limits::max());
+    const std::vector<NumT> specialOperands = {
+      0, 1, NumT(2), NumT(-1), NumT(-2), Limits::min(), Limits::max(), NumT(Limits::min() + 1), NumT(Limits::max() - 1)
+    };
+    const BatchOp ops[] = {BatchOp::ADD, BatchOp::SUBTRACT, BatchOp::MULTIPLY, BatchOp::DIVIDE, BatchOp::SET};
+    
+    for(batch::Isa isa : allIsas) {
+      if(!batch::isSupported(isa))
+        continue;
+      
+      const detail::BatchTable<NumT> &table = detail::batchTable<NumT>(isa);
+      for(int trial = 0; trial < 200; ++trial) {
+        NumT min = NumT(dist(rng)), max = NumT(dist(rng));
+        if(min > max)
+          std::swap(min, max);
+        if(trial % 4 == 0) {
+          min = Limits::min();
+          max = Limits::max();
+        }
+        
+        const NumT other = (trial < int(specialOperands.size() * 4)) ? specialOperands[trial / 4] : NumT(dist(rng));
+        const std::size_t count = std::size_t(trial % 67) + 64 * (trial % 3);
+        std::vector<NumT> values(count), mins(count), maxs(count);
+        for(std::size_t i = 0; i < count; ++i) {
+          values[i] = NumT(dist(rng));
+          mins[i] = NumT(dist(rng));
+          maxs[i] = NumT(dist(rng));
+          if(mins[i] > maxs[i])
+            std::swap(mins[i], maxs[i]);
+        }
+        
+        for(BatchOp op : ops) {
+          std::vector<NumT> expected = values, actual = values;
+          for(NumT &value : expected)
+            applyScalar(op, value, other, min, max);
+          applyBatch(table, op, actual, other, min, max);
+          
+          for(std::size_t i = 0; i < count; ++i)
+            ASSERT_EQ(actual[i], expected[i]) << "Instruction set " << int(isa) << ", op " << int(op) << ": "
+                << (long long) values[i] << " with " << (long long) other << " in [" << (long long) min << ", "
+                << (long long) max << "] differs at index " << i << ".";
+          
+          expected = values;
+          actual = values;
+          for(std::size_t i = 0; i < count; ++i)
+            applyScalar(op, expected[i], other, mins[i], maxs[i]);
+          applyBatchLanes(table, op, actual, other, mins, maxs);
+          
+          for(std::size_t i = 0; i < count; ++i)
+            ASSERT_EQ(actual[i], expected[i]) << "Instruction set " << int(isa) << ", per-element op " << int(op)
+                << ": " << (long long) values[i] << " with " << (long long) other << " in [" << (long long) mins[i]
+                << ", " << (long long) maxs[i] << "] differs at index " << i << ".";
+        }
+      }
+    }
+  }
+  
+  TEST(BatchTests, Int8MatchesKernels)
+  {
+    checkAgainstKernels<int8_t>();
+  }
+  
+  TEST(BatchTests, Int16MatchesKernels)
+  {
+    checkAgainstKernels<int16_t>();
+  }
+  
+  TEST(BatchTests, Int32MatchesKernels)
+  {
+    checkAgainstKernels<int32_t>();
+  }
+  
+  TEST(BatchTests, UnsignedMatchesKernels)
+  {
+    checkAgainstKernels<uint8_t>();
+    checkAgainstKernels<uint16_t>();
+    checkAgainstKernels<uint32_t>();
+  }
+  
+  TEST(BatchTests, ScalarFallbackTypes)
+  {
+    checkAgainstKernels<int64_t>();
+    
+    std::vector<double> values = {0.5, -3.0, 9.75};
+    batch::add(values.data(), values.size(), 1.0, -2.0, 10.0);
+    EXPECT_EQ(values[0], 1.5) << "Decimal batch addition should be exact within bounds.";
+    EXPECT_EQ(values[1], -2.0) << "Decimal batch addition should saturate at the minimum.";
+    EXPECT_EQ(values[2], 10.0) << "Decimal batch addition should saturate at the maximum.";
+  }
+  
+  TEST(BatchTests, PublicInterface)
+  {
+    std::vector<int16_t> values(100, 30000);
+    batch::add(values.data(), values.size(), 5000, -20000, 31000);
+    EXPECT_EQ(values[99], 31000) << "Batch addition past the maximum should saturate.";
+    batch::multiply(values.data(), values.size(), -2, -20000, 31000);
+    EXPECT_EQ(values[0], -20000) << "Batch multiplication past the minimum should saturate.";
+    batch::divide(values.data(), values.size(), 0, -20000, 31000);
+    EXPECT_EQ(values[50], -20000) << "Batch division of a negative by zero should yield the minimum.";
+    batch::subtract(values.data(), values.size(), -100, -20000, 31000);
+    EXPECT_EQ(values[1], -19900) << "Batch subtraction should be exact within bounds.";
+    batch::set(values.data(), values.data(), values.size(), 0, 10);
+    EXPECT_EQ(values[2], 0) << "Batch assignment should clamp in place.";
+    EXPECT_TRUE(batch::isSupported(batch::activeIsa())) << "The active instruction set must be supported.";
+  }
+  
+  // Compares every supported instruction set's comparisons, range masks and
+  // counts against those of the scalar table, at lengths leaving tails of
+  // every size and masks ending mid-word
+  template<typename NumT>
+  void checkComparisons()
+  {
+    using Limits = std::numeric_limits<NumT>;
+    std::mt19937_64 rng(2029);
+    std::uniform_int_distribution<long long> dist(Limits::min(), Limits::max());
+    std::uniform_int_distribution<int> small(-3, 3);
+    const batch::Comparison comparisons[] = {
+      batch::Comparison::LESS, batch::Comparison::LESS_EQUAL, batch::Comparison::EQUAL,
+      batch::Comparison::NOT_EQUAL, batch::Comparison::GREATER_EQUAL, batch::Comparison::GREATER
+    };
+    const detail::BatchTable<NumT> &scalar = detail::ScalarBatch<NumT>::table;
+    
+    for(batch::Isa isa : allIsas) {
+      if(!batch::isSupported(isa))
+        continue;
+      
+      const detail::BatchTable<NumT> &table = detail::batchTable<NumT>(isa);
+      for(int trial = 0; trial < 60; ++trial) {
+        const std::size_t count = std::size_t(trial % 67) + 64 * (trial % 4);
+        std::vector<NumT> values(count);
+        for(NumT &value : values)
+          value = (trial % 2) ? NumT(small(rng)) : NumT(dist(rng));
+        
+        const NumT pivot = (trial % 3 == 0) ? Limits::min() : (trial % 3 == 1) ? Limits::max() : NumT(small(rng));
+        NumT low = NumT(small(rng)), high = NumT(small(rng));
+        if(trial % 5 == 0)
+          std::swap(low, high);
+        
+        std::vector<uint64_t> expected((count + 63) / 64), actual((count + 63) / 64, ~uint64_t(0));
+        for(batch::Comparison cmp : comparisons) {
+          scalar.compare(values.data(), count, cmp, pivot, expected.data());
+          table.compare(values.data(), count, cmp, pivot, actual.data());
+          EXPECT_EQ(actual, expected) << "Instruction set " << int(isa) << ", comparison " << int(cmp)
+              << " against " << (long long) pivot << " over " << count << " values differs.";
+        }
+        
+        scalar.maskWithin(values.data(), count, low, high, expected.data());
+        table.maskWithin(values.data(), count, low, high, actual.data());
+        EXPECT_EQ(actual, expected) << "Instruction set " << int(isa) << ", mask of [" << (long long) low << ", "
+            << (long long) high << "] over " << count << " values differs.";
+        const std::size_t inRange = scalar.countWithin(values.data(), count, low, high);
+        EXPECT_EQ(table.countWithin(values.data(), count, low, high), inRange)
+            << "Instruction set " << int(isa) << ", count of [" << (long long) low << ", " << (long long) high
+            << "] over " << count << " values differs.";
+      }
+    }
+  }
+  
+  TEST(BatchTests, ComparisonsMatchScalar)
+  {
+    checkComparisons<int8_t>();
+    checkComparisons<int16_t>();
+    checkComparisons<int32_t>();
+    checkComparisons<uint8_t>();
+    checkComparisons<uint16_t>();
+    checkComparisons<uint32_t>();
+  }
+  
+  TEST(BatchTests, SearchInterface)
+  {
+    std::vector<int32_t> values(200);
+    for(std::size_t i = 0; i < values.size(); ++i)
+      values[i] = int32_t(i / 2) - 20;
+    
+    std::vector<uint64_t> mask(4, ~uint64_t(0));
+    batch::compare(values.data(), values.size(), batch::Comparison::LESS, -10, mask.data());
+    EXPECT_EQ(mask[0], (uint64_t(1) << 20) - 1) << "Bit i of the mask should hold value i's comparison.";
+    EXPECT_EQ(mask[3], 0u) << "Bits past the last value should be cleared.";
+    batch::maskInRange(values.data(), values.size(), 12, 13, mask.data());
+    EXPECT_EQ(mask[1], uint64_t(15)) << "Values 64 to 67 should lie in range.";
+    EXPECT_EQ(batch::countInRange(values.data(), values.size(), 0, 9), 20u);
+    EXPECT_EQ(batch::countInRange(values.data(), values.size(), 9, 0), 0u) << "An inverted range should be empty.";
+    
+    EXPECT_EQ(batch::lowerBound(values.data(), values.size(), -20), 0u);
+    EXPECT_EQ(batch::lowerBound(values.data(), values.size(), 7), 54u) << "The first of equal values should be found.";
+    EXPECT_EQ(batch::lowerBound(values.data(), values.size(), 1000), values.size());
+    EXPECT_EQ(batch::lowerBound(values.data(), 0, 5), 0u) << "An empty buffer should be searched safely.";
+    for(int32_t key = -25; key < 85; ++key)
+      EXPECT_EQ(batch::lowerBound(values.data(), values.size(), key),
+          std::size_t(std::lower_bound(values.begin(), values.end(), key) - values.begin())) << "for key " << key;
+    
+    const std::vector<double> decimals = {-1.5, 0.0, 2.25, 2.25, 8.0};
+    EXPECT_EQ(batch::countInRange(decimals.data(), decimals.size(), 0.0, 2.25), 3u);
+    EXPECT_EQ(batch::lowerBound(decimals.data(), decimals.size(), 2.0), 2u) << "Unvectorized types should search too.";
+  }
+}
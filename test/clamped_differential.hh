@@ -0,0 +1,763 @@
+/** \file
+ * A differential oracle for every saturating operator, shared by the
+ * randomized tests in clamped_differential_test.cc and by the fuzz target
+ * and throughput benchmark in clamped_fuzz.cc.
+ * 
+ * Each case is one operation on one value within one pair of bounds. The
+ * oracle computes the exact result in a type wide enough to hold it, a
+ * 128-bit integer or a long double, and clamps it once. Every
+ * implementation of the operation, from the portable kernels to each
+ * instruction set of the batch operations, must agree with it exactly for
+ * the integral types, and to within a few roundings for the decimal ones.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "clamped_batch.hh"
+#include "clamped_numbers.hh"
+#include "flat_clamped_numbers.hh"
+
+namespace differential
+{
+  using namespace clamped;
+  
+  /** The operations checked against the oracle. */
+  enum class Op: uint8_t { ADD, SUBTRACT, MULTIPLY, DIVIDE, MODULO };
+  
+  inline const char * opName(Op op)
+  {
+    switch(op) {
+      case Op::ADD:      return "+";
+      case Op::SUBTRACT: return "-";
+      case Op::MULTIPLY: return "*";
+      case Op::DIVIDE:   return "/";
+      default:           return "%";
+    }
+  }
+  
+  /** One operation on one value within one pair of bounds, `min <= value <= max`. */
+  template<typename NumT>
+  struct Case
+  {
+    Op op;
+    NumT value;
+    NumT other;
+    NumT min;
+    NumT max;
+  };
+  
+  /** The number of operations defined on NumT: decimals have no modulo. */
+  template<typename NumT>
+  constexpr int opCount()
+  {
+    return std::is_integral<NumT>::value ? 5 : 4;
+  }
+  
+  // ################################################### Oracle ################################################### //
+  
+  // Clamps an exact result, held in some wider type, into [min, max]
+  template<typename NumT, typename WideT>
+  ClampResult<NumT> settle(const WideT &exact, const NumT &min, const NumT &max)
+  {
+    if(exact < WideT(min))
+      return {min, ClampReaction::MINIMUM};
+    else if(exact > WideT(max))
+      return {max, ClampReaction::MAXIMUM};
+    else
+      return {NumT(exact), ClampReaction::NONE};
+  }
+  
+  // Division by zero saturates toward the sign of the dividend, and leaves zero as it was
+  template<typename NumT>
+  ClampResult<NumT> divisionByZero(const Case<NumT> &c)
+  {
+    if(c.value == 0)
+      return {c.value, ClampReaction::NONE};
+    else if(c.value > 0)
+      return {c.max, ClampReaction::MAXIMUM};
+    else
+      return {c.min, ClampReaction::MINIMUM};
+  }
+  
+# ifdef CLAMPED_HAS_INT128
+  /**
+   * Returns the exact result of a case on an integral type, clamped once.
+   * 
+   * \param c the case to evaluate
+   * \return Returns the value and reaction every implementation must produce.
+   */
+  template<typename NumT>
+  typename std::enable_if<std::is_integral<NumT>::value, ClampResult<NumT>>::type
+  oracle(const Case<NumT> &c)
+  {
+    using detail::Int128;
+    using detail::UInt128;
+    const Int128 value = c.value, other = c.other;
+    switch(c.op) {
+      case Op::ADD:      return settle(value + other, c.min, c.max);
+      case Op::SUBTRACT: return settle(value - other, c.min, c.max);
+      case Op::MULTIPLY:
+        // A product of two 64-bit naturals may reach 2^128, beyond Int128
+        if(std::is_signed<NumT>::value)
+          return settle(value * other, c.min, c.max);
+        else
+          return settle(UInt128(c.value) * UInt128(c.other), c.min, c.max);
+      case Op::DIVIDE:   return (other == 0) ? divisionByZero(c) : settle(value / other, c.min, c.max);
+      default:           return settle((other == 0) ? Int128(0) : value % other, c.min, c.max);
+    }
+  }
+# endif
+  
+  /**
+   * Returns the result of a case on a decimal type, formed in long double
+   * and clamped once.
+   * 
+   * \param c the case to evaluate
+   * \return Returns the value and reaction every implementation must approximate.
+   */
+  template<typename NumT>
+  typename std::enable_if<std::is_floating_point<NumT>::value, ClampResult<NumT>>::type
+  oracle(const Case<NumT> &c)
+  {
+    const long double value = c.value, other = c.other;
+    switch(c.op) {
+      case Op::ADD:      return settle(value + other, c.min, c.max);
+      case Op::SUBTRACT: return settle(value - other, c.min, c.max);
+      case Op::MULTIPLY: return settle(value * other, c.min, c.max);
+      default:           return (other == 0) ? divisionByZero(c) : settle(value / other, c.min, c.max);
+    }
+  }
+  
+  /**
+   * Returns whether an integral result agrees with the oracle's: exactly,
+   * in its value and, where the implementation reports one, its reaction.
+   */
+  template<typename NumT>
+  typename std::enable_if<std::is_integral<NumT>::value, bool>::type
+  agrees(const Case<NumT> &, const ClampResult<NumT> &expected, const ClampResult<NumT> &actual, bool reports)
+  {
+    return actual.value == expected.value && (!reports || actual.reaction == expected.reaction);
+  }
+  
+  /**
+   * Returns whether a decimal result agrees with the oracle's: it must lie
+   * within the bounds, name the bound it saturated at, and differ from the
+   * exact result by no more than a few roundings. Reactions may differ
+   * where the exact result lies within those roundings of a bound.
+   */
+  template<typename NumT>
+  typename std::enable_if<std::is_floating_point<NumT>::value, bool>::type
+  agrees(const Case<NumT> &c, const ClampResult<NumT> &expected, const ClampResult<NumT> &actual, bool reports)
+  {
+    if(!(actual.value >= c.min && actual.value <= c.max))
+      return false;
+    if(reports && actual.reaction == ClampReaction::MINIMUM && actual.value != c.min)
+      return false;
+    if(reports && actual.reaction == ClampReaction::MAXIMUM && actual.value != c.max)
+      return false;
+    
+    const long double magnitude = std::fmax(std::fabs((long double) expected.value), std::fabs((long double) actual.value));
+    const long double tolerance = 4 * (magnitude * std::numeric_limits<NumT>::epsilon()
+        + std::numeric_limits<NumT>::denorm_min());
+    return std::fabs((long double) actual.value - (long double) expected.value) <= tolerance;
+  }
+  
+  // ############################################### Implementations ############################################## //
+  
+  /** The length of the buffers given to batch operations: a full vector of every width, and a ragged tail. */
+  constexpr std::size_t batchLength = 67;
+  
+  /**
+   * One implementation of the operators under test. `apply` evaluates a
+   * case, writing one result for each element it computed into `results`,
+   * which holds `batchLength`; it returns how many it wrote, or zero where
+   * the implementation lacks the case's operation.
+   */
+  template<typename NumT>
+  struct Implementation
+  {
+    std::string name;
+    std::size_t (*apply)(const Case<NumT> &c, ClampResult<NumT> *results);
+    bool reportsReaction;
+  };
+  
+  // The kernel families' modulo, which decimals lack
+  template<typename KernelsT, typename NumT>
+  ClampReaction kernelModulo(std::true_type, NumT &value, const Case<NumT> &c)
+  {
+    return KernelsT::modulo(value, c.other, c.min, c.max);
+  }
+  
+  template<typename KernelsT, typename NumT>
+  ClampReaction kernelModulo(std::false_type, NumT &, const Case<NumT> &)
+  {
+    return ClampReaction::NONE;
+  }
+  
+  // Applies a case through a family of kernels
+  template<typename KernelsT, typename NumT>
+  std::size_t applyKernels(const Case<NumT> &c, ClampResult<NumT> *results)
+  {
+    NumT value = c.value;
+    ClampReaction reaction = ClampReaction::NONE;
+    switch(c.op) {
+      case Op::ADD:      reaction = KernelsT::add(value, c.other, c.min, c.max); break;
+      case Op::SUBTRACT: reaction = KernelsT::subtract(value, c.other, c.min, c.max); break;
+      case Op::MULTIPLY: reaction = KernelsT::multiply(value, c.other, c.min, c.max); break;
+      case Op::DIVIDE:   reaction = KernelsT::divide(value, c.other, c.min, c.max); break;
+      default:
+        if(!std::is_integral<NumT>::value)
+          return 0;
+        reaction = kernelModulo<KernelsT>(std::is_integral<NumT>(), value, c);
+      break;
+    }
+    
+    results[0] = {value, reaction};
+    return 1;
+  }
+  
+  // The checked operators of a clamped number type, modulo included where it has one
+  template<typename ClampedT, typename NumT>
+  ClampResult<NumT> checkedModulo(std::true_type, ClampedT &number, const NumT &other)
+  {
+    return number.moduloChecked(other);
+  }
+  
+  template<typename ClampedT, typename NumT>
+  ClampResult<NumT> checkedModulo(std::false_type, ClampedT &number, const NumT &)
+  {
+    return {number.value(), ClampReaction::NONE};
+  }
+  
+  // Applies a case through the checked operators of a clamped number type
+  template<typename ClampedT, typename NumT>
+  std::size_t applyChecked(const Case<NumT> &c, ClampResult<NumT> *results)
+  {
+    ClampedT number(c.value, c.min, c.max);
+    switch(c.op) {
+      case Op::ADD:      results[0] = number.addChecked(c.other); break;
+      case Op::SUBTRACT: results[0] = number.subtractChecked(c.other); break;
+      case Op::MULTIPLY: results[0] = number.multiplyChecked(c.other); break;
+      case Op::DIVIDE:   results[0] = number.divideChecked(c.other); break;
+      default:
+        if(!std::is_integral<NumT>::value)
+          return 0;
+        results[0] = checkedModulo(std::is_integral<NumT>(), number, c.other);
+      break;
+    }
+    
+    return 1;
+  }
+  
+  // The compound assignment operators of a clamped number type, modulo included where it has one
+  template<typename ClampedT, typename NumT>
+  void assignModulo(std::true_type, ClampedT &number, const NumT &other)
+  {
+    number %= other;
+  }
+  
+  template<typename ClampedT, typename NumT>
+  void assignModulo(std::false_type, ClampedT &, const NumT &)
+  {}
+  
+  // Applies a case through the compound assignment operators of a clamped number type
+  template<typename ClampedT, typename NumT>
+  std::size_t applyOperators(const Case<NumT> &c, ClampResult<NumT> *results)
+  {
+    ClampedT number(c.value, c.min, c.max);
+    switch(c.op) {
+      case Op::ADD:      number += c.other; break;
+      case Op::SUBTRACT: number -= c.other; break;
+      case Op::MULTIPLY: number *= c.other; break;
+      case Op::DIVIDE:   number /= c.other; break;
+      default:
+        if(!std::is_integral<NumT>::value)
+          return 0;
+        assignModulo(std::is_integral<NumT>(), number, c.other);
+      break;
+    }
+    
+    results[0] = {number.value(), ClampReaction::NONE};
+    return 1;
+  }
+  
+  // Applies a case to a whole buffer through one instruction set's batch
+  // operations, with bounds shared by every element or held per element
+  template<typename NumT, batch::Isa Isa, bool Lanes>
+  std::size_t applyBatch(const Case<NumT> &c, ClampResult<NumT> *results)
+  {
+    if(c.op == Op::MODULO)
+      return 0;
+    
+    NumT values[batchLength], mins[batchLength], maxs[batchLength];
+    for(std::size_t i = 0; i < batchLength; ++i) {
+      values[i] = c.value;
+      mins[i] = c.min;
+      maxs[i] = c.max;
+    }
+    
+    const detail::BatchTable<NumT> &table = detail::batchTable<NumT>(Isa);
+    switch(c.op) {
+      case Op::ADD:
+        Lanes ? table.addLanes(values, batchLength, c.other, mins, maxs)
+            : table.add(values, batchLength, c.other, c.min, c.max);
+      break;
+      case Op::SUBTRACT:
+        Lanes ? table.subtractLanes(values, batchLength, c.other, mins, maxs)
+            : table.subtract(values, batchLength, c.other, c.min, c.max);
+      break;
+      case Op::MULTIPLY:
+        Lanes ? table.multiplyLanes(values, batchLength, c.other, mins, maxs)
+            : table.multiply(values, batchLength, c.other, c.min, c.max);
+      break;
+      default:
+        Lanes ? table.divideLanes(values, batchLength, c.other, mins, maxs)
+            : table.divide(values, batchLength, c.other, c.min, c.max);
+      break;
+    }
+    
+    for(std::size_t i = 0; i < batchLength; ++i)
+      results[i] = {values[i], ClampReaction::NONE};
+    
+    return batchLength;
+  }
+  
+  inline const char * isaName(batch::Isa isa)
+  {
+    switch(isa) {
+      case batch::Isa::SCALAR:   return "scalar";
+      case batch::Isa::SSE41:    return "sse4.1";
+      case batch::Isa::AVX2:     return "avx2";
+      case batch::Isa::AVX512BW: return "avx512bw";
+      default:                   return "neon";
+    }
+  }
+  
+  // Adds the batch operations of one instruction set, where this build and
+  // processor support it and it differs from the scalar fallback
+  template<typename NumT, batch::Isa Isa>
+  void addBatch(std::vector<Implementation<NumT>> &list)
+  {
+    if(!batch::isSupported(Isa))
+      return;
+    if(Isa != batch::Isa::SCALAR && &detail::batchTable<NumT>(Isa) == &detail::batchTable<NumT>(batch::Isa::SCALAR))
+      return;
+    
+    list.push_back({std::string("batch ") + isaName(Isa), &applyBatch<NumT, Isa, false>, false});
+    list.push_back({std::string("batch ") + isaName(Isa) + " lanes", &applyBatch<NumT, Isa, true>, false});
+  }
+  
+  // The portable kernels, bypassing the builtin specializations
+  template<typename IntT>
+  struct PortableIntegerKernels
+  {
+    static ClampReaction add(IntT &c, IntT o, IntT lo, IntT hi) { return detail::addInteger(c, o, lo, hi); }
+    static ClampReaction subtract(IntT &c, IntT o, IntT lo, IntT hi) { return detail::subtractInteger(c, o, lo, hi); }
+    static ClampReaction multiply(IntT &c, IntT o, IntT lo, IntT hi) { return detail::multiplyInteger(c, o, lo, hi); }
+    static ClampReaction divide(IntT &c, IntT o, IntT lo, IntT hi) { return detail::divideInteger(c, o, lo, hi); }
+    static ClampReaction modulo(IntT &c, IntT o, IntT lo, IntT hi) { return detail::moduloInteger(c, o, lo, hi); }
+  };
+  
+  template<typename NatT>
+  struct PortableNaturalKernels
+  {
+    static ClampReaction add(NatT &c, NatT o, NatT lo, NatT hi) { return detail::addNatural(c, o, lo, hi); }
+    static ClampReaction subtract(NatT &c, NatT o, NatT lo, NatT hi) { return detail::subtractNatural(c, o, lo, hi); }
+    static ClampReaction multiply(NatT &c, NatT o, NatT lo, NatT hi) { return detail::multiplyNatural(c, o, lo, hi); }
+    static ClampReaction divide(NatT &c, NatT o, NatT lo, NatT hi) { return detail::divideNatural(c, o, lo, hi); }
+    static ClampReaction modulo(NatT &c, NatT o, NatT lo, NatT hi) { return detail::moduloNatural(c, o, lo, hi); }
+  };
+  
+  // The portable kernels bounding products by division, as for types with no wider counterpart
+  template<typename IntT>
+  struct DividingIntegerKernels: PortableIntegerKernels<IntT>
+  {
+    static ClampReaction multiply(IntT &c, IntT o, IntT lo, IntT hi)
+    { return detail::multiplyInteger<IntT, void>(c, o, lo, hi); }
+  };
+  
+  template<typename NatT>
+  struct DividingNaturalKernels: PortableNaturalKernels<NatT>
+  {
+    static ClampReaction multiply(NatT &c, NatT o, NatT lo, NatT hi)
+    { return detail::multiplyNatural<NatT, void>(c, o, lo, hi); }
+  };
+  
+  // The implementations particular to each family of numeric type
+  template<typename NumT, typename = void>
+  struct Family;
+  
+  template<typename NatT>
+  struct Family<NatT, typename std::enable_if<std::is_integral<NatT>::value && !std::is_signed<NatT>::value>::type>
+  {
+    static void add(std::vector<Implementation<NatT>> &list)
+    {
+      list.push_back({"portable", &applyKernels<PortableNaturalKernels<NatT>, NatT>, true});
+      list.push_back({"dividing", &applyKernels<DividingNaturalKernels<NatT>, NatT>, true});
+      list.push_back({"polymorphic", &applyChecked<ClampedNaturalNumber<NatT>, NatT>, true});
+      list.push_back({"polymorphic operators", &applyOperators<ClampedNaturalNumber<NatT>, NatT>, false});
+      list.push_back({"flat", &applyChecked<flat::ClampedNaturalNumber<NatT>, NatT>, true});
+      list.push_back({"flat operators", &applyOperators<flat::ClampedNaturalNumber<NatT>, NatT>, false});
+    }
+  };
+  
+  template<typename IntT>
+  struct Family<IntT, typename std::enable_if<std::is_integral<IntT>::value && std::is_signed<IntT>::value>::type>
+  {
+    static void add(std::vector<Implementation<IntT>> &list)
+    {
+      list.push_back({"portable", &applyKernels<PortableIntegerKernels<IntT>, IntT>, true});
+      list.push_back({"dividing", &applyKernels<DividingIntegerKernels<IntT>, IntT>, true});
+      list.push_back({"polymorphic", &applyChecked<ClampedInteger<IntT>, IntT>, true});
+      list.push_back({"polymorphic operators", &applyOperators<ClampedInteger<IntT>, IntT>, false});
+      list.push_back({"flat", &applyChecked<flat::ClampedInteger<IntT>, IntT>, true});
+      list.push_back({"flat operators", &applyOperators<flat::ClampedInteger<IntT>, IntT>, false});
+    }
+  };
+  
+  template<typename FloatT>
+  struct Family<FloatT, typename std::enable_if<std::is_floating_point<FloatT>::value>::type>
+  {
+    static void add(std::vector<Implementation<FloatT>> &list)
+    {
+      list.push_back({"exact", &applyKernels<detail::ExactDecimalKernels<FloatT>, FloatT>, true});
+      list.push_back({"fast", &applyKernels<detail::FastDecimalKernels<FloatT, NanPolicy::KEEP>, FloatT>, true});
+      list.push_back({"polymorphic", &applyChecked<ClampedDecimal<FloatT>, FloatT>, true});
+      list.push_back({"polymorphic operators", &applyOperators<ClampedDecimal<FloatT>, FloatT>, false});
+      list.push_back({"flat", &applyChecked<flat::ClampedDecimal<FloatT>, FloatT>, true});
+      list.push_back({"flat operators", &applyOperators<flat::ClampedDecimal<FloatT>, FloatT>, false});
+    }
+  };
+  
+  /**
+   * Returns every implementation of the operators on NumT: the kernels each
+   * operator selects, the portable kernels behind them, the polymorphic and
+   * flat numbers, and the batch operations of each supported instruction set.
+   * 
+   * \return Returns the implementations to check against the oracle.
+   */
+  template<typename NumT>
+  const std::vector<Implementation<NumT>> & implementations()
+  {
+    static const std::vector<Implementation<NumT>> list = [] {
+      std::vector<Implementation<NumT>> built;
+      built.push_back({"kernels", &applyKernels<detail::ClampKernels<NumT>, NumT>, true});
+      Family<NumT>::add(built);
+      addBatch<NumT, batch::Isa::SCALAR>(built);
+      addBatch<NumT, batch::Isa::SSE41>(built);
+      addBatch<NumT, batch::Isa::AVX2>(built);
+      addBatch<NumT, batch::Isa::AVX512BW>(built);
+      addBatch<NumT, batch::Isa::NEON>(built);
+      return built;
+    }();
+    
+    return list;
+  }
+  
+  // ################################################# Checking ################################################# //
+  
+  // Prints a number legibly, whether a character type or a decimal
+  template<typename NumT>
+  void print(std::ostream &out, const NumT &number)
+  {
+    out << std::setprecision(std::numeric_limits<NumT>::max_digits10) << +number;
+  }
+  
+  inline const char * reactionName(ClampReaction reaction)
+  {
+    switch(reaction) {
+      case ClampReaction::MINIMUM: return "MINIMUM";
+      case ClampReaction::MAXIMUM: return "MAXIMUM";
+      default:                     return "NONE";
+    }
+  }
+  
+  /**
+   * Describes a case, for the report of a disagreement.
+   * 
+   * \param c the case to describe
+   * \return Returns the case as an expression, e.g. `5 * -3 in [-10, 10]`.
+   */
+  template<typename NumT>
+  std::string describe(const Case<NumT> &c)
+  {
+    std::ostringstream out;
+    print(out, c.value);
+    out << ' ' << opName(c.op) << ' ';
+    print(out, c.other);
+    out << " in [";
+    print(out, c.min);
+    out << ", ";
+    print(out, c.max);
+    out << ']';
+    return out.str();
+  }
+  
+  /**
+   * Runs one case through every implementation, comparing each result with
+   * the oracle's.
+   * 
+   * \param c the case to check
+   * \return Returns a description of every disagreement, or an empty string
+   *     where every implementation agrees.
+   */
+  template<typename NumT>
+  std::string check(const Case<NumT> &c)
+  {
+    const ClampResult<NumT> expected = oracle(c);
+    ClampResult<NumT> results[batchLength];
+    std::ostringstream report;
+    for(const Implementation<NumT> &impl : implementations<NumT>()) {
+      const std::size_t count = impl.apply(c, results);
+      for(std::size_t i = 0; i < count; ++i)
+        if(!agrees(c, expected, results[i], impl.reportsReaction)) {
+          report << impl.name << ": " << describe(c) << " gave ";
+          print(report, results[i].value);
+          if(impl.reportsReaction)
+            report << " (" << reactionName(results[i].reaction) << ")";
+          if(count > 1)
+            report << " at element " << i;
+          report << ", expected ";
+          print(report, expected.value);
+          report << " (" << reactionName(expected.reaction) << ")\n";
+          break;
+        }
+    }
+    
+    return report.str();
+  }
+  
+  // ################################################ Generation ################################################ //
+  
+  template<typename NumT>
+  typename std::enable_if<std::is_integral<NumT>::value, bool>::type isFinite(const NumT &)
+  {
+    return true;
+  }
+  
+  template<typename NumT>
+  typename std::enable_if<std::is_floating_point<NumT>::value, bool>::type isFinite(const NumT &number)
+  {
+    return std::isfinite(number);
+  }
+  
+  // Orders a case's bounds and clamps its value into them, as the
+  // constructors of the clamped numbers would
+  template<typename NumT>
+  Case<NumT> normalize(Case<NumT> c)
+  {
+    if(c.max < c.min) {
+      const NumT swapped = c.min;
+      c.min = c.max;
+      c.max = swapped;
+    }
+    
+    c.value = (c.value < c.min) ? c.min : (c.value > c.max) ? c.max : c.value;
+    return c;
+  }
+  
+  /**
+   * Draws a value of an integral type, weighted toward those at which
+   * saturation is decided: small values, values near either limit, and
+   * powers of two and their neighbours.
+   */
+  template<typename NumT>
+  typename std::enable_if<std::is_integral<NumT>::value, NumT>::type interesting(std::mt19937_64 &rng)
+  {
+    using UIntT = typename std::make_unsigned<NumT>::type;
+    const uint64_t bits = rng();
+    const int near = int(rng() % 33) - 16;
+    switch(rng() % 5) {
+      case 0:
+        return NumT(near);
+      case 1:
+        return NumT(UIntT(std::numeric_limits<NumT>::min()) + UIntT(near + 16));
+      case 2:
+        return NumT(UIntT(std::numeric_limits<NumT>::max()) - UIntT(near + 16));
+      case 3: {
+        const UIntT power = UIntT(UIntT(1) << (bits % std::numeric_limits<UIntT>::digits));
+        const UIntT neighbour = UIntT(power + UIntT(near % 2));
+        return NumT((near < 0 && std::is_signed<NumT>::value) ? UIntT(0) - neighbour : neighbour);
+      }
+      default: {
+        NumT raw;
+        std::memcpy(&raw, &bits, sizeof(NumT));
+        return raw;
+      }
+    }
+  }
+  
+  /**
+   * Draws a finite value of a decimal type, weighted toward those at which
+   * saturation is decided: small integers and fractions, values near the
+   * largest and smallest magnitudes, and powers of two.
+   */
+  template<typename NumT>
+  typename std::enable_if<std::is_floating_point<NumT>::value, NumT>::type interesting(std::mt19937_64 &rng)
+  {
+    using Limits = std::numeric_limits<NumT>;
+    const uint64_t bits = rng();
+    const NumT sign = (bits & 1) ? NumT(-1) : NumT(1);
+    const NumT near = NumT(1) - NumT(rng() % 4) * Limits::epsilon();
+    switch(rng() % 6) {
+      case 0:
+        return sign * NumT(rng() % 17);
+      case 1:
+        return sign / NumT(1 + rng() % 16);
+      case 2: {
+        const NumT extremes[] = {Limits::max(), Limits::min(), Limits::denorm_min(), Limits::epsilon()};
+        return sign * near * extremes[(bits >> 1) % 4];
+      }
+      case 3:
+        return sign * std::ldexp(NumT(1), Limits::min_exponent - Limits::digits
+            + int((bits >> 1) % uint64_t(Limits::max_exponent - Limits::min_exponent + Limits::digits)));
+      case 4:
+        return std::uniform_real_distribution<NumT>(-1000, 1000)(rng);
+      default: {
+        NumT raw;
+        std::memcpy(&raw, &bits, sizeof(NumT));
+        return isFinite(raw) ? raw : NumT(0);
+      }
+    }
+  }
+  
+  /**
+   * Draws a case of a random operation on values drawn by `interesting()`;
+   * one in four keeps the type's whole range as its bounds.
+   */
+  template<typename NumT>
+  Case<NumT> generate(std::mt19937_64 &rng)
+  {
+    Case<NumT> c;
+    c.op = Op(rng() % opCount<NumT>());
+    c.value = interesting<NumT>(rng);
+    c.other = interesting<NumT>(rng);
+    c.min = interesting<NumT>(rng);
+    c.max = interesting<NumT>(rng);
+    if(rng() % 4 == 0) {
+      c.min = std::numeric_limits<NumT>::lowest();
+      c.max = std::numeric_limits<NumT>::max();
+    }
+    
+    return normalize(c);
+  }
+  
+  /**
+   * Reads a case from raw input, as given by a fuzzer: a byte choosing the
+   * operation, then the value, operand and bounds. Non-finite decimals read
+   * as zero.
+   * 
+   * \param data the input, advanced past the bytes read
+   * \param size the number of bytes remaining, reduced by those read
+   * \param c the case to read into
+   * \return Returns false where too few bytes remain.
+   */
+  template<typename NumT>
+  bool decode(const uint8_t *&data, std::size_t &size, Case<NumT> &c)
+  {
+    if(size < 1 + 4 * sizeof(NumT))
+      return false;
+    
+    NumT fields[4];
+    c.op = Op(data[0] % opCount<NumT>());
+    for(int i = 0; i < 4; ++i) {
+      std::memcpy(&fields[i], data + 1 + i * sizeof(NumT), sizeof(NumT));
+      if(!isFinite(fields[i]))
+        fields[i] = 0;
+    }
+    
+    data += 1 + 4 * sizeof(NumT);
+    size -= 1 + 4 * sizeof(NumT);
+    c.value = fields[0];
+    c.other = fields[1];
+    c.min = fields[2];
+    c.max = fields[3];
+    c = normalize(c);
+    return true;
+  }
+  
+  template<typename NumT>
+  struct Tag
+  {
+    using type = NumT;
+  };
+  
+  inline const char * typeName(Tag<uint8_t>)  { return "uint8_t"; }
+  inline const char * typeName(Tag<uint16_t>) { return "uint16_t"; }
+  inline const char * typeName(Tag<uint32_t>) { return "uint32_t"; }
+  inline const char * typeName(Tag<uint64_t>) { return "uint64_t"; }
+  inline const char * typeName(Tag<int8_t>)   { return "int8_t"; }
+  inline const char * typeName(Tag<int16_t>)  { return "int16_t"; }
+  inline const char * typeName(Tag<int32_t>)  { return "int32_t"; }
+  inline const char * typeName(Tag<int64_t>)  { return "int64_t"; }
+  inline const char * typeName(Tag<float>)    { return "float"; }
+  inline const char * typeName(Tag<double>)   { return "double"; }
+  
+  /** The number of types `forEachType()` visits. */
+  constexpr int typeCount = 10;
+  
+# ifdef CLAMPED_HAS_INT128
+  /**
+   * Calls the given visitor with a `Tag` of each numeric type the oracle
+   * covers, every width of natural number, integer and decimal.
+   * 
+   * \param visit the visitor, taking a `Tag` and the type's index
+   */
+  template<typename VisitorT>
+  void forEachType(VisitorT &&visit)
+  {
+    visit(Tag<uint8_t>(), 0);
+    visit(Tag<uint16_t>(), 1);
+    visit(Tag<uint32_t>(), 2);
+    visit(Tag<uint64_t>(), 3);
+    visit(Tag<int8_t>(), 4);
+    visit(Tag<int16_t>(), 5);
+    visit(Tag<int32_t>(), 6);
+    visit(Tag<int64_t>(), 7);
+    visit(Tag<float>(), 8);
+    visit(Tag<double>(), 9);
+  }
+  
+  /**
+   * Checks every case encoded in raw input, as given by a fuzzer: a byte
+   * choosing the numeric type, then cases of that type as read by `decode()`.
+   * 
+   * \param data the input
+   * \param size the number of bytes of input
+   * \return Returns a description of every disagreement, or an empty string
+   *     where every implementation agrees.
+   */
+  inline std::string checkInput(const uint8_t *data, std::size_t size)
+  {
+    if(size < 1)
+      return "";
+    
+    const int chosen = data[0] % typeCount;
+    ++data;
+    --size;
+    std::string report;
+    forEachType([&](auto tag, int index) {
+      using NumT = typename decltype(tag)::type;
+      Case<NumT> c;
+      if(index == chosen)
+        while(report.empty() && decode(data, size, c))
+          report = check(c);
+    });
+    
+    return report;
+  }
+# endif
+}
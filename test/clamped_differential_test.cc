@@ -0,0 +1,71 @@
+#include <cstdint>
+
+#include <random>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "clamped_differential.hh"
+
+namespace
+{
+  using namespace clamped;
+  
+# ifdef CLAMPED_HAS_INT128
+  // The number of random cases of each type checked against the oracle
+  constexpr int casesPerType = 3000;
+  
+  TEST(DifferentialTests, EveryOperatorMatchesOracle)
+  {
+    differential::forEachType([](auto tag, int index) {
+      using NumT = typename decltype(tag)::type;
+      std::mt19937_64 rng(2026 + index);
+      int failures = 0;
+      for(int trial = 0; trial < casesPerType && failures < 5; ++trial) {
+        const std::string report = differential::check(differential::generate<NumT>(rng));
+        EXPECT_TRUE(report.empty()) << "Disagreement on " << differential::typeName(tag) << ":\n" << report;
+        failures += !report.empty();
+      }
+    });
+  }
+  
+  TEST(DifferentialTests, KnownEdgeCases)
+  {
+    using differential::Case;
+    using differential::Op;
+    EXPECT_EQ(differential::check(Case<int64_t>{Op::DIVIDE, INT64_MIN, -1, INT64_MIN, INT64_MAX}), "")
+        << "The one overflowing quotient should saturate.";
+    EXPECT_EQ(differential::check(Case<uint64_t>{Op::MULTIPLY, UINT64_MAX, UINT64_MAX, 0, UINT64_MAX}), "")
+        << "Products of the widest naturals should saturate.";
+    EXPECT_EQ(differential::check(Case<uint8_t>{Op::SUBTRACT, 10, 7, 5, 200}), "");
+    EXPECT_EQ(differential::check(Case<uint32_t>{Op::DIVIDE, 7, 0, 3, 9}), "");
+    EXPECT_EQ(differential::check(Case<double>{Op::MULTIPLY, -5.0, -5.0, -10.0, 10.0}), "")
+        << "A product of negatives should saturate at the maximum.";
+    EXPECT_EQ(differential::check(Case<double>{Op::MULTIPLY, 2.0, -2.0, -10.0, 10.0}), "");
+    EXPECT_EQ(differential::check(Case<float>{Op::MULTIPLY, 5.0f, 0.0f, 1.0f, 10.0f}), "")
+        << "A zero product should be clamped into the bounds.";
+    EXPECT_EQ(differential::check(Case<double>{Op::DIVIDE, -100.0, 10.0, -200.0, -50.0}), "")
+        << "A quotient nearer zero may exceed a negative maximum.";
+    EXPECT_EQ(differential::check(Case<float>{Op::DIVIDE, 1e-40f, 1e-40f, -10.0f, 10.0f}), "")
+        << "Division by a subnormal should not pass through an infinite reciprocal.";
+    EXPECT_EQ(differential::check(Case<float>{Op::MULTIPLY, 1e38f, 1e-40f, -10.0f, 10.0f}), "");
+  }
+  
+  TEST(DifferentialTests, DecodesFuzzerInput)
+  {
+    const uint8_t input[] = {4, 2, 0x80, 0x7f, 8, 0xf0};
+    EXPECT_EQ(differential::checkInput(input, sizeof(input)), "") << "Input should decode to int8_t cases.";
+    EXPECT_EQ(differential::checkInput(input, 0), "") << "Empty input should check nothing.";
+    
+    differential::Case<int8_t> c;
+    const uint8_t *data = input + 1;
+    std::size_t size = sizeof(input) - 1;
+    ASSERT_TRUE(differential::decode(data, size, c));
+    EXPECT_EQ(c.op, differential::Op::MULTIPLY);
+    EXPECT_EQ(c.other, 127);
+    EXPECT_EQ(c.min, -16) << "Bounds should be put in order.";
+    EXPECT_EQ(c.max, 8);
+    EXPECT_EQ(c.value, -16) << "The value should be clamped into the bounds.";
+    EXPECT_FALSE(differential::decode(data, size, c)) << "Too few bytes should remain for another case.";
+  }
+# endif
+}
@@ -0,0 +1,137 @@
+// The differential oracle of clamped_differential.hh as a fuzz target and
+// as a throughput benchmark.
+//
+// Built with -DCLAMPED_LIBFUZZER and clang's -fsanitize=fuzzer, by `make -C
+// release fuzz`, this is a libFuzzer target: each input chooses a numeric
+// type, then encodes cases of it, and any disagreement with the oracle
+// aborts with a description. Built otherwise, by `make -C release
+// differential`, it draws random cases of every type and times each
+// implementation of the operators over them, failing on any disagreement,
+// so that a faster kernel is both measured and proven against the oracle.
+//
+//   ClampedNumbersDifferential.exe [--cases=N] [--seed=S]
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "clamped_differential.hh"
+
+#ifndef CLAMPED_HAS_INT128
+#error "The differential oracle needs a 128-bit integer type"
+#endif
+
+#ifdef CLAMPED_LIBFUZZER
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, std::size_t size)
+{
+  const std::string report = differential::checkInput(data, size);
+  if(!report.empty()) {
+    std::fputs(report.c_str(), stderr);
+    std::abort();
+  }
+  
+  return 0;
+}
+
+#else
+
+namespace
+{
+  using namespace clamped;
+  
+  // Receives each timed pass's checksum, so that its work is not discarded
+  volatile double sink;
+  
+  // Times each implementation over the same cases of NumT, then checks every
+  // result against the oracle; returns the number of disagreements
+  template<typename NumT>
+  std::size_t measure(const char *type, const std::vector<differential::Case<NumT>> &cases)
+  {
+    using Clock = std::chrono::steady_clock;
+    std::vector<ClampResult<NumT>> expected(cases.size());
+    const Clock::time_point oracleStart = Clock::now();
+    for(std::size_t i = 0; i < cases.size(); ++i)
+      expected[i] = differential::oracle(cases[i]);
+    
+    const double oracleTime = std::chrono::duration<double, std::nano>(Clock::now() - oracleStart).count();
+    std::printf("%-9s %-24s %12.2f\n", type, "oracle", oracleTime / cases.size());
+    
+    std::size_t disagreements = 0;
+    ClampResult<NumT> results[differential::batchLength];
+    for(const differential::Implementation<NumT> &impl : differential::implementations<NumT>()) {
+      // The first pass is timed, keeping only a checksum of its results
+      std::size_t applied = 0;
+      double checksum = 0;
+      const Clock::time_point start = Clock::now();
+      for(const differential::Case<NumT> &c : cases) {
+        applied += impl.apply(c, results);
+        checksum += double(results[0].value);
+      }
+      
+      const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+      sink = checksum;
+      
+      // The second pass checks every element against the oracle
+      std::size_t wrong = 0;
+      for(std::size_t i = 0; i < cases.size(); ++i) {
+        const std::size_t count = impl.apply(cases[i], results);
+        for(std::size_t j = 0; j < count; ++j)
+          if(!differential::agrees(cases[i], expected[i], results[j], impl.reportsReaction)) {
+            if(wrong++ == 0)
+              std::fputs(differential::check(cases[i]).c_str(), stderr);
+            break;
+          }
+      }
+      
+      std::printf("%-9s %-24s %12.2f %12zu %10zu\n", type, impl.name.c_str(), elapsed / (applied ? applied : 1),
+          applied, wrong);
+      disagreements += wrong;
+    }
+    
+    return disagreements;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  std::size_t caseCount = 200000;
+  uint64_t seed = 2026;
+  for(int i = 1; i < argc; ++i) {
+    if(std::strncmp(argv[i], "--cases=", 8) == 0)
+      caseCount = std::strtoull(argv[i] + 8, nullptr, 10);
+    else if(std::strncmp(argv[i], "--seed=", 7) == 0)
+      seed = std::strtoull(argv[i] + 7, nullptr, 10);
+    else {
+      std::fprintf(stderr, "usage: %s [--cases=N] [--seed=S]\n", argv[0]);
+      return 2;
+    }
+  }
+  
+  std::printf("%-9s %-24s %12s %12s %10s\n", "type", "implementation", "ns/element", "elements", "wrong");
+  std::size_t disagreements = 0;
+  differential::forEachType([&](auto tag, int index) {
+    using NumT = typename decltype(tag)::type;
+    std::mt19937_64 rng(seed + index);
+    std::vector<differential::Case<NumT>> cases(caseCount);
+    for(differential::Case<NumT> &c : cases)
+      c = differential::generate<NumT>(rng);
+    
+    disagreements += measure(differential::typeName(tag), cases);
+  });
+  
+  if(disagreements) {
+    std::fprintf(stderr, "%zu cases disagreed with the oracle\n", disagreements);
+    return 1;
+  }
+  
+  std::printf("Every implementation agreed with the oracle.\n");
+  return 0;
+}
+
+#endif
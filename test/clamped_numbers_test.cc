@@ -1,5 +1,11 @@
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "clamped_numbers.hh"
+#include "clamped_numbers.inl"
 
 namespace
 {
@@ -103,4 +109,263 @@ namespace
   {
     
   }
+  
+  TEST(FixedWidthTests, AliasFamilies)
+  {
+    EXPECT_TRUE((std::is_base_of<ClampedInteger<int8_t>, ClampedInt8>::value)) << "ClampedInt8 is not an integer.";
+    EXPECT_TRUE((std::is_same<ClampedUInt8, ClampedNaturalNumber<uint8_t>>::value))
+        << "ClampedUInt8 should be a natural number.";
+    EXPECT_TRUE((std::is_same<ClampedUInt64, ClampedNaturalNumber<uint64_t>>::value))
+        << "ClampedUInt64 should be a natural number.";
+  }
+  
+  TEST(FixedWidthTests, DefaultBounds)
+  {
+    ClampedInt16 num(5);
+    EXPECT_EQ(num.value(), 5) << "ClampedInt16 does not report correct starting value.";
+    EXPECT_EQ(num.minValue(), std::numeric_limits<int16_t>::min()) << "Default minimum is not the type minimum.";
+    EXPECT_EQ(num.maxValue(), std::numeric_limits<int16_t>::max()) << "Default maximum is not the type maximum.";
+    EXPECT_EQ(ClampedUInt32().value(), 0u) << "Default value should be zero.";
+  }
+  
+  TEST(FixedWidthTests, IntegerArithmetic)
+  {
+    ClampedInt8 num(100);
+    num += 100;
+    EXPECT_EQ(num.value(), 127) << "Addition past the type maximum should saturate.";
+    num -= 127;
+    num -= 127;
+    num -= 127;
+    EXPECT_EQ(num.value(), -128) << "Subtraction past the type minimum should saturate.";
+    num /= -1;
+    EXPECT_EQ(num.value(), 127) << "Negating the type minimum should saturate.";
+    
+    ClampedInt32 bounded(6, -10, 10);
+    EXPECT_EQ((bounded * 3).value(), 10) << "Multiplication past the maximum should saturate.";
+    EXPECT_EQ((bounded % 4).value(), 2) << "Remainder should be exact within bounds.";
+    EXPECT_EQ((-bounded).value(), -6) << "Negation should be exact within bounds.";
+    EXPECT_EQ(bounded--.value(), 6) << "Postfix decrement should return the prior value.";
+    EXPECT_EQ(bounded.value(), 5) << "Postfix decrement should decrement.";
+    EXPECT_EQ((++bounded).value(), 6) << "Prefix increment should return the new value.";
+  }
+  
+  TEST(FixedWidthTests, NaturalArithmetic)
+  {
+    ClampedUInt8 num(200);
+    num *= 2;
+    EXPECT_EQ(num.value(), 255) << "Multiplication past the type maximum should saturate.";
+    num -= 100;
+    EXPECT_EQ(num.value(), 155) << "Subtraction should be exact within bounds.";
+    EXPECT_EQ((num - uint8_t(200)).value(), 0) << "Subtraction past zero should saturate.";
+    
+    ClampedUInt64 wide(std::numeric_limits<uint64_t>::max() - 1);
+    wide++;
+    wide++;
+    EXPECT_EQ(wide.value(), std::numeric_limits<uint64_t>::max()) << "Increment past the type maximum should saturate.";
+  }
+  
+  TEST(CheckedTests, IntegerReactions)
+  {
+    ClampedInt32 num(5, -10, 10);
+    ClampResult<int32_t> result = num.addChecked(5);
+    EXPECT_EQ(result.value, 10) << "Checked addition should report the new value.";
+    EXPECT_EQ(result.reaction, ClampReaction::NONE) << "A result exactly at the bound was not clamped.";
+    result = num.addChecked(1);
+    EXPECT_EQ(result.reaction, ClampReaction::MAXIMUM) << "Checked addition past the maximum should saturate.";
+    EXPECT_TRUE(result.saturated()) << "A saturating result should report as saturated.";
+    EXPECT_EQ(num.multiplyChecked(-2).reaction, ClampReaction::MINIMUM) << "Checked multiplication should saturate.";
+    EXPECT_EQ(num.value(), -10) << "Checked operations should modify the number.";
+    EXPECT_EQ(num.subtractChecked(-4).value, -6) << "Checked subtraction should be exact within bounds.";
+    EXPECT_EQ(num.divideChecked(0).reaction, ClampReaction::MINIMUM) << "Division of a negative by zero should saturate.";
+    EXPECT_EQ(num.moduloChecked(3).value, -1) << "Checked remainder should be exact within bounds.";
+  }
+  
+  TEST(CheckedTests, NaturalAndDecimalReactions)
+  {
+    ClampedUInt16 natural(100, 50, 200);
+    EXPECT_EQ(natural.subtractChecked(60).reaction, ClampReaction::MINIMUM) << "Checked subtraction should saturate.";
+    EXPECT_EQ(natural.value(), 50) << "Checked subtraction should leave the minimum.";
+    EXPECT_EQ(natural.moduloChecked(7).reaction, ClampReaction::MINIMUM) << "A remainder of 1 within [50, 200] should clamp to 50.";
+    
+    ClampedDouble decimal(0.5, -1.0, 1.0);
+    const ClampResult<double> result = decimal.divideChecked(0.25);
+    EXPECT_EQ(result.value, 1.0) << "Checked decimal division should saturate at the maximum.";
+    EXPECT_EQ(result.reaction, ClampReaction::MAXIMUM) << "Checked decimal division should report saturation.";
+  }
+  
+  TEST(FusedTests, ClampOncePerExpression)
+  {
+    const ClampedInt32 num(10, 0, 50);
+    EXPECT_EQ(multiplyAdd(num, 10, -60).value(), 40) << "A fused expression should clamp only its result.";
+    EXPECT_EQ(multiplyAdd<ClampPolicy::EVERY_STEP>(num, 10, -60).value(), 0)
+        << "Clamping at every step should match the operators.";
+    EXPECT_EQ(multiplyAdd(num, 3, 100).value(), 50) << "A fused result past the maximum should saturate.";
+    EXPECT_EQ(multiplyAddDivide(num, 10, 0, 4).value(), 25) << "A fused quotient should clamp only its result.";
+    EXPECT_EQ(multiplyAddDivide<ClampPolicy::EVERY_STEP>(num, 10, 0, 4).value(), 12)
+        << "Clamping at every step should match the operators.";
+    EXPECT_EQ(multiplyAddDivide(num, -1, 0, 0).value(), 0) << "Fused division of a negative by zero should saturate.";
+    EXPECT_EQ(multiplyAdd(num, 2, 1).maxValue(), 50) << "Fused operations should keep the original's bounds.";
+  }
+  
+  TEST(FusedTests, EveryFamily)
+  {
+    const ClampedUInt8 natural(200, 0, 250);
+    EXPECT_EQ(multiplyAddDivide(natural, uint8_t(200), uint8_t(0), uint8_t(250)).value(), 160)
+        << "Natural intermediates should be held exactly in a wider type.";
+    
+    const ClampedInt64 wide(std::numeric_limits<int64_t>::max(), 0, std::numeric_limits<int64_t>::max());
+    const bool exact = sizeof(detail::FusedIntermediate<int64_t>::type) > sizeof(int64_t);
+    EXPECT_EQ(multiplyAdd(wide, int64_t(2), int64_t(-10)).value(), std::numeric_limits<int64_t>::max() - (exact ? 0 : 10))
+        << "The widest integers should be exact in 128 bits, else saturate at their own limits in between.";
+    
+    const ClampedDouble decimal(10.0, 0.0, 50.0);
+    EXPECT_EQ(multiplyAdd(decimal, 10.0, -60.0).value(), 40.0) << "A fused decimal expression should clamp once.";
+    EXPECT_EQ(multiplyAdd<ClampPolicy::EVERY_STEP>(decimal, 10.0, -60.0).value(), 0.0)
+        << "Clamping decimals at every step should match the operators.";
+  }
+  
+  TEST(BasicNumberTests, Rebound)
+  {
+    std::vector<ClampedInteger<int16_t>> numbers;
+    for(int16_t i = 0; i < 10; ++i)
+      numbers.emplace_back(int16_t(i * 10), int16_t(0), int16_t(90));
+    
+    rebound(numbers.data(), numbers.size(), 20, 60);
+    EXPECT_EQ(numbers[1].minValue(), 10) << "Each minimum should stretch as through minValue().";
+    EXPECT_EQ(numbers[8].maxValue(), 80) << "Each maximum should stretch as through maxValue().";
+    EXPECT_EQ(numbers[8].value(), 80);
+    
+    rebound<ReboundPolicy::CLAMP>(numbers.data(), numbers.size(), 20, 60);
+    EXPECT_EQ(numbers[1].value(), 20) << "Values below the new bounds should be clamped up.";
+    EXPECT_EQ(numbers[8].value(), 60) << "Values above the new bounds should be clamped down.";
+    EXPECT_EQ(numbers[8].maxValue(), 60);
+    EXPECT_EQ(numbers[4].value(), 40);
+  }
+  
+  TEST(MixedTests, CrossWidthOperands)
+  {
+    const ClampedInt16 num(5, 0, 1000);
+    EXPECT_EQ((num + 70000).value(), 1000) << "A wide operand should saturate rather than wrap on narrowing.";
+    EXPECT_EQ((num - 70000).value(), 0);
+    EXPECT_EQ((num * (int64_t(1) << 40)).value(), 1000);
+    EXPECT_EQ((num / 2L).value(), 2);
+    EXPECT_EQ((num % 3LL).value(), 2);
+    EXPECT_EQ((num + 70000).maxValue(), 1000) << "Mixed results should keep the left operand's bounds.";
+    
+    const ClampedUInt8 natural(10, 0, 200);
+    EXPECT_EQ((natural - (-5)).value(), 15) << "A negative operand should not convert to a large natural.";
+    EXPECT_EQ((natural + -20).value(), 0);
+    
+    const ClampedInt32 wide(std::numeric_limits<int32_t>::max() - 1);
+    EXPECT_EQ((wide + int64_t(5)).value(), std::numeric_limits<int32_t>::max())
+        << "A wider operand should saturate without any intermediate wider than itself.";
+    EXPECT_EQ((wide * std::numeric_limits<int64_t>::max()).value(), std::numeric_limits<int32_t>::max());
+    EXPECT_EQ((wide * std::numeric_limits<int64_t>::min()).value(), std::numeric_limits<int32_t>::min());
+    EXPECT_EQ((ClampedUInt32(3) - std::numeric_limits<int64_t>::max()).value(), 0u);
+    
+# ifdef CLAMPED_HAS_INT128
+    const ClampedInt64 widest(std::numeric_limits<int64_t>::max() - 1);
+    EXPECT_EQ((widest + uint64_t(5)).value(), std::numeric_limits<int64_t>::max())
+        << "Operands holding values a type lacks should still saturate.";
+# else
+    static_assert(std::is_void<detail::MixedIntermediate<int64_t, uint64_t>::type>::value,
+        "Without 128-bit integers, no intermediate holds both int64_t and uint64_t.");
+# endif
+    EXPECT_EQ((ClampedInt32(-4) * uint8_t(3)).value(), -12) << "A narrower operand should convert losslessly.";
+    
+    const ClampedFloat decimal(1.5f, -10.0f, 10.0f);
+    EXPECT_EQ((decimal + 2).value(), 3.5f);
+    EXPECT_EQ((decimal * 1e300).value(), 10.0f) << "A double beyond float's range should clamp, not overflow.";
+  }
+  
+  TEST(MixedTests, ClampedOperands)
+  {
+    const ClampedInt32 lhs(40, -100, 100);
+    const ClampedInt32 same(3, 0, 10);
+    const ClampedInt8 narrow(-7, -10, 10);
+    EXPECT_EQ((lhs + same).value(), 43) << "The right operand's bounds should be ignored.";
+    EXPECT_EQ((lhs % same).value(), 1);
+    EXPECT_EQ((lhs * narrow).value(), -100);
+    EXPECT_EQ((narrow - lhs).value(), -10) << "Results should take the left operand's type and bounds.";
+    EXPECT_EQ((narrow - lhs).minValue(), -10);
+    EXPECT_EQ((ClampedDouble(1.0, 0.0, 2.0) + ClampedFloat(0.25f, 0.0f, 1.0f)).value(), 1.25);
+  }
+  
+  // An integer which counts its copies, standing in for a heavy NumT
+  struct Copied
+  {
+    static int copies;
+    long long n;
+    
+    Copied(long long n = 0): n(n) {}
+    Copied(const Copied &other): n(other.n) { ++copies; }
+    Copied(Copied &&other) = default;
+    Copied & operator=(const Copied &other) { this->n = other.n; ++copies; return *this; }
+    Copied & operator=(Copied &&other) = default;
+    
+    Copied & operator+=(const Copied &other) { this->n += other.n; return *this; }
+    Copied & operator-=(const Copied &other) { this->n -= other.n; return *this; }
+    Copied & operator*=(const Copied &other) { this->n *= other.n; return *this; }
+    Copied & operator/=(const Copied &other) { this->n /= other.n; return *this; }
+    Copied & operator%=(const Copied &other) { this->n %= other.n; return *this; }
+    Copied operator+(const Copied &other) const { return this->n + other.n; }
+    Copied operator-(const Copied &other) const { return this->n - other.n; }
+    Copied operator*(const Copied &other) const { return this->n * other.n; }
+    Copied operator/(const Copied &other) const { return this->n / other.n; }
+    Copied operator%(const Copied &other) const { return this->n % other.n; }
+    Copied operator-() const { return -this->n; }
+    
+    bool operator==(const Copied &other) const { return this->n == other.n; }
+    bool operator!=(const Copied &other) const { return this->n != other.n; }
+    bool operator<(const Copied &other) const { return this->n < other.n; }
+    bool operator<=(const Copied &other) const { return this->n <= other.n; }
+    bool operator>(const Copied &other) const { return this->n > other.n; }
+    bool operator>=(const Copied &other) const { return this->n >= other.n; }
+    explicit operator bool() const { return this->n != 0; }
+  };
+  
+  int Copied::copies = 0;
+  
+  static_assert(std::is_same<detail::ArgumentType<int32_t>, const int32_t>::value,
+      "Cheap operands should be passed by value.");
+  static_assert(std::is_same<detail::ArgumentType<Copied>, const Copied &>::value,
+      "Operands with a nontrivial copy should be passed by reference.");
+  static_assert(std::is_nothrow_move_constructible<ClampedInteger<Copied>>::value,
+      "Clamped numbers should be movable despite their virtual destructors.");
+  
+  TEST(BasicNumberTests, OperatorsMoveTemporaries)
+  {
+    const ClampedInteger<Copied> num(Copied(5), Copied(0), Copied(100));
+    const Copied a(3), b(4);
+    Copied::copies = 0;
+    ClampedInteger<Copied> sum = num + a + b;
+    EXPECT_EQ(sum.value().n, 12);
+    EXPECT_EQ(Copied::copies, 3) << "A chain should copy its first number's value and bounds only once.";
+    
+    Copied::copies = 0;
+    ClampedInteger<Copied> moved(std::move(sum));
+    sum = std::move(moved);
+    EXPECT_EQ(Copied::copies, 0) << "Moves should steal the value and bounds.";
+    EXPECT_EQ(sum.value().n, 12);
+    EXPECT_EQ((sum - Copied(20)).value().n, 0);
+  }
+  
+  TEST(BasicNumberTests, ComparisonsReadValuesDirectly)
+  {
+    const ClampedInt32 less(3, 0, 10), more(7, 5, 100);
+    EXPECT_TRUE(less < more && less <= more && less != more);
+    EXPECT_TRUE(more > less && more >= less);
+    EXPECT_FALSE(more <= less || less >= more || less > more);
+    EXPECT_TRUE(less <= ClampedInt32(3, -5, 5) && less >= ClampedInt32(3, -5, 5)) << "Bounds should play no part.";
+    
+    const BasicClampedNumber<int32_t> &base = more;
+    EXPECT_TRUE(base > less) << "Comparisons through the base should agree.";
+    
+    ClampedDouble nan(0.0, -1.0, 1.0), one(1.0, -1.0, 1.0);
+    nan.value(std::numeric_limits<double>::quiet_NaN());
+    EXPECT_FALSE(nan < one || nan <= one || nan > one || nan >= one || nan == one)
+        << "Every ordered comparison with NaN should be false.";
+    EXPECT_FALSE(one < nan || one <= nan || one > nan || one >= nan);
+    EXPECT_TRUE(nan != one && one != nan) << "NaN should be unequal to every value.";
+  }
 }
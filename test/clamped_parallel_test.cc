@@ -0,0 +1,112 @@
+#include <cstdint>
+
+#include <atomic>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "clamped_array.hh"
+#include "clamped_parallel.hh"
+
+namespace
+{
+  using namespace clamped;
+  
+  TEST(ParallelTests, PoolRunsEveryTask)
+  {
+    parallel::Pool pool(3);
+    EXPECT_EQ(pool.threadCount(), 3u) << "The calling thread should count among the pool's threads.";
+    
+    for(int pass = 0; pass < 3; ++pass) {
+      std::vector<std::atomic<int>> runs(10);
+      for(std::atomic<int> &run : runs)
+        run.store(0);
+      
+      pool.run(runs.size(), [&](std::size_t task) { runs[task].fetch_add(1); });
+      for(std::size_t i = 0; i < runs.size(); ++i)
+        EXPECT_EQ(runs[i].load(), 1) << "Every task should run exactly once, in pass " << pass << " at task " << i;
+    }
+  }
+  
+  TEST(ParallelTests, MatchesArrayOperators)
+  {
+    std::mt19937 rng(19);
+    std::uniform_int_distribution<int32_t> dist(-5000, 5000);
+    const std::size_t count = 4 * parallel::minimumChunk + 37;
+    std::vector<int32_t> raw(count);
+    for(int32_t &value : raw)
+      value = dist(rng);
+    
+    parallel::Pool pool(4);
+    for(BoundsLayout layout : {BoundsLayout::SHARED, BoundsLayout::PER_LANE}) {
+      ClampedArray<int32_t> serial(count, 0, -3000, 3000, layout), split(count, 0, -3000, 3000, layout);
+      serial.assign(raw.data());
+      parallel::assign(split, raw.data(), pool);
+      
+      ((((serial += 700) *= 3) -= 1200) /= 0);
+      parallel::add(split, 700, pool);
+      parallel::multiply(split, 3, pool);
+      parallel::subtract(split, 1200, pool);
+      parallel::divide(split, 0, pool);
+      for(std::size_t i = 0; i < count; ++i)
+        ASSERT_EQ(split.value(i), serial.value(i)) << "Parallel operations should saturate as the array's own do, at "
+            << "index " << i;
+    }
+  }
+  
+  TEST(ParallelTests, ReboundClampsValues)
+  {
+    const std::size_t count = 3 * parallel::minimumChunk;
+    std::vector<int16_t> raw(count);
+    for(std::size_t i = 0; i < count; ++i)
+      raw[i] = int16_t(int(i % 2001) - 1000);
+    
+    parallel::Pool pool(4);
+    for(BoundsLayout layout : {BoundsLayout::SHARED, BoundsLayout::PER_LANE}) {
+      ClampedArray<int16_t> arr(count, 0, -1000, 1000, layout);
+      parallel::assign(arr, raw.data(), pool);
+      parallel::rebound(arr, int16_t(250), int16_t(-100), pool);
+      for(std::size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(arr.minValue(i), -100) << "Every element should take the new minimum, at index " << i;
+        ASSERT_EQ(arr.maxValue(i), 250) << "Every element should take the new maximum, at index " << i;
+        ASSERT_EQ(arr.value(i), (raw[i] < -100) ? -100 : (raw[i] > 250) ? 250 : raw[i])
+            << "Values should be clamped into the new bounds, at index " << i;
+      }
+    }
+  }
+  
+  TEST(ParallelTests, Reductions)
+  {
+    const std::size_t count = 5 * parallel::minimumChunk + 11;
+    std::vector<int8_t> raw(count, 100);
+    raw[count / 3] = -128;
+    raw[count - 1] = 127;
+    
+    parallel::Pool one(1), four(4);
+    ClampedArray<int8_t> arr(count, 0, -128, 127);
+    arr.assign(raw.data());
+    EXPECT_EQ(parallel::minimum(arr, four), -128) << "The least value of any chunk should be found.";
+    EXPECT_EQ(parallel::maximum(arr, four), 127) << "The greatest value of any chunk should be found.";
+    
+    const ClampResult<int8_t> clamped = parallel::sum(arr, int8_t(-128), int8_t(127), four);
+    EXPECT_EQ(clamped.value, 127) << "A sum past the maximum should saturate.";
+    EXPECT_EQ(clamped.reaction, ClampReaction::MAXIMUM);
+    
+    // Exact summation saturates only the total, and so recovers from the
+    // partial sums a step-by-step clamp would have pinned at a bound
+    std::vector<int32_t> swings(count, 0);
+    swings[0] = 2000000000;
+    swings[1] = 2000000000;
+    swings[count - 1] = -2000000000;
+    ClampedArray<int32_t> wide(count, 0, INT32_MIN, INT32_MAX);
+    wide.assign(swings.data());
+    const ClampResult<int32_t> exact = parallel::sum(wide, int32_t(INT32_MIN), int32_t(INT32_MAX), four);
+    EXPECT_EQ(exact.value, 2000000000) << "Each chunk should be summed exactly before clamping the total.";
+    EXPECT_EQ(exact.reaction, ClampReaction::NONE);
+    EXPECT_EQ(parallel::sum(wide, int32_t(INT32_MIN), int32_t(INT32_MAX), one).value, exact.value)
+        << "The sum should not depend on the number of threads.";
+    
+    ClampedArray<double> decimals(count, 0.5, 0.0, 1.0);
+    EXPECT_DOUBLE_EQ(parallel::sum(decimals, 0.0, 1e9, four).value, 0.5 * double(count));
+  }
+}
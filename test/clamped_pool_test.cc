@@ -0,0 +1,108 @@
+#include <cstdint>
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "clamped_numbers.hh"
+#include "clamped_numbers.inl"
+#include "clamped_pool.hh"
+
+namespace
+{
+  using namespace clamped;
+  
+  // A number which counts its destructions, standing in for a heavy NumT
+  struct Counted
+  {
+    static int destroyed;
+    int n;
+    
+    Counted(int n = 0): n(n) {}
+    Counted(const Counted &other) = default;
+    Counted & operator=(const Counted &other) = default;
+    ~Counted() { ++destroyed; }
+    
+    bool operator==(const Counted &other) const { return this->n == other.n; }
+    bool operator<(const Counted &other) const { return this->n < other.n; }
+    bool operator<=(const Counted &other) const { return this->n <= other.n; }
+    bool operator>=(const Counted &other) const { return this->n >= other.n; }
+    bool operator>(const Counted &other) const { return this->n > other.n; }
+  };
+  
+  int Counted::destroyed = 0;
+  
+  // A derived clamped type with a member needing destruction of its own
+  struct Labelled: public ClampedInteger<int32_t>
+  {
+    Counted label;
+    
+    Labelled(int32_t value, int32_t min, int32_t max): ClampedInteger<int32_t>(value, min, max) {}
+  };
+  
+  TEST(ClampedPoolTests, CreatesContiguousNumbers)
+  {
+    ClampedNumberPool<int32_t> pool(256);
+    std::vector<BasicClampedNumber<int32_t> *> numbers;
+    for(int i = 0; i < 1000; ++i)
+      numbers.push_back(pool.create<ClampedInteger<int32_t>>(i, 0, 500));
+    
+    EXPECT_EQ(pool.size(), 1000u);
+    EXPECT_LE(pool.blockCount(), 10u) << "Blocks should grow geometrically.";
+    EXPECT_EQ(reinterpret_cast<char *>(numbers[1]) - reinterpret_cast<char *>(numbers[0]),
+        std::ptrdiff_t(sizeof(ClampedInteger<int32_t>))) << "Consecutive numbers should lie side by side.";
+    
+    *static_cast<ClampedInteger<int32_t> *>(numbers[10]) += 1000;
+    EXPECT_EQ(numbers[10]->value(), 500) << "Pooled numbers should saturate as any other.";
+    EXPECT_EQ(numbers[999]->value(), 999) << "Bounds should stretch to fit the starting value as usual.";
+    
+    pool.release();
+    EXPECT_EQ(pool.size(), 0u);
+    EXPECT_EQ(pool.blockCount(), 0u) << "Release should return every block.";
+    EXPECT_EQ(pool.create<ClampedNaturalNumber<int32_t>>(3, 0, 5)->value(), 3) << "A released pool is reusable.";
+  }
+  
+  TEST(ClampedPoolTests, DestroysOnlyWhereNeeded)
+  {
+    {
+      ClampedNumberPool<Counted> pool;
+      for(int i = 0; i < 10; ++i)
+        pool.create<BasicClampedNumber<Counted>>(Counted(i), Counted(0), Counted(20));
+      
+      Counted::destroyed = 0;
+      pool.release();
+      EXPECT_EQ(Counted::destroyed, 30) << "Each number's value and bounds should be destroyed on release.";
+    }
+    
+    EXPECT_EQ(Counted::destroyed, 30) << "A released pool has nothing left to destroy.";
+    
+    {
+      ClampedNumberPool<int32_t> pool;
+      for(int i = 0; i < 10; ++i)
+        pool.create<Labelled>(i, 0, 20);
+      
+      pool.create<ClampedInteger<int32_t>>(0, 0, 20);
+      Counted::destroyed = 0;
+    }
+    
+    EXPECT_EQ(Counted::destroyed, 10) << "Derived types over a trivial NumT should still be destroyed.";
+  }
+  
+  TEST(ClampedPoolTests, AllocatorFactories)
+  {
+    std::allocator<char> alloc;
+    ClampedDouble *number = allocateClamped<ClampedDouble>(alloc, 0.5, 0.0, 1.0);
+    *number *= 4.0;
+    EXPECT_EQ(number->value(), 1.0);
+    deallocateClamped(alloc, number);
+    
+#   ifdef CLAMPED_HAS_PMR
+    ClampedNumberPool<double> pool;
+    std::pmr::polymorphic_allocator<char> pooled(&pool);
+    ClampedDouble *inPool = allocateClamped<ClampedDouble>(pooled, 0.25, 0.0, 1.0);
+    EXPECT_EQ(inPool->value(), 0.25);
+    deallocateClamped(pooled, inPool);
+    EXPECT_EQ(pool.blockCount(), 1u) << "A pool should serve polymorphic allocators from its blocks.";
+#   endif
+  }
+}
@@ -0,0 +1,138 @@
+#include <cstdint>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "clamped_array.hh"
+#include "clamped_reduce.hh"
+#include "flat_clamped_numbers.hh"
+
+namespace
+{
+  using namespace clamped;
+  
+  TEST(ReduceTests, IntegerSums)
+  {
+    std::mt19937 rng(24);
+    std::uniform_int_distribution<int32_t> dist(INT32_MIN, INT32_MAX);
+    std::vector<int32_t> values(10007);
+    for(int32_t &value : values)
+      value = dist(rng);
+    
+    int64_t exact = 0;
+    flat::ClampedInt32 stepped(0, -1000000000, 1000000000);
+    for(int32_t value : values) {
+      exact += value;
+      stepped += value;
+    }
+    
+    const int32_t clampedExact = int32_t((exact < INT32_MIN) ? INT32_MIN : (exact > INT32_MAX) ? INT32_MAX : exact);
+    const ClampResult<int32_t> atEnd = reduce::sum(values.data(), values.size(), INT32_MIN, INT32_MAX);
+    EXPECT_EQ(atEnd.value, clampedExact) << "A sum clamped at the end should match the exact sum.";
+    EXPECT_EQ(reduce::sum<ClampPolicy::EVERY_STEP>(values.data(), values.size(), -1000000000, 1000000000).value,
+        stepped.value()) << "A sum clamped at every step should match a clamped number's operators.";
+    
+    ClampedArray<int32_t> array(values.size(), 0, INT32_MIN, INT32_MAX);
+    array.assign(values.data());
+    EXPECT_EQ(reduce::sum(array, INT32_MIN, INT32_MAX).value, clampedExact);
+    
+    const uint8_t bytes[] = {200, 200, 200, 3};
+    const ClampResult<uint8_t> saturated = reduce::sum(bytes, 4, uint8_t(0), uint8_t(255));
+    EXPECT_EQ(saturated.value, 255) << "A sum past the maximum should saturate.";
+    EXPECT_EQ(saturated.reaction, ClampReaction::MAXIMUM);
+    EXPECT_EQ(reduce::sum(bytes, 0, uint8_t(5), uint8_t(10)).value, 5) << "An empty sum is zero, clamped.";
+  }
+  
+  TEST(ReduceTests, ProductsAndDots)
+  {
+    const int16_t factors[] = {300, -300, 2, 0, 7};
+    EXPECT_EQ(reduce::product(factors, 3, INT16_MIN, INT16_MAX).value, INT16_MIN)
+        << "A negative product past the minimum should saturate.";
+    EXPECT_EQ(reduce::product(factors, 5, INT16_MIN, INT16_MAX).value, 0)
+        << "A zero factor should cancel any earlier saturation under AT_END.";
+    EXPECT_EQ(reduce::product<ClampPolicy::EVERY_STEP>(factors, 3, int16_t(-1000), int16_t(1000)).value, -1000)
+        << "A product clamped at every step should saturate as the operators do.";
+    
+    std::vector<int32_t> a(4096, INT32_MAX), b(4096, INT32_MAX);
+    b[4095] = INT32_MIN;
+    int64_t expected = 0;
+    for(std::size_t i = 0; i < 100; ++i) {
+      a[i] = int32_t(i) - 50;
+      b[i] = 3 * int32_t(i);
+      expected += int64_t(a[i]) * b[i];
+    }
+    
+    EXPECT_EQ(reduce::dot(a.data(), b.data(), 100, INT32_MIN, INT32_MAX).value, expected);
+    EXPECT_EQ(reduce::dot(a.data(), b.data(), a.size(), INT32_MIN, INT32_MAX).value, INT32_MAX)
+        << "Products too large even for 64 bits should accumulate exactly, then saturate.";
+    
+    flat::ClampedInt32 stepped(0, -2000, 2000);
+    for(std::size_t i = 0; i < 100; ++i) {
+      flat::ClampedInt32 term(0, -2000, 2000);
+      term.value((int64_t(a[i]) * b[i] < -2000) ? -2000 : (int64_t(a[i]) * b[i] > 2000) ? 2000 : a[i] * b[i]);
+      stepped += term.value();
+    }
+    
+    EXPECT_EQ(reduce::dot<ClampPolicy::EVERY_STEP>(a.data(), b.data(), 100, -2000, 2000).value, stepped.value())
+        << "A dot product clamped at every step should clamp each product, then each partial sum.";
+    
+#   ifdef CLAMPED_HAS_INT128
+    const int64_t huge[] = {INT64_MAX, INT64_MAX, -INT64_MAX};
+    const int64_t ones[] = {INT64_MAX, INT64_MAX, INT64_MAX};
+    EXPECT_EQ(reduce::dot(huge, ones, 3, INT64_MIN, INT64_MAX).value, INT64_MAX);
+    EXPECT_EQ(reduce::dot(huge, ones, 3, INT64_MIN, INT64_MAX).reaction, ClampReaction::MAXIMUM);
+    const int64_t small[] = {INT64_MAX, 1, -INT64_MAX};
+    EXPECT_EQ(reduce::dot(small, small, 3, INT64_MIN, INT64_MAX).value, INT64_MAX)
+        << "64-bit products should be formed exactly in 128 bits.";
+    EXPECT_EQ(reduce::dot(small, ones, 3, INT64_MIN, INT64_MAX).value, INT64_MAX);
+#   endif
+  }
+  
+  TEST(ReduceTests, DecimalsSumPairwise)
+  {
+    const std::size_t count = 1000003;
+    std::vector<float> tenths(count, 0.1f);
+    float naive = 0.0f;
+    for(float value : tenths)
+      naive += value;
+    
+    const double exact = double(0.1f) * double(count);
+    const float pairwise = reduce::sum(tenths.data(), count, 0.0f, 1e9f).value;
+    EXPECT_NEAR(pairwise, exact, exact * 1e-7) << "A pairwise float sum should round only once.";
+    EXPECT_GT(std::fabs(naive - exact), 100.0 * std::fabs(pairwise - exact)) << "A naive float sum should drift.";
+    
+    std::mt19937 rng(240);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> a(5000), b(5000);
+    long double oracle = 0.0L;
+    for(std::size_t i = 0; i < a.size(); ++i) {
+      a[i] = dist(rng);
+      b[i] = dist(rng);
+      oracle += (long double)(a[i]) * b[i];
+    }
+    
+    EXPECT_NEAR(reduce::dot(a.data(), b.data(), a.size(), -1e9, 1e9).value, double(oracle), 1e-10);
+    EXPECT_EQ(reduce::dot(a.data(), a.data(), a.size(), 0.0, 10.0).value, 10.0)
+        << "A decimal dot product past the maximum should saturate.";
+    EXPECT_DOUBLE_EQ(reduce::product<ClampPolicy::EVERY_STEP>(a.data(), 3, -1.0, 1.0).value, a[0] * a[1] * a[2]);
+  }
+  
+  TEST(ReduceTests, MinimumAndMaximum)
+  {
+    std::vector<int8_t> bytes(203, 5);
+    bytes[101] = -100;
+    bytes[202] = 120;
+    EXPECT_EQ(reduce::minimum(bytes.data(), bytes.size()), -100);
+    EXPECT_EQ(reduce::maximum(bytes.data(), bytes.size()), 120) << "Values past the last full lane should be read.";
+    EXPECT_EQ(reduce::maximum(bytes.data(), 3), 5) << "Arrays shorter than one lane should be read.";
+    
+    ClampedArray<float> reals(77, 0.5f, -10.0f, 10.0f);
+    reals[13].value(-3.0f);
+    reals[64].value(9.5f);
+    EXPECT_EQ(reduce::minimum(reals), -3.0f);
+    EXPECT_EQ(reduce::maximum(reals), 9.5f);
+  }
+}
@@ -0,0 +1,144 @@
+#include <cstdint>
+#include <cstring>
+
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "clamped_serialization.hh"
+
+namespace
+{
+  using namespace clamped;
+  using serial::ReadStatus;
+  
+  template<typename NumT>
+  std::vector<uint64_t> serializeArray(const ClampedArray<NumT> &array)
+  {
+    // Words rather than bytes keep the buffer aligned for every element type
+    std::vector<uint64_t> buffer((serial::serializedSize(array) + 7) / 8);
+    EXPECT_EQ(serial::serialize(array, buffer.data()), serial::serializedSize(array))
+        << "Serialization should write exactly its reported size.";
+    return buffer;
+  }
+  
+  TEST(SerializationTests, SharedRoundTrip)
+  {
+    ClampedArray<int16_t> array(100, 0, -500, 500);
+    for(std::size_t i = 0; i < array.size(); ++i)
+      array[i].value(int16_t(i * 7 - 300));
+    
+    const std::vector<uint64_t> buffer = serializeArray(array);
+    EXPECT_EQ(buffer.size() * 8, serial::sectionAlignment * 5) << "Shared bounds should need only one section.";
+    
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(buffer.data());
+    EXPECT_EQ(std::memcmp(bytes, "CLMP", 4), 0) << "The buffer should start with the magic bytes.";
+    EXPECT_EQ(bytes[24] | (bytes[25] << 8), 0xFE0C) << "The shared minimum should be stored little-endian.";
+    
+    const ClampedArrayView<int16_t> view(buffer.data(), buffer.size() * 8);
+    ASSERT_EQ(view.status(), ReadStatus::OK) << "A freshly serialized array should be readable.";
+    EXPECT_EQ(view.size(), 100u) << "The view should hold every element.";
+    EXPECT_EQ(view.layout(), BoundsLayout::SHARED) << "The view should keep the array's layout.";
+    EXPECT_EQ(view.value(99), 393) << "The view should read values in place.";
+    EXPECT_EQ(view.minValue(42), -500) << "The view should read the shared minimum.";
+    EXPECT_EQ(view.values(), reinterpret_cast<const int16_t *>(bytes + 64)) << "The view should not copy.";
+    
+    ClampedArray<int16_t> copy = view.toArray();
+    EXPECT_EQ(copy.value(50), 50) << "Copying the view should keep every value.";
+    copy[50] += 1000;
+    EXPECT_EQ(copy.value(50), 500) << "The copy should keep the bounds.";
+  }
+  
+  TEST(SerializationTests, PerLaneRoundTrip)
+  {
+    ClampedArray<double> array(10, 0.0, -1.0, 1.0, BoundsLayout::PER_LANE);
+    for(std::size_t i = 0; i < array.size(); ++i) {
+      array[i].maxValue(double(i));
+      array[i].value(double(i) / 2);
+    }
+    
+    const std::vector<uint64_t> buffer = serializeArray(array);
+    const ClampedArrayView<double> view(buffer.data(), buffer.size() * 8);
+    ASSERT_EQ(view.status(), ReadStatus::OK) << "A per-lane array should be readable.";
+    EXPECT_EQ(view.value(9), 4.5) << "The view should read values in place.";
+    EXPECT_EQ(view.maxValue(9), 9.0) << "The view should read each element's own maximum.";
+    
+    const ClampedArray<double> copy = view.toArray();
+    EXPECT_EQ(copy.layout(), BoundsLayout::PER_LANE) << "The copy should keep the layout.";
+    EXPECT_EQ(copy.minValue(3), -1.0) << "The copy should keep each minimum.";
+    EXPECT_EQ(copy.maxValue(3), 3.0) << "The copy should keep each maximum.";
+    EXPECT_EQ(copy.value(3), 1.5) << "The copy should keep each value.";
+  }
+  
+  TEST(SerializationTests, StaticBuffers)
+  {
+    using Percent = StaticClamped<uint8_t, 0, 100>;
+    std::vector<Percent> numbers = {Percent(5), Percent(50), Percent(200)};
+    std::vector<uint64_t> buffer((serial::serializedSize(numbers.data(), numbers.size()) + 7) / 8);
+    serial::serialize(numbers.data(), numbers.size(), buffer.data());
+    
+    const ClampedArrayView<uint8_t> view(buffer.data(), buffer.size() * 8);
+    ASSERT_EQ(view.status(), ReadStatus::OK) << "A static buffer should be readable.";
+    EXPECT_EQ(view.maxValue(0), 100) << "The static bounds should be written into the header.";
+    
+    std::vector<Percent> restored(view.size());
+    EXPECT_EQ(serial::copyTo(view, restored.data(), restored.size()), ReadStatus::OK)
+        << "The buffer should be restorable.";
+    EXPECT_EQ(restored[2].value(), 100) << "Restoring should keep every value.";
+    EXPECT_EQ(serial::copyTo(view, restored.data(), restored.size() - 1), ReadStatus::TOO_SMALL)
+        << "Restoring into too small a buffer should be refused.";
+    
+    std::vector<StaticClamped<uint8_t, 10, 100>> narrower(view.size());
+    EXPECT_EQ(serial::copyTo(view, narrower.data(), narrower.size()), ReadStatus::OUT_OF_BOUNDS)
+        << "Restoring into narrower bounds should be refused.";
+  }
+  
+  TEST(SerializationTests, RejectsBadBuffers)
+  {
+    ClampedArray<int32_t> array(16, 7, 0, 10);
+    std::vector<uint64_t> buffer = serializeArray(array);
+    const std::size_t size = buffer.size() * 8;
+    unsigned char *bytes = reinterpret_cast<unsigned char *>(buffer.data());
+    
+    EXPECT_EQ(ClampedArrayView<int32_t>(bytes, 32).status(), ReadStatus::TRUNCATED) << "A short header should fail.";
+    EXPECT_EQ(ClampedArrayView<int32_t>(bytes, 100).status(), ReadStatus::TRUNCATED) << "Short sections should fail.";
+    EXPECT_EQ(ClampedArrayView<uint32_t>(bytes, size).status(), ReadStatus::BAD_TYPE) << "The type should be checked.";
+    EXPECT_EQ(ClampedArrayView<int16_t>(bytes, size).status(), ReadStatus::BAD_TYPE) << "The width should be checked.";
+    
+    bytes[64 + 4 * 15] = 11;
+    EXPECT_EQ(ClampedArrayView<int32_t>(bytes, size).status(), ReadStatus::OUT_OF_BOUNDS)
+        << "A value beyond the bounds should be caught, even the last.";
+    bytes[64 + 4 * 15] = 7;
+    
+    bytes[16] = 0xFF;
+    EXPECT_EQ(ClampedArrayView<int32_t>(bytes, size).status(), ReadStatus::TRUNCATED)
+        << "A count larger than the buffer should fail.";
+    bytes[16] = 16;
+    
+    bytes[4] = 2;
+    EXPECT_EQ(ClampedArrayView<int32_t>(bytes, size).status(), ReadStatus::BAD_VERSION)
+        << "A newer version should be refused.";
+    bytes[4] = 1;
+    
+    bytes[0] = 'X';
+    EXPECT_EQ(ClampedArrayView<int32_t>(bytes, size).status(), ReadStatus::BAD_MAGIC) << "The magic should be checked.";
+    bytes[0] = 'C';
+    
+    std::vector<uint64_t> shifted(buffer.size() + 1);
+    unsigned char *misaligned = reinterpret_cast<unsigned char *>(shifted.data()) + 1;
+    std::memcpy(misaligned, bytes, size);
+    EXPECT_EQ(ClampedArrayView<int32_t>(misaligned, size).status(), ReadStatus::MISALIGNED)
+        << "A misaligned buffer cannot be viewed in place.";
+    EXPECT_EQ(ClampedArrayView<int32_t>(bytes, size).status(), ReadStatus::OK) << "The repaired buffer should read.";
+  }
+  
+  TEST(SerializationTests, RejectsNaN)
+  {
+    ClampedArray<float> array(4, 0.5f, 0.0f, 1.0f);
+    std::vector<uint64_t> buffer = serializeArray(array);
+    float *values = reinterpret_cast<float *>(reinterpret_cast<unsigned char *>(buffer.data()) + 64);
+    values[2] = std::numeric_limits<float>::quiet_NaN();
+    EXPECT_EQ(ClampedArrayView<float>(buffer.data(), buffer.size() * 8).status(), ReadStatus::OUT_OF_BOUNDS)
+        << "NaN lies within no bounds.";
+  }
+}
@@ -0,0 +1,92 @@
+#include <cstdint>
+
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "clamped_stats.hh"
+#include "clamped_numbers.hh"
+#include "flat_clamped_numbers.hh"
+#include "static_clamped.hh"
+#include "atomic_clamped.hh"
+
+namespace
+{
+  using namespace clamped;
+  using stats::Operation;
+  
+# ifdef CLAMPED_INSTRUMENTATION
+  int hookedMaxima = 0;
+  
+  void countMaxima(Operation op, stats::Reaction reaction)
+  {
+    if(op == Operation::MULTIPLY && reaction == stats::Reaction::MAXIMUM)
+      ++hookedMaxima;
+  }
+  
+  TEST(StatsTests, CountsPerOperation)
+  {
+    stats::reset<int16_t>();
+    ClampedInt16 num(0, -10, 10);
+    num += 5;
+    num += 50;
+    num -= 100;
+    num.value(3);
+    num.value(30);
+    
+    const stats::Tally adds = stats::tally<int16_t>(Operation::ADD);
+    EXPECT_EQ(adds.none, 1u) << "Additions within bounds should be counted as unclamped.";
+    EXPECT_EQ(adds.maximum, 1u) << "Additions past the maximum should be counted as saturating.";
+    EXPECT_EQ(stats::tally<int16_t>(Operation::SUBTRACT).minimum, 1u) << "Saturating subtraction was not counted.";
+    EXPECT_EQ(stats::tally<int16_t>(Operation::ASSIGN).total(), 2u) << "Assignments were not counted.";
+    EXPECT_EQ(stats::tally<int16_t>().total(), 5u) << "The type's tally should sum every operation.";
+  }
+  
+  TEST(StatsTests, SharedAcrossWrappers)
+  {
+    stats::reset<uint8_t>();
+    stats::reset<int8_t>();
+    flat::ClampedUInt8 flatNum(200);
+    flatNum *= 2;
+    StaticClamped<uint8_t, 0, 100> staticNum(50);
+    staticNum *= 3;
+    AtomicClampedNaturalNumber<uint8_t> atomicNum(250);
+    atomicNum += 10;
+    ClampedUInt8 polyNum(10);
+    polyNum /= 2;
+    
+    EXPECT_EQ(stats::tally<uint8_t>(Operation::MULTIPLY).maximum, 2u) << "Every wrapper should share its type's tally.";
+    EXPECT_EQ(stats::tally<uint8_t>(Operation::ADD).maximum, 1u) << "Atomic additions should be counted once.";
+    EXPECT_EQ(stats::tally<uint8_t>(Operation::DIVIDE).none, 1u) << "Polymorphic division was not counted.";
+    EXPECT_EQ(stats::tally<int8_t>().total(), 0u) << "Other types should keep separate tallies.";
+  }
+  
+  TEST(StatsTests, ThreadsAndHooks)
+  {
+    stats::reset<int32_t>();
+    std::thread worker([]() {
+      flat::ClampedInt32 num(0, 0, 100);
+      for(int i = 0; i < 1000; ++i)
+        num -= 1;
+    });
+    worker.join();
+    EXPECT_EQ(stats::tally<int32_t>(Operation::SUBTRACT).minimum, 1000u) << "Exited threads' counts should be kept.";
+    
+    hookedMaxima = 0;
+    stats::setHook<int32_t>(&countMaxima);
+    flat::ClampedInt32 num(50, 0, 100);
+    num *= 3;
+    num *= 0;
+    stats::setHook<int32_t>(nullptr);
+    num *= 300;
+    EXPECT_EQ(hookedMaxima, 1) << "The hook should see exactly the reactions recorded while installed.";
+  }
+# else
+  TEST(StatsTests, DisabledRecordsNothing)
+  {
+    EXPECT_FALSE(stats::enabled) << "Instrumentation should be disabled without CLAMPED_INSTRUMENTATION.";
+    ClampedInt32 num(0, -1, 1);
+    num += 5;
+    EXPECT_EQ(stats::tally<int32_t>().total(), 0u) << "No reactions should be recorded when disabled.";
+  }
+# endif
+}
@@ -0,0 +1,94 @@
+#include <cstdint>
+
+#include <deque>
+#include <numeric>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "clamped_numbers.hh"
+#include "clamped_stream.hh"
+
+namespace
+{
+  using namespace clamped;
+  
+  TEST(StreamTests, MatchesClampedDecimal)
+  {
+    stream::Clamper<double> clamper(0.0, 100.0);
+    clamper.multiply(0.5).add(10.0).divide(0.0);
+    EXPECT_EQ(clamper.stepCount(), 3u) << "Every appended operation should be kept.";
+    
+    std::vector<double> chunk = {-50.0, 0.0, 25.0, 150.0, 99.0};
+    const std::vector<double> raw = chunk;
+    clamper.process(chunk.data(), chunk.size());
+    for(std::size_t i = 0; i < raw.size(); ++i) {
+      ClampedDouble expected(0.0, 0.0, 100.0);
+      expected.value(raw[i]);
+      ((expected *= 0.5) += 10.0) /= 0.0;
+      EXPECT_EQ(chunk[i], expected.value()) << "The stage should saturate as ClampedDecimal does, at index " << i;
+    }
+  }
+  
+  TEST(StreamTests, RunningStatistics)
+  {
+    stream::Clamper<int16_t> clamper(-100, 100);
+    clamper.multiply(3);
+    
+    std::vector<int16_t> chunk = {-200, -10, 0, 10, 50, 300};
+    clamper.process(chunk.data(), chunk.data() + chunk.size());
+    EXPECT_EQ(chunk, (std::vector<int16_t>{-100, -30, 0, 30, 100, 100})) << "Each value should be clamped, then scaled.";
+    clamper.process(chunk.data(), 2);
+    
+    const stream::Statistics &statistics = clamper.statistics();
+    EXPECT_EQ(statistics.chunks, 2u) << "Every chunk should be counted.";
+    EXPECT_EQ(statistics.elements, 8u) << "Every value should be counted.";
+    EXPECT_EQ(statistics.input.minimum, 1u) << "Raw values below the minimum should be counted.";
+    EXPECT_EQ(statistics.input.maximum, 1u) << "Raw values above the maximum should be counted.";
+    EXPECT_EQ(statistics.input.none, 6u) << "Raw values within bounds should be counted.";
+    EXPECT_EQ(statistics.output.minimum, 2u) << "Outputs at the minimum should be counted.";
+    EXPECT_EQ(statistics.output.maximum, 2u) << "Outputs at the maximum should be counted.";
+    
+    clamper.resetStatistics();
+    EXPECT_EQ(clamper.statistics().elements, 0u) << "Resetting should discard the statistics.";
+  }
+  
+  TEST(StreamTests, IteratorRanges)
+  {
+    stream::Clamper<int32_t> clamper(0, 1000);
+    clamper.add(900).subtract(50);
+    
+    std::deque<int32_t> values = {-5, 20, 500};
+    std::vector<int32_t> chunk(values.begin(), values.end());
+    clamper.process(values.begin(), values.end());
+    clamper.process(chunk.data(), chunk.size());
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), chunk.begin()))
+        << "Element-wise processing should match chunked processing.";
+    EXPECT_EQ(values[2], 950) << "Saturation should apply at every step.";
+  }
+  
+  TEST(StreamTests, DoubleBufferedPump)
+  {
+    stream::Clamper<int32_t> clamper(0, 1000);
+    clamper.multiply(2);
+    
+    const int32_t total = 10007;
+    int32_t next = 0;
+    std::vector<int32_t> output;
+    const uint64_t streamed = stream::pump(clamper, 64,
+        [&](int32_t *buffer, std::size_t capacity) {
+          std::size_t count = 0;
+          for(; count < capacity && next < total; ++count)
+            buffer[count] = next++;
+          return count;
+        },
+        [&](const int32_t *buffer, std::size_t count) {
+          output.insert(output.end(), buffer, buffer + count);
+        });
+    
+    EXPECT_EQ(streamed, uint64_t(total)) << "Every value should be streamed.";
+    ASSERT_EQ(output.size(), std::size_t(total)) << "Every value should be written.";
+    for(int32_t i = 0; i < total; ++i)
+      ASSERT_EQ(output[i], (i <= 500) ? 2 * i : 1000) << "Chunks should be written in order, at index " << i;
+    EXPECT_EQ(clamper.statistics().chunks, uint64_t((total + 63) / 64)) << "Each full or partial chunk should count.";
+  }
+}
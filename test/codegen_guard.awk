@@ -0,0 +1,82 @@
+# Checks the disassembly of codegen_guard.cc, as printed by
+# `objdump -d --no-show-raw-insn`, failing if any guard_* function calls
+# out, jumps to another function, or divides. Only x86 and AArch64 objects
+# are understood; the mnemonics of any other architecture are not known, so
+# the check is skipped there with a message rather than passed silently.
+
+# The file format objdump reports, e.g. "elf64-x86-64" or "elf64-littleaarch64"
+/file format / {
+  if($NF ~ /x86-64|i386/)
+    arch = "x86"
+  else if($NF ~ /aarch64/)
+    arch = "aarch64"
+  else {
+    print "codegen guard: skipped, as the mnemonics of " $NF " are not known"
+    skipped = 1
+    exit 0
+  }
+  next
+}
+
+# The header of each function's disassembly, e.g. "0000000000000040 <guard_int32_add>:"
+/^[0-9a-f]+ <.*>:$/ {
+  name = $2
+  gsub(/[<>:]/, "", name)
+  if(name ~ /^guard_/)
+    ++guards
+  else
+    name = ""
+  next
+}
+
+# Instructions, e.g. "  40:	add    %esi,%eax" on x86, where spaces part the
+# operands from the mnemonic, or "  40:	add	w0, w0, w1" on AArch64, where a
+# tab does
+name != "" && /^ +[0-9a-f]+:\t/ {
+  split($0, fields, "\t")
+  instruction = fields[2] (fields[3] != "" ? " " fields[3] : "")
+  mnemonic = fields[2]
+  sub(/ .*/, "", mnemonic)
+  local = instruction ~ ("<" name "(\\+0x[0-9a-f]+)?>")
+
+  if(arch == "x86") {
+    calls = mnemonic ~ /^call/
+    jumps = mnemonic ~ /^jmp/ && !local
+    divides = mnemonic ~ /^i?div/ || mnemonic ~ /^v?div[sp][sd]$/
+  }
+  else {
+    calls = mnemonic ~ /^blr?$/
+    jumps = (mnemonic ~ /^b(\..*)?$/ && !local) || mnemonic == "br"
+    divides = mnemonic ~ /^[suf]div$/
+  }
+
+  if(calls) {
+    print "codegen guard: " name " makes a call: " instruction
+    ++failures
+  }
+  else if(jumps) {
+    print "codegen guard: " name " jumps out: " instruction
+    ++failures
+  }
+  else if(divides) {
+    print "codegen guard: " name " divides: " instruction
+    ++failures
+  }
+}
+
+END {
+  if(skipped)
+    exit 0
+  if(arch == "") {
+    print "codegen guard: no file format found in the disassembly"
+    exit 1
+  }
+  if(guards == 0) {
+    print "codegen guard: no guard_* functions found"
+    exit 1
+  }
+  if(failures > 0)
+    exit 1
+
+  print "codegen guard: " guards " functions inline, call-free and division-free"
+}
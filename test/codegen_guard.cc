@@ -0,0 +1,158 @@
+// Codegen guards for the hot operators, compiled on their own at -O2 by
+// `make -C release codegen` and checked by codegen_guard.awk: every function
+// named guard_* must compile to code which calls nothing, jumps to no other
+// function, and executes no division instruction. Layout guarantees are
+// checked at compile time below, so that a hidden member or a lost
+// trivially-copyable type fails the build rather than some later benchmark.
+//
+// Add a guard_* function here for any operator which must stay inlined and
+// division-free; leave out those, such as operator/=, which divide by design.
+
+#ifndef CLAMPED_HEADER_ONLY
+#define CLAMPED_HEADER_ONLY
+#endif
+
+#include <cstdint>
+
+#include <type_traits>
+
+#include "clamped_numbers.hh"
+#include "fixed_clamped.hh"
+#include "flat_clamped_numbers.hh"
+#include "packed_clamped.hh"
+#include "static_clamped.hh"
+
+namespace
+{
+  using namespace clamped;
+  
+  // The size of a polymorphic number: its vtable pointer and its fields, padded
+  template<typename NumT>
+  constexpr std::size_t polymorphicSize()
+  {
+    return (sizeof(void *) + 3 * sizeof(NumT) + alignof(void *) - 1) / alignof(void *) * alignof(void *);
+  }
+  
+  static_assert(sizeof(ClampedInteger<int32_t>) == polymorphicSize<int32_t>(),
+      "ClampedInteger must hold nothing beyond its vtable pointer, value and bounds");
+  static_assert(sizeof(ClampedDecimal<double>) == polymorphicSize<double>(),
+      "ClampedDecimal must hold nothing beyond its vtable pointer, value and bounds");
+  static_assert(sizeof(flat::ClampedInteger<int32_t>) == 3 * sizeof(int32_t),
+      "flat::ClampedInteger must hold nothing beyond its value and bounds");
+  static_assert(std::is_trivially_copyable<flat::ClampedInteger<int32_t>>::value,
+      "flat::ClampedInteger must be trivially copyable");
+  static_assert(sizeof(StaticClamped<int32_t, -1000, 1000>) == sizeof(int32_t),
+      "StaticClamped must hold nothing beyond its value");
+  static_assert(std::is_trivially_copyable<StaticClamped<int32_t, -1000, 1000>>::value,
+      "StaticClamped must be trivially copyable");
+  static_assert(sizeof(ClampedSmall<int32_t, 0, 255>) == 1,
+      "ClampedSmall must hold only its offset, in the narrowest type which fits");
+  static_assert(std::is_trivially_copyable<ClampedSmall<int32_t, 0, 255>>::value,
+      "ClampedSmall must be trivially copyable");
+}
+
+extern "C"
+{
+  // Polymorphic operators are virtual, and inline only where the dynamic type
+  // is known, as for numbers held by value; through a reference the compiler
+  // may still inline them behind a check of the vtable, with a call beyond it
+  ClampedInteger<int32_t> guard_int32_add(ClampedInteger<int32_t> number, int32_t other)
+  {
+    number += other;
+    return number;
+  }
+  
+  ClampedInteger<int32_t> guard_int32_subtract(ClampedInteger<int32_t> number, int32_t other)
+  {
+    number -= other;
+    return number;
+  }
+  
+  ClampedInteger<int32_t> guard_int32_multiply(ClampedInteger<int32_t> number, int32_t other)
+  {
+    number *= other;
+    return number;
+  }
+  
+  int32_t guard_int32_assign(ClampedInteger<int32_t> &number, int32_t newVal)
+  {
+    return number.value(newVal);
+  }
+  
+  bool guard_int32_less(ClampedInteger<int32_t> lhs, ClampedInteger<int32_t> rhs)
+  {
+    return lhs < rhs;
+  }
+  
+  bool guard_int32_equal(ClampedInteger<int32_t> lhs, ClampedInteger<int32_t> rhs)
+  {
+    return lhs == rhs;
+  }
+  
+  ClampedNaturalNumber<uint32_t> guard_uint32_add(ClampedNaturalNumber<uint32_t> number, uint32_t other)
+  {
+    number += other;
+    return number;
+  }
+  
+  ClampedInteger<int64_t> guard_int64_multiply(ClampedInteger<int64_t> number, int64_t other)
+  {
+    number *= other;
+    return number;
+  }
+  
+  // Fixed-point products rescale by a power of two, and so must not divide
+  ClampedQ16_16 guard_fixed_q16_add(ClampedQ16_16 number, int32_t other)
+  {
+    number += other;
+    return number;
+  }
+  
+  ClampedQ16_16 guard_fixed_q16_multiply(ClampedQ16_16 number, int32_t other)
+  {
+    number *= other;
+    return number;
+  }
+  
+  // The exact decimal kernels delegate between one another, and so are not
+  // guarded; the fast ones must compute and clamp in straight-line code
+  void guard_fast_double_add(double &value, double other, double min, double max)
+  {
+    detail::FastDecimalKernels<double, NanPolicy::KEEP>::add(value, other, min, max);
+  }
+  
+  void guard_fast_double_multiply(double &value, double other, double min, double max)
+  {
+    detail::FastDecimalKernels<double, NanPolicy::KEEP>::multiply(value, other, min, max);
+  }
+  
+  void guard_flat_int32_add(flat::ClampedInteger<int32_t> &number, int32_t other)
+  {
+    number += other;
+  }
+  
+  void guard_flat_int32_multiply(flat::ClampedInteger<int32_t> &number, int32_t other)
+  {
+    number *= other;
+  }
+  
+  int32_t guard_flat_int32_assign(flat::ClampedInteger<int32_t> &number, int32_t newVal)
+  {
+    return number.value(newVal);
+  }
+  
+  bool guard_flat_int32_less(const flat::ClampedInteger<int32_t> &lhs, const flat::ClampedInteger<int32_t> &rhs)
+  {
+    return lhs < rhs;
+  }
+  
+  void guard_static_int32_add(StaticClamped<int32_t, -1000, 1000> &number, int32_t other)
+  {
+    number += other;
+  }
+  
+  void guard_small_int32_add(ClampedSmall<int32_t, 0, 255> &number, int32_t other)
+  {
+    number += other;
+  }
+}
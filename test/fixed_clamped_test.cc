@@ -0,0 +1,134 @@
+#include <cmath>
+#include <cstdint>
+
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "fixed_clamped.hh"
+
+namespace
+{
+  using namespace clamped;
+  
+  static_assert(ClampedQ16_16::one == 65536, "One should be 2^FracBits");
+  static_assert(ClampedQ15::one == INT16_MAX, "One should saturate where it is beyond IntT");
+  static_assert(std::is_same<decltype(ClampedQ16_16() * ClampedQ16_16()), ClampedQ16_16>::value,
+      "Products of fixed-point numbers should keep their type");
+  
+  // The exact result of a Q-format product or quotient of raw values, formed
+  // in int64_t, rounded toward zero, and clamped into [min, max]
+  template<unsigned FracBits>
+  int64_t referenceFixed(bool multiply, int64_t a, int64_t b, int64_t min, int64_t max)
+  {
+    int64_t exact = 0;
+    if(multiply)
+      exact = a * b / (int64_t(1) << FracBits);
+    else if(b != 0)
+      exact = a * (int64_t(1) << FracBits) / b;
+    else
+      exact = (a > 0) ? max : (a < 0) ? min : 0;
+    
+    return (exact < min) ? min : (exact > max) ? max : exact;
+  }
+  
+  TEST(FixedTests, QFormatArithmetic)
+  {
+    const int32_t one = ClampedQ16_16::one;
+    ClampedQ16_16 num(3 * one / 2, -4 * one, 4 * one);
+    EXPECT_EQ((num * (9 * one / 4)).value(), 27 * one / 8) << "1.5 times 2.25 should be exactly 3.375.";
+    EXPECT_EQ((num / (one / 2)).value(), 3 * one) << "1.5 over 0.5 should be exactly 3.";
+    EXPECT_EQ((num + one).value(), 5 * one / 2) << "Sums should be those of the raw values.";
+    EXPECT_EQ((num - 6 * one).value(), -4 * one) << "Differences should saturate at the minimum.";
+    EXPECT_EQ((num % one).value(), one / 2) << "Remainders should be those of the raw values.";
+    EXPECT_EQ((num * ClampedQ16_16(3 * one)).value(), 4 * one) << "Products should saturate at the maximum.";
+    
+    EXPECT_EQ(num.multiplyChecked(4 * one).reaction, ClampReaction::MAXIMUM);
+    EXPECT_EQ(num.value(), 4 * one);
+    EXPECT_EQ(num.divideChecked(-2 * one).reaction, ClampReaction::NONE);
+    EXPECT_EQ(num.value(), -2 * one);
+    EXPECT_EQ(num.divideChecked(0).reaction, ClampReaction::MINIMUM)
+        << "Division by zero should saturate toward the sign of the dividend.";
+    EXPECT_EQ((++num).value(), -3 * one) << "Incrementing should add one.";
+    
+    ClampedQ16_16 tiny(-1);
+    tiny *= 1;
+    EXPECT_EQ(tiny.value(), 0) << "Products should round toward zero.";
+    tiny.value(-7);
+    tiny /= 2 * one;
+    EXPECT_EQ(tiny.value(), -3) << "Quotients should round toward zero.";
+    
+    ClampedQ15 unit(INT16_MIN);
+    unit *= INT16_MIN;
+    EXPECT_EQ(unit.value(), INT16_MAX) << "-1 times -1 should saturate just below one.";
+    EXPECT_EQ((ClampedQ15(16384) * int16_t(16384)).value(), 8192) << "0.5 times 0.5 should be 0.25.";
+    
+    ClampedFixed<uint16_t, 16> fraction(uint16_t(49152));
+    EXPECT_EQ((fraction * uint16_t(32768)).value(), 24576) << "Natural fixed-point numbers should multiply too.";
+    EXPECT_EQ((fraction / uint16_t(16384)).value(), UINT16_MAX) << "Quotients past one should saturate.";
+  }
+  
+  TEST(FixedTests, MatchesExactReference)
+  {
+    std::mt19937 rng(2030);
+    std::uniform_int_distribution<int> raw(INT16_MIN, INT16_MAX);
+    for(int trial = 0; trial < 20000; ++trial) {
+      const int16_t a = int16_t(raw(rng)), b = int16_t(raw(rng)), p = int16_t(raw(rng)), q = int16_t(raw(rng));
+      const int16_t min = (p < q) ? p : q, max = (p < q) ? q : p;
+      const ClampedQ8_8 lhs(a, (a < min) ? a : min, (a > max) ? a : max);
+      ASSERT_EQ((lhs * b).value(), referenceFixed<8>(true, a, b, lhs.minValue(), lhs.maxValue()))
+          << a << " * " << b;
+      ASSERT_EQ((lhs / b).value(), referenceFixed<8>(false, a, b, lhs.minValue(), lhs.maxValue()))
+          << a << " / " << b;
+    }
+  }
+  
+  TEST(FixedTests, ConvertsToAndFromDecimal)
+  {
+    const ClampedQ16_16 fromDouble(ClampedDouble(1.25, -2.0, 2.0));
+    EXPECT_EQ(fromDouble.value(), 81920);
+    EXPECT_EQ(fromDouble.minValue(), -131072);
+    EXPECT_EQ(fromDouble.maxValue(), 131072);
+    
+    const ClampedDouble back = fromDouble.toDecimal<double>();
+    EXPECT_EQ(back.value(), 1.25) << "Conversion to a decimal wide enough should be exact.";
+    EXPECT_EQ(back.minValue(), -2.0);
+    EXPECT_EQ(back.maxValue(), 2.0);
+    
+    EXPECT_EQ(ClampedQ16_16::rawOf(0.5 / 65536), 1) << "Halves should round away from zero.";
+    EXPECT_EQ(ClampedQ16_16::rawOf(-0.5 / 65536), -1);
+    EXPECT_EQ(ClampedQ16_16::rawOf(1e10), INT32_MAX) << "Decimals beyond IntT should saturate.";
+    EXPECT_EQ(ClampedQ16_16::rawOf(-1e10f), INT32_MIN);
+    EXPECT_EQ(ClampedQ16_16::rawOf(std::nan("")), 0) << "NaN should convert to zero.";
+    EXPECT_EQ(ClampedQ15::decimalOf<float>(-16384), -0.5f);
+    
+    const ClampedQ15 fromFloat(ClampedFloat(0.25f, -1.0f, 1.0f));
+    EXPECT_EQ(fromFloat.value(), 8192);
+    EXPECT_EQ(fromFloat.maxValue(), INT16_MAX) << "Bounds beyond IntT should saturate.";
+  }
+  
+  TEST(FixedTests, BatchMatchesScalar)
+  {
+    std::mt19937 rng(31);
+    std::uniform_int_distribution<int32_t> raw(-8 * 65536, 8 * 65536);
+    const int32_t min = -4 * 65536, max = 4 * 65536;
+    std::vector<int32_t> values(1000);
+    for(int32_t &value : values) {
+      const int32_t drawn = raw(rng);
+      value = (drawn < min) ? min : (drawn > max) ? max : drawn;
+    }
+    
+    for(const int32_t other : {3 * 65536 / 2, -65536 / 3, 0}) {
+      std::vector<int32_t> products(values), quotients(values);
+      batch::multiplyFixed<16>(products.data(), products.size(), other, min, max);
+      batch::divideFixed<16>(quotients.data(), quotients.size(), other, min, max);
+      for(std::size_t i = 0; i < values.size(); ++i) {
+        ClampedQ16_16 number(values[i], min, max);
+        ASSERT_EQ(products[i], (number * other).value()) << values[i] << " * " << other;
+        ASSERT_EQ(quotients[i], (number / other).value()) << values[i] << " / " << other;
+      }
+    }
+  }
+}
@@ -0,0 +1,228 @@
+#include <cstring>
+
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "flat_clamped_numbers.hh"
+
+namespace
+{
+  using namespace clamped;
+  
+  TEST(FlatNumberTests, Layout)
+  {
+    EXPECT_EQ(sizeof(flat::ClampedInt8), 3 * sizeof(int8_t)) << "flat::ClampedInt8 holds more than its fields.";
+    EXPECT_EQ(sizeof(flat::ClampedInt32), 3 * sizeof(int32_t)) << "flat::ClampedInt32 holds more than its fields.";
+    EXPECT_EQ(sizeof(flat::ClampedUInt64), 3 * sizeof(uint64_t)) << "flat::ClampedUInt64 holds more than its fields.";
+    EXPECT_TRUE(std::is_trivially_copyable<flat::ClampedInt32>::value) << "flat::ClampedInt32 is not trivially copyable.";
+    EXPECT_TRUE(std::is_standard_layout<flat::ClampedInt32>::value) << "flat::ClampedInt32 is not standard layout.";
+  }
+  
+  TEST(FlatNumberTests, MemcpyArray)
+  {
+    flat::ClampedInt32 src[3] = {{1, 0, 10}, {-5, -10, 0}, {7, 7, 7}};
+    flat::ClampedInt32 dst[3] = {{0}, {0}, {0}};
+    std::memcpy(dst, src, sizeof(src));
+    
+    for(int i = 0; i < 3; ++i) {
+      EXPECT_EQ(dst[i].value(), src[i].value()) << "Copied value differs at index " << i << ".";
+      EXPECT_EQ(dst[i].minValue(), src[i].minValue()) << "Copied minimum differs at index " << i << ".";
+      EXPECT_EQ(dst[i].maxValue(), src[i].maxValue()) << "Copied maximum differs at index " << i << ".";
+    }
+  }
+  
+  TEST(FlatNumberTests, ConstructorStretchedBounds)
+  {
+    flat::BasicClampedNumber<int> num(0, 1, -1);
+    ASSERT_EQ(num.value(), 0) << "flat::BasicClampedNumber::value() does not report correct starting value.";
+    EXPECT_EQ(num.minValue(), 0) << "Number minimum should stretch to fit starting value.";
+    EXPECT_EQ(num.maxValue(), 0) << "Number maximum should stretch to fit starting value.";
+  }
+  
+  TEST(FlatNumberTests, DefaultBounds)
+  {
+    flat::ClampedInt16 num(5);
+    EXPECT_EQ(num.minValue(), std::numeric_limits<int16_t>::min()) << "Default minimum is not the type minimum.";
+    EXPECT_EQ(num.maxValue(), std::numeric_limits<int16_t>::max()) << "Default maximum is not the type maximum.";
+  }
+  
+  TEST(FlatNumberTests, IntegerSaturation)
+  {
+    flat::ClampedInt32 num(5, -10, 10);
+    num += 10;
+    EXPECT_EQ(num.value(), 10) << "Addition past the maximum should saturate.";
+    num -= 30;
+    EXPECT_EQ(num.value(), -10) << "Subtraction past the minimum should saturate.";
+    num.value(4);
+    num *= 3;
+    EXPECT_EQ(num.value(), 10) << "Multiplication past the maximum should saturate.";
+    EXPECT_EQ((num / 3).value(), 3) << "Division should truncate toward zero.";
+  }
+  
+  TEST(FlatNumberTests, Comparisons)
+  {
+    flat::ClampedInt32 lo(1, 0, 10), hi(2, -5, 5);
+    EXPECT_TRUE(lo < hi);
+    EXPECT_TRUE(lo <= hi);
+    EXPECT_TRUE(hi > lo);
+    EXPECT_TRUE(hi >= lo);
+    EXPECT_TRUE(lo != hi);
+    EXPECT_FALSE(lo == hi);
+    
+    const flat::ClampedDouble nan(std::numeric_limits<double>::quiet_NaN(), -1.0, 1.0), one(1.0, -1.0, 1.0);
+    EXPECT_FALSE(nan < one || nan <= one || nan > one || nan >= one) << "NaN should be unordered.";
+    EXPECT_FALSE(one < nan || one <= nan || one > nan || one >= nan) << "NaN should be unordered.";
+    EXPECT_FALSE(nan == nan);
+    EXPECT_TRUE(nan != nan);
+  }
+  
+  // Every operator is constexpr, so saturation can be checked by the compiler
+  constexpr flat::ClampedInt32 saturatedSum(int32_t value, int32_t other)
+  {
+    flat::ClampedInt32 num(value, -100, 100);
+    num += other;
+    return num;
+  }
+  
+  constexpr flat::ClampedUInt8 saturatedProduct(uint8_t value, uint8_t other)
+  {
+    flat::ClampedUInt8 num(value);
+    num *= other;
+    return num;
+  }
+  
+  constexpr flat::ClampedDouble saturatedQuotient(double value, double other)
+  {
+    flat::ClampedDouble num(value, -8.0, 8.0);
+    num /= other;
+    return num;
+  }
+  
+  static_assert(saturatedSum(90, 5).value() == 95, "Constexpr addition within bounds should be exact.");
+  static_assert(saturatedSum(90, 50).value() == 100, "Constexpr addition past the maximum should saturate.");
+  static_assert(saturatedSum(-90, std::numeric_limits<int32_t>::min()).value() == -100,
+      "Constexpr addition overflowing the type should saturate at the minimum.");
+  static_assert(saturatedProduct(20, 20).value() == 255, "Constexpr multiplication should saturate.");
+  static_assert(saturatedQuotient(1.0, 0.0).value() == 8.0, "Constexpr division by zero should saturate.");
+  static_assert(saturatedQuotient(-4.0, 2.0).value() == -2.0, "Constexpr division should be exact within bounds.");
+  static_assert((flat::ClampedInt8(100) - int8_t(-100)).value() == 127, "Constexpr subtraction should saturate.");
+  static_assert((flat::ClampedInt16(7, 0, 10) % int16_t(4)).value() == 3, "Constexpr remainder should be exact.");
+  static_assert((-flat::ClampedInt32(5, 0, 10)).minValue() == -5, "Constexpr negation should stretch the bounds.");
+  static_assert(flat::ClampedInt32(3, 0, 5) < flat::ClampedInt32(4, 0, 5), "Constexpr comparisons should hold.");
+  static_assert(int32_t(flat::ClampedInt32(3, 5, 1)) == 3, "Constexpr construction should stretch the bounds.");
+  
+  constexpr ClampResult<int32_t> checkedSum(int32_t value, int32_t other)
+  {
+    flat::ClampedInt32 num(value, -100, 100);
+    return num.addChecked(other);
+  }
+  
+  static_assert(checkedSum(50, 50).reaction == ClampReaction::NONE, "A result exactly at the bound was not clamped.");
+  static_assert(checkedSum(50, 51).reaction == ClampReaction::MAXIMUM, "Checked addition should saturate.");
+  static_assert(checkedSum(50, 51).value == 100, "Checked addition should report the saturated value.");
+  static_assert(checkedSum(-50, -51).saturated(), "Checked addition should saturate at the minimum.");
+  
+  static_assert(multiplyAdd(flat::ClampedInt16(10, 0, 50), int16_t(10), int16_t(-60)).value() == 40,
+      "A fused expression should clamp only its result.");
+  static_assert(multiplyAdd<ClampPolicy::EVERY_STEP>(flat::ClampedInt16(10, 0, 50), int16_t(10), int16_t(-60))
+      .value() == 0, "Clamping at every step should match the operators.");
+  static_assert(multiplyAddDivide(flat::ClampedUInt32(10, 0, 50), 10u, 0u, 4u).value() == 25,
+      "A fused quotient should clamp only its result.");
+  
+  // A lookup table of clamped values, built entirely during compilation
+  struct RampTable
+  {
+    int16_t values[16];
+  };
+  
+  constexpr RampTable rampTable()
+  {
+    RampTable table = {};
+    flat::ClampedInt16 num(0, -1000, 1000);
+    for(int i = 0; i < 16; ++i) {
+      table.values[i] = num.value();
+      num *= int16_t(-3);
+      num -= int16_t(1);
+    }
+    return table;
+  }
+  
+  constexpr RampTable ramp = rampTable();
+  static_assert(ramp.values[3] == -7 && ramp.values[8] == 999 && ramp.values[9] == -1000,
+      "Constexpr tables should saturate at both bounds.");
+  
+  TEST(FlatNumberTests, CompileTimeTable)
+  {
+    const int16_t expected[] = {0, -1, 2, -7, 20, -61, 182, -547, 999, -1000, 999, -1000, 999, -1000, 999, -1000};
+    for(int i = 0; i < 16; ++i)
+      EXPECT_EQ(ramp.values[i], expected[i]) << "Compile-time table differs at index " << i << ".";
+  }
+  
+  constexpr flat::ClampedInt32 reboundOne()
+  {
+    flat::ClampedInt32 num(50, 0, 100);
+    num.rebound<ReboundPolicy::CLAMP>(60, 80);
+    return num;
+  }
+  
+  static_assert(reboundOne().value() == 60 && reboundOne().maxValue() == 80,
+      "Rebounding should be usable in constant expressions.");
+  
+  TEST(FlatNumberTests, Rebound)
+  {
+    std::vector<flat::ClampedDouble> numbers;
+    for(int i = 0; i < 20; ++i)
+      numbers.emplace_back(double(i), 0.0, 19.0);
+    
+    flat::rebound(numbers.data(), numbers.size(), 5.0, 10.0);
+    EXPECT_EQ(numbers[2].minValue(), 2.0) << "A minimum above the value should stretch down to it.";
+    EXPECT_EQ(numbers[2].maxValue(), 10.0);
+    EXPECT_EQ(numbers[15].minValue(), 5.0);
+    EXPECT_EQ(numbers[15].maxValue(), 15.0) << "A maximum below the value should stretch up to it.";
+    
+    flat::rebound<ReboundPolicy::CLAMP>(numbers.data(), numbers.size(), 5.0, 10.0);
+    for(std::size_t i = 0; i < numbers.size(); ++i) {
+      EXPECT_EQ(numbers[i].minValue(), 5.0) << "Clamping should take the bounds as given, at index " << i;
+      EXPECT_EQ(numbers[i].maxValue(), 10.0) << "Clamping should take the bounds as given, at index " << i;
+      EXPECT_EQ(numbers[i].value(), (i < 5) ? 5.0 : (i > 10) ? 10.0 : double(i)) << "at index " << i;
+    }
+  }
+  
+  constexpr flat::ClampedInt16 mixedBase(5, 0, 1000);
+  
+  static_assert((mixedBase + 70000).value() == 1000 && (mixedBase - 70000LL).value() == 0,
+      "Mixed-width operators should saturate rather than wrap, in constant expressions.");
+  static_assert((mixedBase + flat::ClampedInt64(7, 0, 9)).value() == 12,
+      "Clamped operands of another width should combine by value.");
+  
+  TEST(FlatNumberTests, MixedOperands)
+  {
+    const flat::ClampedUInt8 natural(10, 0, 200);
+    EXPECT_EQ((natural - (-5)).value(), 15) << "A negative operand should not convert to a large natural.";
+    EXPECT_EQ((natural * 1000u).value(), 200);
+    EXPECT_EQ((natural % int64_t(4)).value(), 2);
+    EXPECT_EQ((natural / flat::ClampedInt32(-2, -5, 5)).value(), 0);
+    
+    const flat::ClampedDouble decimal(1.0, 0.0, 5.0);
+    EXPECT_EQ((decimal * 4.5f).value(), 4.5);
+    EXPECT_EQ((decimal + flat::ClampedFloat(2.0f, 0.0f, 3.0f)).value(), 3.0);
+    EXPECT_EQ((decimal - 10).value(), 0.0) << "Integral operands of decimals should clamp as decimals.";
+  }
+  
+# ifdef __cpp_lib_three_way_comparison
+  static_assert((flat::ClampedInt32(3, 0, 10) <=> flat::ClampedInt32(5, 4, 6)) < 0,
+      "Three-way comparison should order by value alone.");
+  static_assert(std::is_same<decltype(flat::ClampedInt32(0) <=> flat::ClampedInt32(0)), std::strong_ordering>::value,
+      "Integers should be strongly ordered.");
+  
+  TEST(FlatNumberTests, ThreeWayComparison)
+  {
+    const flat::ClampedDouble nan(std::numeric_limits<double>::quiet_NaN(), 0.0, 1.0);
+    EXPECT_EQ(nan <=> flat::ClampedDouble(0.5, 0.0, 1.0), std::partial_ordering::unordered);
+    EXPECT_EQ(flat::ClampedDouble(0.5, 0.0, 1.0) <=> flat::ClampedDouble(0.5, -1.0, 2.0),
+        std::partial_ordering::equivalent) << "Bounds should play no part.";
+  }
+# endif
+}
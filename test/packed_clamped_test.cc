@@ -0,0 +1,94 @@
+#include <cstdint>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "clamped_array.hh"
+#include "packed_clamped.hh"
+#include "static_clamped.hh"
+
+namespace
+{
+  using namespace clamped;
+  
+  static_assert(sizeof(ClampedSmall<int64_t, 1000, 1255>) == 1, "A range of 256 values should take one byte.");
+  static_assert(ClampedSmall<int32_t, 0, 100>::bits == 7, "[0, 100] should need seven bits.");
+  static_assert(sizeof(ClampedSmall<uint32_t, 0, 65535>) == 2, "A range of 65536 values should take two bytes.");
+  static_assert(sizeof(ClampedSmall<int64_t, INT64_MIN, INT64_MAX>) == 8, "The full range should take every bit.");
+  static_assert((ClampedSmall<int64_t, 1000, 1255>(1200) += 100).value() == 1255,
+      "Packed arithmetic should be usable in constant expressions.");
+  
+  TEST(PackedClampedTests, SmallMatchesStaticClamped)
+  {
+    using Small = ClampedSmall<int16_t, -300, 500>;
+    using Static = StaticClamped<int16_t, -300, 500>;
+    EXPECT_EQ(Small(-1000).value(), -300) << "A starting value below the minimum should be clamped.";
+    EXPECT_EQ(Small().value(), 0);
+    
+    for(int start = -400; start <= 600; start += 7)
+      for(int other = -1000; other <= 1000; other += 13) {
+        const int16_t a = int16_t(start), b = int16_t(other);
+        ASSERT_EQ((Small(a) + b).value(), (Static(a) + b).value()) << start << " + " << other;
+        ASSERT_EQ((Small(a) - b).value(), (Static(a) - b).value()) << start << " - " << other;
+        ASSERT_EQ((Small(a) * b).value(), (Static(a) * b).value()) << start << " * " << other;
+        ASSERT_EQ((Small(a) / b).value(), (Static(a) / b).value()) << start << " / " << other;
+        ASSERT_EQ((Small(a) % b).value(), (Static(a) % b).value()) << start << " % " << other;
+        ASSERT_EQ(Small(a) < Small(b), Static(a) < Static(b)) << start << " < " << other;
+      }
+  }
+  
+  TEST(PackedClampedTests, ArrayMatchesClampedArray)
+  {
+    const std::pair<int64_t, int64_t> boundsList[] = {
+      {7, 8}, {1000, 1255}, {-20, 20}, {0, 400}, {-5000000000, 5000000000}, {INT64_MIN, INT64_MAX}
+    };
+    const unsigned expectedBits[] = {1, 8, 6, 9, 34, 64};
+    
+    std::mt19937_64 rng(21);
+    const std::size_t count = 1000;
+    for(std::size_t b = 0; b < 6; ++b) {
+      const int64_t min = boundsList[b].first, max = boundsList[b].second;
+      std::uniform_int_distribution<int64_t> dist(min / 2 - 10, max / 2 + 10);
+      std::vector<int64_t> raw(count);
+      for(int64_t &value : raw)
+        value = dist(rng) * 2;
+      
+      PackedClampedArray<int64_t> packed(count, 0, min, max);
+      ClampedArray<int64_t> plain(count, min, min, max);
+      EXPECT_EQ(packed.bitsPerValue(), expectedBits[b]) << "Wrong width for [" << min << ", " << max << "].";
+      EXPECT_EQ(packed.wordCount(), (count + 64 / expectedBits[b] - 1) / (64 / expectedBits[b]));
+      
+      packed.assign(raw.data());
+      plain.assign(raw.data());
+      ((((packed += 3) *= -2) -= 100) /= 3);
+      ((((plain += 3) *= -2) -= 100) /= 3);
+      
+      std::vector<int64_t> unpacked(count);
+      packed.unpack(unpacked.data());
+      for(std::size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(packed.value(i), plain.value(i)) << "Packed element " << i << " saturated differently in ["
+            << min << ", " << max << "].";
+        ASSERT_EQ(unpacked[i], plain.value(i)) << "Unpacking should match element access, at index " << i;
+      }
+    }
+  }
+  
+  TEST(PackedClampedTests, ElementAccess)
+  {
+    PackedClampedArray<uint16_t> arr(30, 5, 0, 1000);
+    EXPECT_EQ(arr.bitsPerValue(), 10u);
+    EXPECT_EQ(arr.value(17, 2000), 1000) << "An assigned value should be clamped into the bounds.";
+    EXPECT_EQ(arr.value(17), 1000);
+    EXPECT_EQ(arr.value(16), 5) << "Assigning one element should leave its neighbours alone.";
+    EXPECT_EQ(arr.value(18), 5) << "Assigning one element should leave its neighbours alone.";
+    
+    arr += 999;
+    EXPECT_EQ(arr.value(17), 1000);
+    EXPECT_EQ(arr.value(29), 1000) << "The last, partly filled word should be processed too.";
+    arr /= 0;
+    arr -= 1;
+    EXPECT_EQ(arr.value(0), 999);
+  }
+}
@@ -0,0 +1,70 @@
+#include <cstdint>
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "sharded_clamped_counter.hh"
+
+namespace
+{
+  using namespace clamped;
+  
+  TEST(ShardedCounterTests, ConstructorStretchedBounds)
+  {
+    ShardedClampedCounter<int32_t> counter(0, 1, -1, 4);
+    EXPECT_EQ(counter.value(), 0) << "ShardedClampedCounter::value() does not report correct starting value.";
+    EXPECT_EQ(counter.minValue(), 0) << "Counter minimum should stretch to fit starting value.";
+    EXPECT_EQ(counter.maxValue(), 0) << "Counter maximum should stretch to fit starting value.";
+    EXPECT_EQ(counter.shardCount(), 4u) << "Counter should hold the requested number of shards.";
+    EXPECT_EQ(ShardedClampedCounter<int8_t>(0, -1, 1, 0).shardCount(), 1u) << "Counter should hold at least one shard.";
+  }
+  
+  TEST(ShardedCounterTests, PendingAndReconciled)
+  {
+    ShardedClampedCounter<int8_t> counter(100, -128, 127, 2);
+    counter += 50;
+    counter -= 20;
+    EXPECT_EQ(counter.estimate(), 127) << "Estimates should include pending deltas, clamped into the bounds.";
+    EXPECT_EQ(counter.value(), 127) << "Pending deltas should reconcile as one step.";
+    EXPECT_EQ(counter.estimate(), 127) << "Estimates should match the value once flushed.";
+    
+    counter.subtract(127);
+    counter.subtract(127);
+    counter.add(-128);
+    EXPECT_EQ(counter.flush(), -128) << "Deltas beyond the type's range should saturate at the minimum.";
+  }
+  
+  TEST(ShardedCounterTests, FlushThreshold)
+  {
+    ShardedClampedCounter<int64_t> counter(0, -1000, 1000, 1, 10);
+    counter.add(9);
+    counter.add(9);
+    EXPECT_EQ(counter.estimate(), 18) << "Crossing the threshold should leave the estimate exact.";
+    counter.add(5000);
+    EXPECT_EQ(counter.estimate(), 1000) << "A flushed delta past the maximum should saturate.";
+    counter.subtract(1);
+    EXPECT_EQ(counter.value(), 999) << "Updates after a saturating flush should apply to the bound.";
+  }
+  
+  TEST(ShardedCounterTests, ConcurrentUpdates)
+  {
+    const int threads = 8, increments = 20000;
+    ShardedClampedCounter<int32_t> exact(0, -1000000, 1000000, 4, 64);
+    ShardedClampedCounter<int32_t> saturating(0, 0, 1000, 4);
+    
+    std::vector<std::thread> workers;
+    for(int t = 0; t < threads; ++t)
+      workers.emplace_back([&, t]() {
+        for(int i = 0; i < increments; ++i) {
+          exact += (t % 2 == 0) ? 3 : -1;
+          saturating += 1;
+        }
+      });
+    for(std::thread &worker : workers)
+      worker.join();
+    
+    EXPECT_EQ(exact.value(), threads / 2 * increments * 2) << "Updates within bounds should reconcile exactly.";
+    EXPECT_EQ(saturating.value(), 1000) << "Updates past the maximum should saturate on reconciliation.";
+  }
+}
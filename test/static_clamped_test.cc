@@ -0,0 +1,60 @@
+#include <type_traits>
+
+#include "gtest/gtest.h"
+#include "static_clamped.hh"
+
+namespace
+{
+  using namespace clamped;
+  
+  static_assert(sizeof(ClampedPercent) == sizeof(int32_t), "StaticClamped must hold only its value");
+  static_assert(std::is_trivially_copyable<ClampedPercent>::value, "StaticClamped must be trivially copyable");
+  static_assert((ClampedPercent(90) + 20).value() == 100, "StaticClamped addition must saturate at compile time");
+  static_assert((ClampedPercent(10) - 20).value() == 0, "StaticClamped subtraction must saturate at compile time");
+  
+  TEST(StaticClampedTests, ConstructorClampsValue)
+  {
+    EXPECT_EQ(ClampedPercent().value(), 0) << "Default construction should hold zero.";
+    EXPECT_EQ(ClampedPercent(150).value(), 100) << "Starting value above Max should clamp to Max.";
+    EXPECT_EQ(ClampedPercent(-5).value(), 0) << "Starting value below Min should clamp to Min.";
+    EXPECT_EQ((StaticClamped<int, 10, 20>().value()), 10) << "Default construction should hold the bound nearest zero.";
+  }
+  
+  TEST(StaticClampedTests, Setters)
+  {
+    ClampedPercent pct(50);
+    EXPECT_EQ(pct.value(120), 100) << "Assigned value above Max should clamp to Max.";
+    EXPECT_EQ(pct.minimize(), 0) << "minimize() should yield Min.";
+    EXPECT_EQ(pct.maximize(), 100) << "maximize() should yield Max.";
+  }
+  
+  TEST(StaticClampedTests, Arithmetic)
+  {
+    StaticClamped<int16_t, -100, 100> num(50);
+    num *= 3;
+    EXPECT_EQ(num.value(), 100) << "Multiplication past Max should saturate.";
+    num /= -2;
+    EXPECT_EQ(num.value(), -50) << "Division should be exact within bounds.";
+    num += -80;
+    EXPECT_EQ(num.value(), -100) << "Adding a negative past Min should saturate.";
+    
+    ClampedPort port(65000);
+    port += 1000;
+    EXPECT_EQ(port.value(), 65535) << "Unsigned addition past Max should saturate.";
+    
+    StaticClamped<uint16_t, 0, 1000> small(999);
+    EXPECT_EQ((small + 1).value(), 1000) << "An int operand should convert to NumT.";
+    EXPECT_EQ((small + 5).value(), 1000);
+    EXPECT_EQ((small - 1000).value(), 0);
+    EXPECT_EQ((small * 2).value(), 1000);
+    EXPECT_EQ((small / 3).value(), 333);
+    EXPECT_EQ((small % 10).value(), 9);
+  }
+  
+  TEST(StaticClampedTests, Comparisons)
+  {
+    EXPECT_TRUE(ClampedPercent(10) < ClampedPercent(20));
+    EXPECT_TRUE(ClampedPercent(200) == ClampedPercent(100));
+    EXPECT_TRUE(ClampedPercent(20) >= ClampedPercent(20));
+  }
+}